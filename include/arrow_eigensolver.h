@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+
+namespace quda
+{
+
+  /**
+     @brief Eigensolver for the real symmetric matrices that arise when
+     restarting the thick-restarted Lanczos method: a diagonal block of
+     size arrow_pos, bordered by an arrow in row and column arrow_pos,
+     followed by a tridiagonal tail.  For arrow_pos = 0 the matrix is
+     simply tridiagonal.
+
+     The eigen-decomposition is computed by divide and conquer.  The
+     tridiagonal tail is recursively split about its middle row into
+     two halves; once the halves have been diagonalized the matrix is
+     an arrowhead matrix in their eigenbasis, whose eigenvalues are the
+     roots of a secular equation, with deflation of negligible
+     couplings and close poles, and whose eigenvectors are computed
+     from the Loewner-corrected couplings (Gu and Eisenstat), such that
+     they are orthogonal to working precision.  The outermost merge,
+     of the diagonal block with the tail about the arrow, is not
+     multiplied out: only the eigenvalues and the last component of
+     each eigenvector (needed for the Ritz residua) are formed
+     directly, and eigenvectors are formed on demand, so that the cost
+     of the final matrix product is proportional to the number of Ritz
+     vectors that are kept.  Root finding and eigenvector formation are
+     multithreaded with OpenMP if it is enabled.
+  */
+  class ArrowEigensolver
+  {
+    /** Matrix dimension */
+    int dim = 0;
+
+    /** Size of the block above the apex of the outermost merge */
+    int n_left = 0;
+
+    /** Whether the block above the apex is diagonal */
+    bool left_diagonal = true;
+
+    /** Eigenvalues in ascending order */
+    std::vector<double> evals;
+
+    /** Last component of each eigenvector */
+    std::vector<double> last_row;
+
+    /** Eigenvectors of the block above the apex (column major, unused if diagonal) */
+    std::vector<double> left_evecs;
+
+    /** Eigenvectors of the block below the apex (column major) */
+    std::vector<double> right_evecs;
+
+    /** Eigenvectors of the outermost arrowhead matrix (column major) */
+    std::vector<double> arrow_evecs;
+
+  public:
+    /**
+       @brief Compute the eigen-decomposition of the matrix
+       @param[in] diag The diagonal, of length dim
+       @param[in] offdiag The off-diagonal, of length dim - 1: entries
+       [0, arrow_pos) are the arrow, entries [arrow_pos, dim - 1) are
+       the sub-diagonal of the tail
+       @param[in] dim The matrix dimension
+       @param[in] arrow_pos The position of the arrow
+    */
+    void compute(const double *diag, const double *offdiag, int dim, int arrow_pos);
+
+    /**
+       @return The eigenvalues in ascending order
+    */
+    const std::vector<double> &eigenvalues() const { return evals; }
+
+    /**
+       @return The last component of each eigenvector
+    */
+    const std::vector<double> &lastRow() const { return last_row; }
+
+    /**
+       @brief Form the eigenvectors corresponding to the n_vec smallest
+       eigenvalues
+       @param[out] evecs The eigenvectors, with eigenvector i stored
+       contiguously starting at evecs[i * dim]
+       @param[in] n_vec The number of eigenvectors to form
+    */
+    void eigenvectors(double *evecs, int n_vec) const;
+  };
+
+} // namespace quda
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <string>
+#include <cstdio>
+#include <cstdint>
+
+namespace quda
+{
+
+  class ColorSpinorField;
+  class GaugeField;
+
+  /**
+     @brief CheckpointIO is a simple wrapper class for saving and
+     restoring the raw (native order) contents of lattice fields and
+     host arrays to a per-process binary file.  Unlike VectorIO, this
+     does not depend on QIO and makes no attempt at portability: a
+     checkpoint can only be restored with the same process grid,
+     local volume and field precisions as were used to create it.
+     Each file carries a header with a checksum that identifies the
+     state (e.g., gauge configuration) the checkpoint was created from.
+   */
+  class CheckpointIO
+  {
+    /** Filename including the process rank suffix */
+    const std::string filename;
+
+    /** Whether we are writing (true) or reading (false) */
+    const bool write;
+
+    /** The checksum stored in (or read from) the file header */
+    uint64_t checksum;
+
+    /** File handle */
+    FILE *fp;
+
+    /**
+       @brief Write a raw block of bytes, erroring on failure
+       @param[in] data Pointer to host data
+       @param[in] bytes Number of bytes to write
+    */
+    void write_bytes(const void *data, size_t bytes);
+
+    /**
+       @brief Read a raw block of bytes, erroring on failure
+       @param[out] data Pointer to host data
+       @param[in] bytes Number of bytes to read
+    */
+    void read_bytes(void *data, size_t bytes);
+
+    /**
+       @brief Helper for saving a lattice field via its host buffer interface
+       @param[in] field The field we are saving
+       @param[in] bytes Size of the buffer representation of the field
+    */
+    template <class Field> void save_field(const Field &field, size_t bytes);
+
+    /**
+       @brief Helper for loading a lattice field via its host buffer interface
+       @param[out] field The field we are loading
+       @param[in] bytes Size of the buffer representation of the field
+    */
+    template <class Field> void load_field(Field &field, size_t bytes);
+
+  public:
+    /**
+       @brief Open a checkpoint file.  When writing, the header is
+       written immediately; when reading, the header is read and
+       checked for consistency.
+       @param[in] filename The filename prefix (the process rank is appended)
+       @param[in] write Whether we are writing or reading
+       @param[in] checksum The checksum to store in the header (only used when writing)
+    */
+    CheckpointIO(const std::string &filename, bool write, uint64_t checksum = 0);
+
+    /**
+       @brief Closes the file
+    */
+    ~CheckpointIO();
+
+    CheckpointIO(const CheckpointIO &) = delete;
+    CheckpointIO &operator=(const CheckpointIO &) = delete;
+
+    /**
+       @return The checksum stored in the header
+    */
+    uint64_t Checksum() const { return checksum; }
+
+    /**
+       @brief Query whether a checkpoint file exists for this process
+       and was created from a state with the given checksum.  This
+       does not error if the file is absent or invalid, and it is
+       local to this process: callers should reduce the result across
+       processes before acting on it.
+       @param[in] filename The filename prefix (the process rank is appended)
+       @param[in] checksum The expected checksum
+       @return Whether the checkpoint is present and matches
+    */
+    static bool valid(const std::string &filename, uint64_t checksum);
+
+    /**
+       @brief Save a host array
+       @param[in] data The host array
+       @param[in] bytes The size of the array in bytes
+    */
+    void save(const void *data, size_t bytes);
+
+    /**
+       @brief Load a host array, checking the stored size matches
+       @param[out] data The host array
+       @param[in] bytes The size of the array in bytes
+    */
+    void load(void *data, size_t bytes);
+
+    /**
+       @brief Save a color-spinor field (host or device)
+       @param[in] field The field to save
+    */
+    void save(const ColorSpinorField &field);
+
+    /**
+       @brief Load a color-spinor field (host or device), checking the
+       stored size matches the field
+       @param[out] field The field to load
+    */
+    void load(ColorSpinorField &field);
+
+    /**
+       @brief Save a gauge field (host or device), including its
+       fixed-point scale factor
+       @param[in] field The field to save
+    */
+    void save(const GaugeField &field);
+
+    /**
+       @brief Load a gauge field (host or device), checking the
+       stored size matches the field.  The ghost zone is not
+       exchanged: this is the responsibility of the caller.
+       @param[out] field The field to load
+    */
+    void load(GaugeField &field);
+  };
+
+} // namespace quda
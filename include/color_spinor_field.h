@@ -1014,6 +1014,22 @@ namespace quda {
   */
   void copyFieldOffset(ColorSpinorField &out, const ColorSpinorField &in, CommKey offset, QudaPCType pc_type);
 
+  /**
+     @brief Copy a four-dimensional field into, or out of, slice s of
+     a multi-RHS field, i.e., a five-dimensional field with 4-d
+     even-odd preconditioning whose fifth dimension indexes the
+     right-hand sides.  The single right-hand side field may be 4-d,
+     or 5-d with unit fifth dimension as used for staggered fermions.
+     Whether we insert or extract is determined by which of the two
+     fields is the multi-RHS one.  Each parity is
+     moved with a single strided copy, so both fields must be in the
+     same location, precision and field order.
+     @param[out] out The destination field
+     @param[in] in The source field
+     @param[in] s The right-hand side index in the multi-RHS field
+  */
+  void copySlice(ColorSpinorField &out, const ColorSpinorField &in, int s);
+
   void genericPrintVector(const cpuColorSpinorField &a, unsigned int x);
   void genericCudaPrintVector(const cudaColorSpinorField &a, unsigned x);
 
@@ -783,5 +783,8 @@ constexpr quda::CommKey default_comm_key = {1, 1, 1, 1};
 
 void push_communicator(const quda::CommKey &split_key);
 
+/** @brief Return the key of the communicator that is currently active */
+quda::CommKey get_current_comm_key();
+
 /** @brief These routine broadcast the data according to the default communicator */
 void comm_broadcast_global(void *data, size_t nbytes);
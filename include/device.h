@@ -12,6 +12,13 @@ namespace quda
      */
     void init(int dev);
 
+    /**
+       @brief Make the device selected by init current on the calling
+       host thread.  Must be called by any host thread, other than the
+       one that initialized the library, before it issues device work.
+     */
+    void init_thread();
+
     /**
        @brief Get number of devices present on node
     */
@@ -120,6 +127,14 @@ namespace quda
      */
     unsigned int max_blocks_per_processor();
 
+    /**
+       @brief Returns the amount of device memory that is currently
+       free.  This does not include memory held in QUDA's device
+       memory pool.
+       @return The free device memory in bytes
+    */
+    size_t free_memory();
+
     namespace profile
     {
 
@@ -13,6 +13,7 @@ namespace quda {
 
   // Forward declare: MG Transfer Class
   class Transfer;
+  class CheckpointIO;
 
   // Forward declare: Dirac Op Base Class
   class Dirac;
@@ -55,6 +56,7 @@ namespace quda {
     int commDim[QUDA_MAX_DIM]; // whether to do comms or not
 
     QudaPrecision halo_precision; // only does something for DiracCoarse at present
+    QudaPrecision block_float_precision; // block floating point link precision used by DiracCoarse
 
     // for multigrid only
     Transfer *transfer; 
@@ -79,6 +81,7 @@ namespace quda {
       tmp1(0),
       tmp2(0),
       halo_precision(QUDA_INVALID_PRECISION),
+      block_float_precision(QUDA_INVALID_PRECISION),
       need_bidirectional(false),
 #ifdef QUDA_MMA_AVAILABLE
       use_mma(true),
@@ -108,6 +111,7 @@ namespace quda {
       printfQuda("mu = %g\n", mu);
       printfQuda("epsilon = %g\n", epsilon);
       printfQuda("halo_precision = %d\n", halo_precision);
+      printfQuda("block_float_precision = %d\n", block_float_precision);
       for (int i=0; i<QUDA_MAX_DIM; i++) printfQuda("commDim[%d] = %d\n", i, commDim[i]);
       for (int i = 0; i < Ls; i++)
         printfQuda(
@@ -241,6 +245,22 @@ namespace quda {
     */
     virtual void MdagMLocal(ColorSpinorField &, const ColorSpinorField &) const { errorQuda("Not implemented!\n"); }
 
+    /**
+       @brief Approximately solve M x = b with block-Jacobi: the local
+              lattice is split into hypercubic blocks of extent
+              block_size, and n_iter MR iterations are run on each
+              block with zero Dirichlet boundary conditions on its faces.
+       @param[out] x Output approximate solution (scaled by omega)
+       @param[in] b Input source
+       @param[in] block_size Hypercubic block extent
+       @param[in] n_iter Number of MR iterations per block
+       @param[in] omega Relaxation parameter
+    */
+    virtual void BlockMR(ColorSpinorField &, const ColorSpinorField &, int, int, double) const
+    {
+      errorQuda("Not implemented!\n");
+    }
+
     /**
        @brief Apply the local MdagM operator: equivalent to applying zero Dirichlet
               boundary condition to MdagM on each rank. Depending on the number of
@@ -1587,6 +1607,14 @@ public:
     mutable cudaGaugeField *Xinv_d; /** GPU copy of inverse coarse clover term */
     mutable cudaGaugeField *Yhat_d; /** GPU copy of the preconditioned coarse link field */
 
+    const QudaPrecision block_float_precision; /** Precision of the block floating point links (invalid if disabled) */
+    mutable cudaGaugeField *Y_bf;    /** Block floating point copy of Y_d used by the dslash */
+    mutable cudaGaugeField *X_bf;    /** Block floating point copy of X_d used by the dslash */
+    mutable cudaGaugeField *Xinv_bf; /** Block floating point copy of Xinv_d used by the dslash */
+    mutable cudaGaugeField *Yhat_bf; /** Block floating point copy of Yhat_d used by the dslash */
+    const DiracCoarse *bf_owner;     /** Operator owning the block floating point copies we read (this unless shared) */
+    bool use_block_float;            /** Whether the dslash reads the block floating point copies (if enabled) */
+
     /**
        @brief Initialize the coarse gauge fields.  Location is
        determined by gpu_setup variable.
@@ -1620,17 +1648,54 @@ public:
      */
     void createYhat(bool gpu = true) const;
 
+    /**
+       @brief Return the block floating point copy slot that
+       corresponds to a GPU link field of this operator
+       @param[in] field The GPU link field (one of Y_d, X_d, Xinv_d or Yhat_d)
+     */
+    cudaGaugeField *&blockFloatField(const cudaGaugeField *field) const;
+
+    /**
+       @brief Return the GPU link field to be used by the dslash.  If
+       block_float_precision is set this is a block floating point
+       copy of the field, created on first use, so that only the
+       fields an operator actually applies are copied.  The original
+       fields are retained for the coarse-operator construction.
+       @param[in] field The GPU link field (one of Y_d, X_d, Xinv_d or Yhat_d)
+     */
+    const GaugeField &dslashField(const cudaGaugeField *field) const;
+
+    /**
+       @brief Prefetch the block floating point copy of a GPU link
+       field, if it has been created
+       @param[in] field The GPU link field (one of Y_d, X_d, Xinv_d or Yhat_d)
+       @param[in] mem_space Memory space we are prefetching to
+       @param[in] stream Which stream to run the prefetch in
+     */
+    void prefetchBlockFloat(const cudaGaugeField *field, QudaFieldLocation mem_space, qudaStream_t stream) const;
+
   public:
     double Mass() const { return mass; }
     double Mu() const { return mu; }
     double MuFactor() const { return mu_factor; }
 
+    /**
+       @brief Set whether the GPU dslash reads the block floating
+       point link copies, if block_float_precision is set, or the
+       original links.  Used to verify the copies.
+       @param[in] enable Whether to use the block floating point copies
+     */
+    void enableBlockFloat(bool enable) { use_block_float = enable; }
+
     /**
        @param[in] param Parameters defining this operator
        @param[in] gpu_setup Whether to do the setup on GPU or CPU
        @param[in] mapped Set to true to put Y and X fields in mapped memory
+       @param[in] compute Whether to compute the coarse links.  If
+       false, the links are only allocated and must be populated with
+       load().
      */
-    DiracCoarse(const DiracParam &param, bool gpu_setup=true, bool mapped=false);
+    DiracCoarse(const DiracParam &param, bool gpu_setup = true, bool mapped = false, bool compute = true);
 
     /**
        @param[in] param Parameters defining this operator
@@ -1652,6 +1717,23 @@ public:
        @param[in] param Parameters defining this operator
      */
     DiracCoarse(const DiracCoarse &dirac, const DiracParam &param);
+
+    /**
+       @brief Create a copy of another operator on an agglomerated
+       processor grid: its coarse link fields at the given location are
+       gathered with split_field, such that each of the sub-partitions
+       given by split_key holds the entire operator on fewer processes.
+       Must be called with the parent communicator active, and the
+       resulting operator may only be applied with the communicator of
+       the sub-partition active.  This instance owns the gathered links.
+       @param[in] dirac The operator to agglomerate
+       @param[in] param Parameters defining this operator
+       @param[in] split_key Number of sub-partitions in each dimension
+       @param[in] location Location of the link fields to agglomerate
+     */
+    DiracCoarse(const DiracCoarse &dirac, const DiracParam &param, const CommKey &split_key,
+                QudaFieldLocation location);
+
     virtual ~DiracCoarse();
 
     virtual bool isCoarse() const { return true; }
@@ -1699,6 +1781,12 @@ public:
 
     virtual void MdagM(ColorSpinorField &out, const ColorSpinorField &in) const;
 
+    /**
+       @brief Block-Jacobi MR solve of the full coarse operator on a
+       CPU-located level (see Dirac::BlockMR)
+    */
+    virtual void BlockMR(ColorSpinorField &x, const ColorSpinorField &b, int block_size, int n_iter, double omega) const;
+
     virtual void prepare(ColorSpinorField* &src, ColorSpinorField* &sol, ColorSpinorField &x, ColorSpinorField &b,
 			 const QudaSolutionType) const;
 
@@ -1745,6 +1833,20 @@ public:
       @param[in] stream Which stream to run the prefetch in (default 0)
     */
     virtual void prefetch(QudaFieldLocation mem_space, qudaStream_t stream = device::get_default_stream()) const;
+
+    /**
+       @brief Save the coarse link fields (Y, X, Yhat, Xinv) from the
+       setup location to a checkpoint
+       @param[in] io The checkpoint we are writing to
+    */
+    void save(CheckpointIO &io) const;
+
+    /**
+       @brief Restore the coarse link fields (Y, X, Yhat, Xinv) in the
+       setup location from a checkpoint and exchange the ghost zones
+       @param[in] io The checkpoint we are reading from
+    */
+    void load(CheckpointIO &io);
   };
 
   /**
@@ -1765,6 +1867,15 @@ public:
      */
     DiracCoarsePC(const DiracCoarse &dirac, const DiracParam &param);
 
+    /**
+       @param[in] dirac The operator to agglomerate
+       @param[in] param Parameters defining this operator
+       @param[in] split_key Number of sub-partitions in each dimension
+       @param[in] location Location of the link fields to agglomerate
+     */
+    DiracCoarsePC(const DiracCoarse &dirac, const DiracParam &param, const CommKey &split_key,
+                  QudaFieldLocation location);
+
     virtual ~DiracCoarsePC();
 
     void Dslash(ColorSpinorField &out, const ColorSpinorField &in, const QudaParity parity) const;
@@ -1903,18 +2014,54 @@ public:
   protected:
     const Dirac *dirac;
 
+    /** Multi-RHS fields the right-hand sides are packed into, kept for the next application */
+    mutable ColorSpinorField *in_mrhs = nullptr;
+    mutable ColorSpinorField *out_mrhs = nullptr;
+
   public:
     DiracMatrix(const Dirac &d) : dirac(&d), shift(0.0) { }
     DiracMatrix(const Dirac *d) : dirac(d), shift(0.0) { }
     DiracMatrix(const DiracMatrix &mat) : dirac(mat.dirac), shift(mat.shift) { }
     DiracMatrix(const DiracMatrix *mat) : dirac(mat->dirac), shift(mat->shift) { }
-    virtual ~DiracMatrix() { }
+    virtual ~DiracMatrix()
+    {
+      if (in_mrhs) delete in_mrhs;
+      if (out_mrhs) delete out_mrhs;
+    }
+
+    DiracMatrix &operator=(const DiracMatrix &mat)
+    {
+      // the multi-RHS fields are not shared
+      dirac = mat.dirac;
+      shift = mat.shift;
+      return *this;
+    }
 
     virtual void operator()(ColorSpinorField &out, const ColorSpinorField &in) const = 0;
     virtual void operator()(ColorSpinorField &out, const ColorSpinorField &in, ColorSpinorField &tmp) const = 0;
     virtual void operator()(ColorSpinorField &out, const ColorSpinorField &in, ColorSpinorField &Tmp1,
                             ColorSpinorField &Tmp2) const = 0;
 
+    /**
+       @brief Apply the operator to a set of right-hand sides.  This
+       is the entry point for solvers that work on several vectors at
+       once (e.g., block eigensolvers).  If the underlying Dirac
+       operator has a multi-RHS implementation (see hasMultiRHS) and
+       the fields are on the device, the right-hand sides are packed
+       into the fifth dimension of a single multi-RHS field and the
+       operator is applied once, such that the links (and clover
+       term) are loaded once for all right-hand sides.  The multi-RHS
+       fields are kept and reused while the set of right-hand sides
+       keeps the same size and layout.  Otherwise the
+       operator is applied to each right-hand side in turn.
+       @param[out] out The set of output spinors
+       @param[in] in The set of input spinors
+       @param[in] Tmp1 Temporary spinor
+       @param[in] Tmp2 Temporary spinor
+    */
+    virtual void operator()(std::vector<ColorSpinorField *> &out, const std::vector<ColorSpinorField *> &in,
+                            ColorSpinorField &Tmp1, ColorSpinorField &Tmp2) const;
+
     unsigned long long flops() const { return dirac->Flops(); }
 
     QudaMatPCType getMatPCType() const { return dirac->getMatPCType(); }
@@ -1950,6 +2097,23 @@ public:
         false;
     }
 
+    /**
+       @brief return if the operator can be applied to a multi-RHS
+       field, i.e., a 5-d field with 4-d preconditioning whose fifth
+       dimension indexes the right-hand sides
+    */
+    bool hasMultiRHS() const
+    {
+      return (Type() == typeid(DiracWilson).name() || Type() == typeid(DiracWilsonPC).name()
+              || Type() == typeid(DiracClover).name() || Type() == typeid(DiracCloverPC).name()
+              || Type() == typeid(DiracTwistedMass).name() || Type() == typeid(DiracTwistedMassPC).name()
+              || Type() == typeid(DiracStaggered).name() || Type() == typeid(DiracStaggeredPC).name()
+              || Type() == typeid(DiracImprovedStaggered).name() || Type() == typeid(DiracImprovedStaggeredPC).name()
+              || Type() == typeid(DiracCoarse).name() || Type() == typeid(DiracCoarsePC).name()) ?
+        true :
+        false;
+    }
+
     /**
        @brief return if the operator is a domain wall operator, that is, 5-dimensional
     */
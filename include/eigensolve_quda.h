@@ -5,6 +5,7 @@
 #include <timer.h>
 #include <dirac_quda.h>
 #include <color_spinor_field.h>
+#include <arrow_eigensolver.h>
 
 namespace quda
 {
@@ -12,6 +13,9 @@ namespace quda
   // Local enum for the LU axpy block type
   enum blockType { PENCIL, LOWER_TRI, UPPER_TRI };
 
+  /** Fraction of the free memory that the Ritz rotation may use for workspace */
+  constexpr double rotate_memory_fraction = 0.5;
+
   class EigenSolver
   {
     using range = std::pair<int, int>;
@@ -58,6 +62,11 @@ namespace quda
 
     QudaPrecision save_prec;
 
+    // Chebyshev parameters as passed in, restored on exit if they were set automatically
+    int poly_deg_in;
+    double a_min_in;
+    double a_max_in;
+
   public:
     /**
        @brief Constructor for base Eigensolver class
@@ -99,7 +108,11 @@ namespace quda
     void prepareInitialGuess(std::vector<ColorSpinorField *> &kSpace);
 
     /**
-       @brief Check for a maximum of the Chebyshev operator
+       @brief Set any Chebyshev parameters that were not supplied by
+       the user: a_max (if a_max <= 0), a_min (if a_min <= 0) and the
+       polynomial degree (if poly_deg <= 0).  These are chosen by
+       estimateChebyParams, and cached for reuse with the same
+       operator.
        @param[in] mat The problem operator
        @param[in] kSpace The Krylov space vectors
     */
@@ -148,7 +161,8 @@ namespace quda
 
     /**
        @brief Promoted the specified matVec operation:
-       M, Mdag, MMdag, MdagM to a Chebyshev polynomial
+       M, Mdag, MMdag, MdagM to a Chebyshev polynomial.  This is the
+       single-vector case of the set overload below.
        @param[in] mat Matrix operator
        @param[in] out Output spinor
        @param[in] in Input spinor
@@ -156,13 +170,42 @@ namespace quda
     void chebyOp(const DiracMatrix &mat, ColorSpinorField &out, const ColorSpinorField &in);
 
     /**
-       @brief Estimate the spectral radius of the operator for the max value of the
-       Chebyshev polynomial
+       @brief Applies the specified matVec operation to a set of
+       vectors, using the multi-RHS apply of the operator
        @param[in] mat Matrix operator
-       @param[in] out Output spinor
-       @param[in] in Input spinor
+       @param[in] out Output spinors
+       @param[in] in Input spinors
+    */
+    void matVec(const DiracMatrix &mat, std::vector<ColorSpinorField *> &out, const std::vector<ColorSpinorField *> &in);
+
+    /**
+       @brief Applies the Chebyshev polynomial of the specified matVec
+       operation to a set of vectors, with each matVec of the
+       recursion applied to the whole set at once
+       @param[in] mat Matrix operator
+       @param[in] out Output spinors
+       @param[in] in Input spinors
+    */
+    void chebyOp(const DiracMatrix &mat, std::vector<ColorSpinorField *> &out, const std::vector<ColorSpinorField *> &in);
+
+    /**
+       @brief Choose the Chebyshev parameters from a short Lanczos run
+       on the operator.  The extremal Ritz values and their error
+       bounds give the spectral interval, and the Ritz values with
+       their weights in the starting vector (a Gauss quadrature of the
+       spectral density) give the estimated eigenvalue count below any
+       point.  The free parameters among a_min and poly_deg are then
+       chosen to minimize a model of the eigensolver cost: the number
+       of Lanczos steps needed to converge the n_conv-th eigenvalue
+       (the Kaniel-Paige-Saad bound for the filtered operator, given
+       its gap to the first eigenvalue outside the Krylov space and
+       the eigenvalues below it), multiplied by the cost of a step
+       (poly_deg matvecs plus orthogonalization against half the
+       Krylov space, both timed during the Lanczos run).
+       @param[in] mat Matrix operator
+       @param[in] v Work vectors, v[0] holds the normalized starting vector
     */
-    double estimateChebyOpMax(const DiracMatrix &mat, ColorSpinorField &out, ColorSpinorField &in);
+    void estimateChebyParams(const DiracMatrix &mat, std::vector<ColorSpinorField *> &v);
 
     /**
        @brief Orthogonalise input vectors r against
@@ -190,6 +233,20 @@ namespace quda
     */
     bool orthoCheck(std::vector<ColorSpinorField *> v, int j);
 
+    /**
+       @brief Determine the number of workspace vectors to use for a
+       Ritz rotation.  Unless set by the user (batched_rotate > 0),
+       this is the largest number that fits in the free memory of the
+       location the Krylov space resides in, such that the rotation is
+       done in as few passes over the Krylov space as possible.
+       @param[in] kSpace the Krylov space
+       @param[in] offset The position of the start of unused vectors in kSpace
+       @param[in] keep The number of vectors to be formed by the rotation
+       @return The number of workspace vectors; if this is at least
+       keep the rotation is done in a single pass
+    */
+    int rotateBatchSize(const std::vector<ColorSpinorField *> &kSpace, int offset, int keep);
+
     /**
        @brief Rotate the Krylov space
        @param[in] kSpace the Krylov space
@@ -234,11 +291,10 @@ namespace quda
        @param[in] js Start of j index
        @param[in] je End of j index
        @param[in] blockType Type of caxpy(_U/L) to perform
-       @param[in] je End of j index
        @param[in] offset Position of extra vectors in kSpace
     */
     void blockRotate(std::vector<ColorSpinorField *> &kSpace, double *array, int rank, const range &i, const range &j,
-                     blockType b_type);
+                     blockType b_type, int offset);
 
     /**
        @brief Rotate part of kSpace
@@ -441,13 +497,29 @@ namespace quda
     */
     virtual bool hermitian() { return true; } /** TRLM is only for Hermitian systems */
 
-    // Variable size matrix
+    // Variable size matrix, holding the kept Ritz vectors
     std::vector<double> ritz_mat;
 
+    // Eigensolver for the arrow matrix
+    ArrowEigensolver arrow_eigensolver;
+
     // Tridiagonal/Arrow matrix, fixed size.
     double *alpha;
     double *beta;
 
+    // Estimated overlap of each Krylov vector with the locked space
+    std::vector<double> locked_overlap;
+
+    // Overlap above which a Lanczos vector is projected against the locked space
+    double locked_overlap_tol;
+
+    // Whether the next Lanczos vector must be projected against the locked space
+    bool project_locked_next;
+
+    // Lanczos steps taken with locked vectors present, and how many of those were projected against them
+    int n_locked_step;
+    int n_locked_projection;
+
     /**
        @brief Compute eigenpairs
        @param[in] kSpace Krylov vector space
@@ -462,6 +534,23 @@ namespace quda
     */
     void lanczosStep(std::vector<ColorSpinorField *> v, int j);
 
+    /**
+       @brief Estimate the largest overlap of the next Lanczos vector
+       v_{j+1} with the locked eigenvectors, from the recurrence that
+       the overlaps obey in the Lanczos process (in the spirit of
+       Simon's partial reorthogonalization).  Each locked eigenvector
+       y satisfies A y = theta y + e, so the overlap grows by
+       |theta - alpha_j| / beta_j per step, plus rounding, which is
+       propagated from step to step.  The residual e, bounded by its
+       norm at locking, adds a further |e| / beta_j at this step only,
+       since its projections onto the successive orthonormal Lanczos
+       vectors do not add up coherently.
+       @param[in] j Index of the current Lanczos vector
+       @param[out] resid_overlap The overlap contributed at this step by the locked residuals
+       @return The estimated overlap propagated by the recurrence
+    */
+    double lockedOverlap(int j, double &resid_overlap);
+
     /**
        @brief Reorder the Krylov space by eigenvalue
        @param[in] kSpace the Krylov space
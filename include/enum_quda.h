@@ -128,6 +128,7 @@ typedef enum QudaInverterType_s {
   QUDA_CA_CGNE_INVERTER,
   QUDA_CA_CGNR_INVERTER,
   QUDA_CA_GCR_INVERTER,
+  QUDA_BLOCK_CG_INVERTER,
   QUDA_INVALID_INVERTER = QUDA_INVALID_ENUM
 } QudaInverterType;
 
@@ -178,12 +179,14 @@ typedef enum QudaMultigridCycleType_s {
   QUDA_MG_CYCLE_FCYCLE,
   QUDA_MG_CYCLE_WCYCLE,
   QUDA_MG_CYCLE_RECURSIVE,
+  QUDA_MG_CYCLE_KCYCLE,
   QUDA_MG_CYCLE_INVALID = QUDA_INVALID_ENUM
 } QudaMultigridCycleType;
 
 typedef enum QudaSchwarzType_s {
   QUDA_ADDITIVE_SCHWARZ,
   QUDA_MULTIPLICATIVE_SCHWARZ,
+  QUDA_BLOCK_JACOBI_SCHWARZ,
   QUDA_INVALID_SCHWARZ = QUDA_INVALID_ENUM
 } QudaSchwarzType;
 
@@ -198,6 +201,7 @@ typedef enum QudaResidualType_s {
 typedef enum QudaCABasis_s {
   QUDA_POWER_BASIS,
   QUDA_CHEBYSHEV_BASIS,
+  QUDA_NEWTON_BASIS,
   QUDA_INVALID_BASIS = QUDA_INVALID_ENUM
 } QudaCABasis;
 
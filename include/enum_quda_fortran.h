@@ -123,6 +123,7 @@
 #define QUDA_CA_CGNE_INVERTER 22
 #define QUDA_CA_CGNR_INVERTER 23
 #define QUDA_CA_GCR_INVERTER 24
+#define QUDA_BLOCK_CG_INVERTER 25
 #define QUDA_INVALID_INVERTER QUDA_INVALID_ENUM
 
 #define QudaEigType integer(4)
@@ -166,11 +167,13 @@
 #define QUDA_MG_CYCLE_FCYCLE 1
 #define QUDA_MG_CYCLE_WCYCLE 2
 #define QUDA_MG_CYCLE_RECURSIVE 3
+#define QUDA_MG_CYCLE_KCYCLE 4
 #define QUDA_MG_CYCLE_INVALID QUDA_INVALID_ENUM
 
 #define QudaSchwarzType integer(4)
 #define QUDA_ADDITIVE_SCHWARZ 0 
 #define QUDA_MULTIPLICATIVE_SCHWARZ 1
+#define QUDA_BLOCK_JACOBI_SCHWARZ 2
 #define QUDA_INVALID_SCHWARZ QUDA_INVALID_ENUM
 
 #define QudaResidualType integer(4)
@@ -182,6 +185,7 @@
 #define QudaCABasis integer(4)
 #define QUDA_POWER_BASIS 0
 #define QUDA_CHEBYSHEV_BASIS 1
+#define QUDA_NEWTON_BASIS 2
 #define QUDA_INVALID_BASIS QUDA_INVALID_ENUM
 
 #/*
@@ -5,6 +5,7 @@
 #include <lattice_field.h>
 
 #include <comm_key.h>
+#include <functional>
 
 namespace quda {
 
@@ -80,6 +81,9 @@ namespace quda {
     /** Size of MILC site struct (only if gauge_order=MILC_SITE_GAUGE_ORDER) */
     size_t site_size;
 
+    /** Whether to store the field in block floating point, with a scale per site and direction (coarse links only) */
+    bool block_float;
+
     // Default constructor
     GaugeFieldParam(void *const h_gauge = NULL) :
       LatticeFieldParam(),
@@ -101,7 +105,8 @@ namespace quda {
       staggeredPhaseApplied(false),
       i_mu(0.0),
       site_offset(0),
-      site_size(0)
+      site_size(0),
+      block_float(false)
     {
     }
 
@@ -128,7 +133,8 @@ namespace quda {
       staggeredPhaseApplied(false),
       i_mu(0.0),
       site_offset(0),
-      site_size(0)
+      site_size(0),
+      block_float(false)
     {
     }
 
@@ -152,7 +158,8 @@ namespace quda {
       staggeredPhaseApplied(param.staggered_phase_applied),
       i_mu(param.i_mu),
       site_offset(param.gauge_offset),
-      site_size(param.site_size)
+      site_size(param.site_size),
+      block_float(false)
     {
       switch (link_type) {
       case QUDA_SU3_LINKS:
@@ -258,6 +265,17 @@ namespace quda {
       */
       size_t site_size;
 
+      /**
+         Whether the field is stored in block floating point, where
+         each link matrix is normalized by its own scale factor
+      */
+      bool block_float;
+
+      /**
+         Bytes needed to store the block floating point scale factors
+      */
+      size_t block_float_bytes;
+
       /**
          Compute the required extended ghost zone sizes and offsets
          @param[in] R Radius of the ghost zone
@@ -293,6 +311,7 @@ namespace quda {
     QudaFieldGeometry Geometry() const { return geometry; }
     QudaStaggeredPhase StaggeredPhase() const { return staggeredPhaseType; }
     bool StaggeredPhaseApplied() const { return staggeredPhaseApplied; }
+    bool BlockFloat() const { return block_float; }
 
     /**
      * Define the parameter type for this field.
@@ -354,6 +373,12 @@ namespace quda {
 
     size_t TotalBytes() const { return bytes; }
 
+    /**
+       @return The number of bytes used to store the per-site and
+       per-direction scale factors of a block floating point field
+    */
+    size_t BlockFloatBytes() const { return block_float_bytes; }
+
     virtual void* Gauge_p() { errorQuda("Not implemented"); return (void*)0;}
     virtual void* Even_p() { errorQuda("Not implemented"); return (void*)0;}
     virtual void* Odd_p() { errorQuda("Not implemented"); return (void*)0;}
@@ -362,6 +387,13 @@ namespace quda {
     virtual const void* Even_p() const { errorQuda("Not implemented"); return (void*)0;}
     virtual const void* Odd_p() const { errorQuda("Not implemented"); return (void*)0;}
 
+    /**
+       @return Pointer to the block floating point scale factors, one
+       float per parity, direction and (padded) site, such that the
+       ghost zone stored in the pad has its own scale factors
+    */
+    virtual void *BlockFloatScale_p() const { errorQuda("Not implemented"); return nullptr; }
+
     virtual int full_dim(int d) const { return x[d]; }
 
     const void** Ghost() const {
@@ -452,6 +484,7 @@ namespace quda {
     void *gauge_h; // mapped-memory pointer when allocating on the host
     void *even;
     void *odd;
+    void *block_float_scale; // per-site and per-direction scale factors (block floating point only)
 
     /**
        @brief Initialize the padded region to 0
@@ -561,6 +594,25 @@ namespace quda {
     */
     void loadCPUField(const cpuGaugeField &cpu, TimeProfile &profile);
 
+    /**
+       @brief Download into this field from host data that are
+       supplied in slabs of local time slices.  Host buffers are only
+       allocated for two slabs: the reader filling one slab overlaps
+       with the host reorder of the previous one, which in turn
+       overlaps with the asynchronous transfer of the one before.
+       Only supported for native fields without stored phases.  Fat
+       links are scaled by their max over all slabs, which for
+       fixed-point fields requires reading every slab twice.
+       @param[in] cpu_param Parameters of the full host field (the
+       gauge pointer is ignored)
+       @param[in] reader Function that fills a host field covering
+       local time slices [t_begin, t_end) given as its arguments
+       @param[in] slab Number of local time slices per slab (must be
+       even and divide the local temporal extent, zero selects a default)
+    */
+    void loadCPUFieldStream(const GaugeFieldParam &cpu_param,
+                            const std::function<void(cpuGaugeField &, int, int)> &reader, int slab);
+
     /**
        @brief Upload from this field into a CPU field
        @param[out] cpu The CPU field source
@@ -584,6 +636,8 @@ namespace quda {
     const void* Even_p() const { return even; }
     const void *Odd_p() const { return odd; }
 
+    void *BlockFloatScale_p() const { return block_float_scale; }
+
     /**
       @brief Copy all contents of the field to a host buffer.
       @param[in] the host buffer to copy to.
@@ -733,6 +787,16 @@ namespace quda {
   */
   double norm2(const GaugeField &u);
 
+  /**
+     @brief Compute the L2 norm squared of the difference of two gauge
+     fields, where the second field is overwritten with the
+     difference.  The two fields must share the same layout.
+     @param[in] a The gauge field we are subtracting from
+     @param[in,out] b The gauge field we are subtracting, on exit b = a - b
+     @return The L2 norm squared of a - b
+  */
+  double xmyNorm(const GaugeField &a, GaugeField &b);
+
   /**
      @brief Scale the gauge field by the scalar a.
      @param[in] a scalar multiplier
@@ -755,6 +819,18 @@ namespace quda {
   void copyGenericGauge(GaugeField &out, const GaugeField &in, QudaFieldLocation location, void *Out = 0, void *In = 0,
                         void **ghostOut = 0, void **ghostIn = 0, int type = 0);
 
+  /**
+     @brief Compress a native coarse-link field into a block floating
+     point field: the elements of each link matrix are stored relative
+     to the maximum absolute element of that matrix.  The entire
+     padded region is copied, so the ghost zone of the output is valid
+     if the ghost zone of the input has been exchanged.  Defined in
+     copy_gauge_block_float.cu.
+     @param[out] out The block floating point field we are copying to
+     @param[in] in The native field we are copying from
+  */
+  void copyGaugeBlockFloat(GaugeField &out, const GaugeField &in);
+
   /**
     @brief This function is used for copying from a source gauge field to a destination gauge field
       with an offset.
@@ -842,6 +918,16 @@ namespace quda {
   */
   uint64_t Checksum(const GaugeField &u, bool mini=false);
 
+  /**
+     Compute a positional hash of a device gauge field: each link is
+     hashed together with its position, and the link hashes are
+     combined in an order-independent way, so the result does not
+     depend on the launch configuration.
+     @param[in] u The gauge field we are hashing
+     @return hash value
+  */
+  uint64_t gaugeHash(const GaugeField &u);
+
   /**
      @brief Helper function for determining if the reconstruct of the fields is the same.
      @param[in] a Input field
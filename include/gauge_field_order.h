@@ -677,6 +677,85 @@ namespace quda {
       }
     };
 
+    /**
+       @brief Accessor for native-order coarse-link fields stored in
+       block floating point.  Rather than normalizing every element by
+       the global field maximum, the fixed-point elements of each link
+       matrix are normalized by that matrix's own maximum absolute
+       element, held in a separate array of scale factors with the
+       same padded stride as the links.  The ghost zone in the pad thus
+       carries its own scale factors.
+    */
+    template <typename Float, int nColor, typename storeFloat> struct BlockFloatAccessor {
+      using wrapper = fieldorder_wrapper<Float, storeFloat>;
+      static_assert(fixed_point<Float, storeFloat>(), "Block floating point requires fixed-point storage");
+      static constexpr bool is_mma_compatible = false;
+      complex<storeFloat> *u;
+      float *block_scale; // scale_inv for each matrix
+      const unsigned int offset_cb;
+      const unsigned int scale_offset_cb;
+      const unsigned int stride;
+
+      BlockFloatAccessor(const GaugeField &U, void *gauge_ = nullptr, void ** = nullptr) :
+        u(gauge_ ? static_cast<complex<storeFloat> *>(gauge_) :
+                   static_cast<complex<storeFloat> *>(const_cast<void *>(U.Gauge_p()))),
+        block_scale(static_cast<float *>(U.BlockFloatScale_p())),
+        offset_cb((U.Bytes() >> 1) / sizeof(complex<storeFloat>)),
+        scale_offset_cb(U.Geometry() * U.Stride()),
+        stride(U.Stride())
+      {
+        if (!U.BlockFloat()) errorQuda("Field is not stored in block floating point");
+      }
+
+      void resetScale(Float) { } // scale factors are per matrix, set with set_max()
+
+      /**
+         @brief Set the scale factor of a given link matrix: must be
+         called before the elements of that matrix are written
+         @param[in] max The maximum absolute element of the matrix
+      */
+      __device__ __host__ inline void set_max(int dim, int parity, int x_cb, Float max) const
+      {
+        block_scale[parity * scale_offset_cb + dim * stride + x_cb]
+          = max > static_cast<Float>(0.0) ? max / static_cast<Float>(std::numeric_limits<storeFloat>::max()) :
+                                            static_cast<Float>(1.0);
+      }
+
+      __device__ __host__ inline wrapper operator()(int dim, int parity, int x_cb, int row, int col) const
+      {
+        auto index = parity * offset_cb + dim * stride * nColor * nColor + (row * nColor + col) * stride + x_cb;
+        Float scale_inv = block_scale[parity * scale_offset_cb + dim * stride + x_cb];
+        return wrapper(u, index, static_cast<Float>(1.0) / scale_inv, scale_inv);
+      }
+    };
+
+    /**
+       @brief Ghost accessor for block floating point fields: the
+       ghost zone is always held in the pad of the field
+    */
+    template <typename Float, int nColor, typename storeFloat> struct BlockFloatGhostAccessor {
+      using wrapper = fieldorder_wrapper<Float, storeFloat>;
+      const int volumeCB;
+      unsigned int ghostVolumeCB[8];
+      BlockFloatAccessor<Float, nColor, storeFloat> accessor;
+
+      BlockFloatGhostAccessor(const GaugeField &U, void *gauge_, void ** = nullptr) :
+        volumeCB(U.VolumeCB()), accessor(U, gauge_)
+      {
+        for (int d = 0; d < 4; d++) {
+          ghostVolumeCB[d] = U.Nface() * U.SurfaceCB(d);
+          ghostVolumeCB[d + 4] = U.Nface() * U.SurfaceCB(d);
+        }
+      }
+
+      void resetScale(Float) { }
+
+      __device__ __host__ inline wrapper operator()(int d, int parity, int x_cb, int row, int col) const
+      {
+        return accessor(d % 4, parity, x_cb + (d / 4) * ghostVolumeCB[d] + volumeCB, row, col);
+      }
+    };
+
     /**
        This is a template driven generic gauge field accessor.  To
        deploy for a specifc field ordering, the two operator()
@@ -689,10 +768,14 @@ namespace quda {
        @tparam native_ghost Whether to use native ghosts (inlined into
        @tparam storeFloat_ Underlying storage type for the field
        the padded area for internal-order fields or use a separate array if false)
+       @tparam block_float Whether the field is stored in block
+       floating point (native order with native ghosts only)
      */
     template <typename Float_, int nColor, int nSpinCoarse, QudaGaugeFieldOrder order, bool native_ghost = true,
-              typename storeFloat_ = Float_>
+              typename storeFloat_ = Float_, bool block_float = false>
     struct FieldOrder {
+      static_assert(!block_float || (order == QUDA_FLOAT2_GAUGE_ORDER && native_ghost),
+                    "Block floating point requires native order with native ghosts");
 
       /** Convenient types */
       using Float = Float_;
@@ -706,10 +789,13 @@ namespace quda {
       const QudaFieldLocation location;
       static constexpr int nColorCoarse = nColor / nSpinCoarse;
 
-      using accessor_type = Accessor<Float, nColor, order, storeFloat>;
+      using accessor_type = std::conditional_t<block_float, BlockFloatAccessor<Float, nColor, storeFloat>,
+                                               Accessor<Float, nColor, order, storeFloat>>;
+      using ghost_accessor_type = std::conditional_t<block_float, BlockFloatGhostAccessor<Float, nColor, storeFloat>,
+                                                     GhostAccessor<Float, nColor, order, native_ghost, storeFloat>>;
       static constexpr bool is_mma_compatible = accessor_type::is_mma_compatible;
       accessor_type accessor;
-      GhostAccessor<Float, nColor, order, native_ghost, storeFloat> ghostAccessor;
+      ghost_accessor_type ghostAccessor;
 
       /** Does this field type support ghost zones? */
       static constexpr bool supports_ghost_zone = true;
@@ -2425,6 +2511,9 @@ namespace quda {
   template<typename T, int Nc> struct gauge_order_mapper<T,QUDA_QDP_GAUGE_ORDER,Nc> { typedef gauge::QDPOrder<T, 2*Nc*Nc> type; };
   template<typename T, int Nc> struct gauge_order_mapper<T,QUDA_QDPJIT_GAUGE_ORDER,Nc> { typedef gauge::QDPJITOrder<T, 2*Nc*Nc> type; };
   template<typename T, int Nc> struct gauge_order_mapper<T,QUDA_MILC_GAUGE_ORDER,Nc> { typedef gauge::MILCOrder<T, 2*Nc*Nc> type; };
+  template <typename T, int Nc> struct gauge_order_mapper<T, QUDA_MILC_SITE_GAUGE_ORDER, Nc> {
+    typedef gauge::MILCSiteOrder<T, 2 * Nc * Nc> type;
+  };
   template <typename T, int Nc> struct gauge_order_mapper<T, QUDA_CPS_WILSON_GAUGE_ORDER, Nc> {
     typedef gauge::CPSOrder<T, 2 * Nc * Nc> type;
   };
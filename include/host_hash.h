@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace quda
+{
+
+  /**
+     @brief Mix a 64-bit word into a running hash.  Successive calls
+     do not commute, so a hash built from a sequence of words depends
+     on the position of each word as well as its value.
+     @param[in] hash The running hash
+     @param[in] word The word we are mixing in
+     @return The updated hash
+  */
+  inline uint64_t hashMix(uint64_t hash, uint64_t word)
+  {
+    hash = (hash ^ word) * 0x100000001b3ull;
+    return hash ^ (hash >> 29);
+  }
+
+  /**
+     @brief Compute a positional hash of a contiguous host array.  The
+     array is split into chunks that are hashed independently (in
+     parallel if OpenMP is enabled), and the chunk hashes are then
+     combined in order, so the result depends on both the content and
+     position of each word.
+     @param[in] data The host array
+     @param[in] bytes The size of the array in bytes
+     @return The hash
+  */
+  uint64_t hashHostArray(const void *data, size_t bytes);
+
+  /**
+     @brief Compute a positional hash of a strided host array,
+     consisting of n_block blocks of block_bytes bytes, with
+     consecutive blocks stride bytes apart (e.g., one field of an
+     array of structs).  Bytes between the blocks do not contribute.
+     @param[in] data Pointer to the first block
+     @param[in] block_bytes The size of each block in bytes
+     @param[in] n_block The number of blocks
+     @param[in] stride The distance between blocks in bytes
+     @return The hash
+  */
+  uint64_t hashHostArray(const void *data, size_t block_bytes, size_t n_block, size_t stride);
+
+  /**
+     @brief Key for a cache of data derived from host arrays, e.g., a
+     device copy of host fields that the application passes to us
+     repeatedly.  The key is a hash of the host arrays the cached data
+     was derived from, and a lookup only hits if the hashes match on
+     all processes, so that any collective operations done on a miss
+     are done consistently.
+  */
+  class HostCacheKey
+  {
+    uint64_t key = 0;
+
+  public:
+    /**
+       @brief Check whether the cached data is valid for host data
+       with a given hash on all processes.  This is a collective call.
+       @param[in] hash The hash of the host data we are looking up
+       @param[in] valid Whether the cached data are otherwise
+       compatible with the lookup on this process
+       @return Whether the lookup hits on all processes
+    */
+    bool hit(uint64_t hash, bool valid = true) const;
+
+    /**
+       @brief Record the hash of the host data the cached data now
+       corresponds to.  A zero hash is remapped, since zero denotes an
+       empty cache.
+       @param[in] hash The hash of the host data
+    */
+    void set(uint64_t hash) { key = hash ? hash : 1; }
+
+    /**
+       @brief Mark the cache as empty, such that the next lookup misses
+    */
+    void reset() { key = 0; }
+
+    /**
+       @return Whether the cache holds any data
+    */
+    bool empty() const { return key == 0; }
+  };
+
+} // namespace quda
@@ -70,6 +70,9 @@ namespace quda {
     /**< Whether to keep the partial solution accumulator in sloppy precision */
     bool use_sloppy_partial_accumulator;
 
+    /**< Whether to adapt the sloppy precision at runtime (CG only at the moment) */
+    bool use_adaptive_precision;
+
     /**< This parameter determines how often we accumulate into the
        solution vector from the direction vectors in the solver.
        E.g., running with solution_accumulator_pipeline = 4, means we
@@ -214,6 +217,9 @@ namespace quda {
     /** Whether to use additive or multiplicative Schwarz preconditioning */
     QudaSchwarzType schwarz_type;
 
+    /** Hypercubic block extent used for block-Jacobi Schwarz */
+    int schwarz_block;
+
     /**< The time taken by the solver */
     double secs;
 
@@ -253,6 +259,7 @@ namespace quda {
      */
     SolverParam() :
       compute_null_vector(QUDA_COMPUTE_NULL_VECTOR_NO),
+      use_adaptive_precision(false),
       compute_true_res(true),
       sloppy_converge(false),
       verbosity_precondition(QUDA_SILENT),
@@ -278,6 +285,7 @@ namespace quda {
       delta(param.reliable_delta),
       use_alternative_reliable(param.use_alternative_reliable),
       use_sloppy_partial_accumulator(param.use_sloppy_partial_accumulator),
+      use_adaptive_precision(param.use_adaptive_precision),
       solution_accumulator_pipeline(param.solution_accumulator_pipeline),
       max_res_increase(param.max_res_increase),
       max_res_increase_total(param.max_res_increase_total),
@@ -313,6 +321,7 @@ namespace quda {
       ca_lambda_min(param.ca_lambda_min),
       ca_lambda_max(param.ca_lambda_max),
       schwarz_type(param.schwarz_type),
+      schwarz_block(2),
       secs(param.secs),
       gflops(param.gflops),
       precision_ritz(param.cuda_prec_ritz),
@@ -356,6 +365,7 @@ namespace quda {
       delta(param.delta),
       use_alternative_reliable(param.use_alternative_reliable),
       use_sloppy_partial_accumulator(param.use_sloppy_partial_accumulator),
+      use_adaptive_precision(param.use_adaptive_precision),
       solution_accumulator_pipeline(param.solution_accumulator_pipeline),
       max_res_increase(param.max_res_increase),
       max_res_increase_total(param.max_res_increase_total),
@@ -388,6 +398,7 @@ namespace quda {
       ca_lambda_min(param.ca_lambda_min),
       ca_lambda_max(param.ca_lambda_max),
       schwarz_type(param.schwarz_type),
+      schwarz_block(param.schwarz_block),
       secs(param.secs),
       gflops(param.gflops),
       precision_ritz(param.precision_ritz),
@@ -420,6 +431,13 @@ namespace quda {
       }
     }
 
+    /**
+       Memberwise assignment, e.g., to refresh a solver's parameters
+       from its parent's (unlike the copy constructor, this copies all
+       members, including outputs such as iter and true_res)
+     */
+    SolverParam &operator=(const SolverParam &) = default;
+
     ~SolverParam() { }
 
     /**
@@ -487,6 +505,15 @@ namespace quda {
 
     virtual void blocksolve(ColorSpinorField &out, ColorSpinorField &in);
 
+    /**
+       @brief Solve for a set of right-hand sides.  The default
+       implementation solves for each right-hand side in turn; block
+       solvers override this to solve for all of them at once.
+       @param[out] out The set of solution vectors
+       @param[in] in The set of right-hand sides
+    */
+    virtual void blocksolve(std::vector<ColorSpinorField *> &out, std::vector<ColorSpinorField *> &in);
+
     const DiracMatrix &M() { return mat; }
     const DiracMatrix &Msloppy() { return matSloppy; }
     const DiracMatrix &Mprecon() { return matPrecon; }
@@ -645,6 +672,38 @@ namespace quda {
     std::vector<ColorSpinorField*> p;
     bool init;
 
+    /** For adaptive precision: parameters of the solver at each precision level */
+    std::vector<std::unique_ptr<SolverParam>> adaptive_param;
+    /** For adaptive precision: the solver at each precision level, in order of increasing precision */
+    std::vector<std::unique_ptr<CG>> adaptive_solver;
+    /** For adaptive precision: the sloppy precision used from each iteration onwards in the last solve */
+    std::vector<std::pair<int, QudaPrecision>> precision_schedule;
+
+    bool adaptive_up;      //! Whether this solver may request a step up in sloppy precision
+    bool adaptive_down;    //! Whether this solver may request a step down in sloppy precision
+    int adaptive_patience; //! Number of consecutive clean reliable updates before stepping down
+    int adaptive_clean;    //! Number of consecutive clean reliable updates so far
+    int adaptive_step;     //! The requested step in sloppy precision on exit (0 if none)
+    double r2_old_exit;    //! r2_old at exit, used to continue the recurrence at another precision
+
+    /**
+       @brief Solve with adaptive sloppy precision.  The sloppy
+       precision is stepped between the precondition, sloppy and full
+       precision operators: each precision level has its own CG
+       instance (whose fields persist between solves), and at reliable
+       updates the active instance monitors the drift between the
+       iterated and the true residual.  Excessive drift, or an
+       increase in the true residual, hands the iteration over to the
+       next higher precision, while a run of clean reliable updates
+       hands it back to the next lower one.  The hand-over continues
+       the recurrence from the current solution and search direction.
+       @param out Solution vector
+       @param in Right-hand side
+       @param p_init Initial search direction (may be null)
+       @param r2_old_init r2_old for the initial search direction
+    */
+    void adaptiveSolve(ColorSpinorField &out, ColorSpinorField &in, ColorSpinorField *p_init, double r2_old_init);
+
   public:
     CG(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon, const DiracMatrix &matEig,
        SolverParam &param, TimeProfile &profile);
@@ -775,6 +834,81 @@ namespace quda {
     virtual bool hermitian() { return false; } /** CG3NR is for any system */
   };
 
+  /**
+     @brief Breakdown-free block conjugate gradient (Ji and Li, 2017)
+     for Hermitian positive-definite systems with several right-hand
+     sides.  The search space is rebuilt each iteration by a
+     rank-revealing orthonormalization of the (conjugated) residual
+     block, so directions that become linearly dependent, e.g., as
+     the right-hand sides converge at different rates, are dropped
+     rather than causing the small systems to become singular.
+     Right-hand sides are retired from the block once they have
+     converged.  All dense algebra is on matrices of the block size,
+     and is done on the host.  Mixed precision is supported by
+     restarting from the true residual once every right-hand side
+     has been reduced by delta.
+  */
+  class BlockCG : public Solver
+  {
+
+  private:
+    std::vector<ColorSpinorField *> r;        // high-precision residuals
+    std::vector<ColorSpinorField *> r_sloppy; // sloppy residuals (alias r if not mixed)
+    std::vector<ColorSpinorField *> x_sloppy; // sloppy solution accumulators
+    std::vector<ColorSpinorField *> p;        // orthonormal search directions
+    std::vector<ColorSpinorField *> q;        // mat * search directions
+    std::vector<ColorSpinorField *> w;        // conjugated residuals
+    ColorSpinorField *tmpp;
+    ColorSpinorField *tmp2p;
+    ColorSpinorField *tmp_sloppy;
+    ColorSpinorField *tmp2_sloppy;
+    int n_src; // number of right-hand sides the fields were created for
+
+    /**
+       @brief Allocate the fields needed by the solver
+       @param[in] x Solution vector used for solver meta data
+       @param[in] n Number of right-hand sides
+    */
+    void create(const ColorSpinorField &x, int n);
+
+    /**
+       @brief Free the fields allocated by create()
+    */
+    void destroy();
+
+    /**
+       @brief Rank-revealing orthonormalization of a block of vectors:
+       the Gram matrix is diagonalized and the directions whose
+       singular values are negligible relative to the largest are
+       dropped.  The orthonormal basis is written to the first rank
+       vectors of p.
+       @param[in] v The block to orthonormalize
+       @return The rank of the block, i.e., the number of directions kept
+    */
+    int orthonormalize(std::vector<ColorSpinorField *> &v);
+
+  public:
+    BlockCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
+            const DiracMatrix &matEig, SolverParam &param, TimeProfile &profile);
+    virtual ~BlockCG();
+
+    /**
+       @brief Solve for a single right-hand side (a block of one)
+       @param[out] out The solution vector
+       @param[in] in The right-hand side
+    */
+    void operator()(ColorSpinorField &out, ColorSpinorField &in);
+
+    /**
+       @brief Solve for all right-hand sides at once
+       @param[out] out The set of solution vectors
+       @param[in] in The set of right-hand sides
+    */
+    void blocksolve(std::vector<ColorSpinorField *> &out, std::vector<ColorSpinorField *> &in);
+
+    virtual bool hermitian() { return true; } /** Block CG is only for Hermitian systems */
+  };
+
   class MPCG : public Solver {
     private:
       void computeMatrixPowers(cudaColorSpinorField out[], cudaColorSpinorField &in, int nvec);
@@ -1104,9 +1238,13 @@ namespace quda {
     bool init;
     const bool use_source; // whether we can reuse the source vector
 
-    // Basis. Currently anything except POWER_BASIS causes a warning
-    // then swap to POWER_BASIS.
+    // Basis: power, Chebyshev (p_k = T_k(A) r, with the spectral
+    // interval estimated if not set) or Newton (p_k = prod (A - theta_j) r,
+    // with the shifts theta_j the Leja-ordered Ritz values of A)
     QudaCABasis basis;
+    bool lambda_init;           // whether the basis parameters have been estimated
+    std::vector<Complex> theta; // Newton basis shifts
+    double sigma;               // Newton basis scale factor
 
     Complex *alpha; // Solution coefficient vectors
 
@@ -1114,6 +1252,9 @@ namespace quda {
     ColorSpinorField *tmpp;
     ColorSpinorField *tmp_sloppy;
 
+    ColorSpinorField *p_block; // contiguous storage for the direction vectors (device fields only)
+    ColorSpinorField *q_block; // contiguous storage for the mat * direction vectors (device fields only)
+
     std::vector<ColorSpinorField*> p;  // GCR direction vectors
     std::vector<ColorSpinorField*> q;  // mat * direction vectors
 
@@ -1131,8 +1272,31 @@ namespace quda {
        @param[out] psi Array of coefficients
        @param[in] q Search direction vectors with the operator applied
        @param[in] b Source vector against which we are solving
+       @param[in] estimate Whether to also reduce |b|^2 in the same
+       block reduction, to estimate the new residual norm
+       @return If estimate, the squared residual norm after the update,
+       |b|^2 - phi^dagger psi with phi = Q^dagger b, else zero
+    */
+    double solve(Complex *psi_, std::vector<ColorSpinorField *> &q, ColorSpinorField &b, bool estimate);
+
+    /**
+       @brief Estimate the parameters of the Chebyshev or Newton basis
+       from the Ritz values of a short Arnoldi process started from
+       p[0].  This is only done once per solver instance.  The
+       Chebyshev basis only uses the real interval spanned by the Ritz
+       values, while the Newton basis uses the complex Ritz values as
+       its shifts.
+       @param[in] tmpSloppy Temporary used for the matrix-vector product
     */
-    void solve(Complex *psi_, std::vector<ColorSpinorField*> &q, ColorSpinorField &b);
+    void computeBasisParameters(ColorSpinorField &tmpSloppy);
+
+    /**
+       @brief Form the next basis vector p[k+1] from q[k] = A p[k] for
+       the Chebyshev and Newton bases (for the power basis p[k+1] = q[k]
+       already)
+       @param[in] k Index of the most recent basis vector
+    */
+    void nextBasisVector(int k);
 
 public:
   CAGCR(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon, const DiracMatrix &matEig,
@@ -1285,6 +1449,72 @@ public:
 
   };
 
+  /**
+     @brief Concurrent refinement of the solutions of a multi-shift
+     solve.  Each shift that is to be refined has its own CG
+     recurrence on (A + sigma_i) x_i = b, where A is the operator
+     passed to the solver and sigma_i is the shift relative to it
+     (using the same convention as MultiShiftCG: offset[i] for
+     Wilson-type operators, offset[i] - offset[0] for staggered, where
+     the lowest shift is folded into the mass).  The recurrences
+     advance in lock step, such that each iteration applies the
+     sloppy operator to all search directions at once using the
+     multi-RHS DiracMatrix interface, with the shifts added
+     afterwards.  Mixed precision is handled with reliable updates on
+     each shift independently.
+
+     The sloppy temporaries are held in a fixed pool of pool_size
+     slots: at most pool_size shifts are refined at a time, and when a
+     shift converges its slot is handed over to the next shift
+     waiting for refinement.
+  */
+  class MultiShiftCGRefine : public MultiShiftSolver
+  {
+    /** Number of shifts that are refined concurrently */
+    const int pool_size;
+
+    /** Shift of shift index i relative to the operator */
+    double sigma(int i, const ColorSpinorField &b) const
+    {
+      return b.Nspin() == 4 ? param.offset[i] : param.offset[i] - param.offset[0];
+    }
+
+  public:
+    MultiShiftCGRefine(const DiracMatrix &mat, const DiracMatrix &matSloppy, SolverParam &param, TimeProfile &profile,
+                       int pool_size);
+    virtual ~MultiShiftCGRefine() { }
+
+    /**
+       @brief Refine the solutions of a set of shifts.  The tolerance
+       of each shift is taken from param.tol_offset, and the resulting
+       residuals are written to param.true_res_offset,
+       param.iter_res_offset and param.true_res_hq_offset.
+       @param[in,out] x std::vector of pointers to the solutions for
+       all shifts, used as initial guesses
+       @param[in] b Right-hand side
+       @param[in] shifts Indices of the shifts to refine, in the order
+       they are to be refined
+       @param[in] p Search directions returned by MultiShiftCG (may be
+       empty), used to warm start each shift's recurrence
+       @param[in] r2_old_array r2_old values returned by MultiShiftCG
+       (may be null)
+    */
+    void operator()(std::vector<ColorSpinorField *> x, ColorSpinorField &b, const std::vector<int> &shifts,
+                    const std::vector<ColorSpinorField *> &p, const double *r2_old_array);
+
+    /**
+       @brief Refine the solutions of all shifts, without warm start
+       @param out std::vector of pointer to solutions for all the shifts.
+       @param in right-hand side.
+    */
+    void operator()(std::vector<ColorSpinorField *> out, ColorSpinorField &in)
+    {
+      std::vector<int> shifts(param.num_offset);
+      for (int i = 0; i < param.num_offset; i++) shifts[i] = i;
+      (*this)(out, in, shifts, std::vector<ColorSpinorField *>(), nullptr);
+    }
+  };
+
 
   /**
      @brief This computes the optimum guess for the system Ax=b in the L2
@@ -1347,6 +1577,67 @@ public:
 		    std::vector<ColorSpinorField*> q);
   };
 
+  /**
+     @brief Orthonormal basis for the span of a chronology of
+     solutions, as used for chronological forecasting with MinResExt.
+     The solutions X (oldest first) are represented through their QR
+     factorization X = V R, where V is the orthonormal basis and R is
+     upper triangular, and both are updated incrementally: appending a
+     solution orthogonalizes it against V with classical Gram-Schmidt
+     with one re-orthogonalization, while evicting a solution restores
+     the triangular form of R with Givens rotations that are applied
+     to consecutive pairs of basis vectors.  Each update thus costs
+     O(N) BLAS, and since V is orthonormal the forecast itself needs
+     no orthogonalization (MinResExt with orthogonal = false).
+  */
+  class ChronoBasis
+  {
+    /** The orthonormal basis vectors */
+    std::vector<ColorSpinorField *> v;
+
+    /** The triangular factor, stored row major with leading dimension v.size() */
+    std::vector<Complex> R;
+
+  public:
+    ChronoBasis() = default;
+    ChronoBasis(const ChronoBasis &) = delete;
+    ChronoBasis &operator=(const ChronoBasis &) = delete;
+    ~ChronoBasis() { clear(); }
+
+    /**
+       @return The number of solutions in the chronology
+    */
+    int size() const { return v.size(); }
+
+    /**
+       @return The orthonormal basis vectors
+    */
+    std::vector<ColorSpinorField *> &basis() { return v; }
+
+    /**
+       @brief Delete the basis
+    */
+    void clear();
+
+    /**
+       @brief Append a solution as the newest entry of the chronology,
+       evicting the oldest entry if the chronology is full.  A
+       solution whose component orthogonal to the chronology is below
+       the square root of the storage precision epsilon, relative to
+       its norm, is not added.
+       @param[in] x The solution
+       @param[in] max_dim The maximum length of the chronology
+       @param[in] precision The precision to store the basis in
+    */
+    void push(const ColorSpinorField &x, int max_dim, QudaPrecision precision);
+
+    /**
+       @brief Evict a solution from the chronology
+       @param[in] k The index of the solution, with 0 being the oldest
+    */
+    void evict(int k);
+  };
+
   using ColorSpinorFieldSet = ColorSpinorField;
 
   //forward declaration
@@ -0,0 +1,186 @@
+#include <vector>
+#include <gauge_field_order.h>
+#include <color_spinor_field_order.h>
+#include <kernel.h>
+
+namespace quda
+{
+
+  template <typename Float_, typename yFloat, int nSpin_, int nColor_> struct CoarseBlockMRArg : kernel_param<> {
+    using Float = Float_;
+    using real = typename mapper<Float>::type;
+    static constexpr int nSpin = nSpin_;
+    static constexpr int nColor = nColor_;
+    static constexpr int nDim = 4;
+
+    using F = typename colorspinor::FieldOrderCB<real, nSpin, nColor, 1, QUDA_SPACE_SPIN_COLOR_FIELD_ORDER, Float>;
+    using G = typename gauge::FieldOrder<real, nColor * nSpin, nSpin, QUDA_QDP_GAUGE_ORDER, true, yFloat>;
+
+    F x;              // output block solution
+    const F b;        // input source
+    const G Y;        // coarse link field
+    const G X;        // coarse clover field
+    const real kappa; // hopping parameter of the coarse operator
+    const int n_iter; // number of MR iterations per block
+    const real omega; // relaxation parameter applied to the block solution
+    const int block;  // hypercubic extent of each block
+    int dim[nDim];    // full local lattice dimensions
+    int n_block[nDim]; // number of blocks in each dimension
+    int block_volume;  // number of sites per block
+
+    CoarseBlockMRArg(ColorSpinorField &x, const ColorSpinorField &b, const GaugeField &Y, const GaugeField &X,
+                     double kappa, int block, int n_iter, double omega) :
+      kernel_param(dim3(1, 1, 1)),
+      x(x),
+      b(b),
+      Y(Y),
+      X(X),
+      kappa(kappa),
+      n_iter(n_iter),
+      omega(omega),
+      block(block),
+      block_volume(1)
+    {
+      int n = 1;
+      for (int d = 0; d < nDim; d++) {
+        dim[d] = x.X(d);
+        n_block[d] = dim[d] / block;
+        n *= n_block[d];
+        block_volume *= block;
+      }
+      threads = dim3(n, 1, 1);
+    }
+  };
+
+  /**
+     Approximately solves the coarse operator restricted to one
+     hypercubic block of the local lattice, with zero Dirichlet
+     boundary conditions on the block faces.  Each host thread owns
+     whole blocks, so that the block source, solution and residual
+     stay in that core's cache for all of the MR iterations.
+  */
+  template <typename Arg> struct CoarseBlockMR {
+    using real = typename Arg::real;
+    static constexpr int n = Arg::nSpin * Arg::nColor;
+    const Arg &arg;
+    static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
+    static constexpr int host_block_x = 1; // each x index is a whole lattice block, so schedule blocks individually
+
+    // per-thread scratch, one instance per host thread block
+    std::vector<complex<real>> x, r, Ar;
+    std::vector<int> parity, x_cb;
+
+    CoarseBlockMR(const Arg &arg) :
+      arg(arg),
+      x(arg.block_volume * n),
+      r(arg.block_volume * n),
+      Ar(arg.block_volume * n),
+      parity(arg.block_volume),
+      x_cb(arg.block_volume)
+    {
+    }
+
+    /**
+       @brief Return the block-local neighbor of site i in dimension
+       d, or -1 if the neighbor lies outside of the block
+    */
+    inline int neighbor(int i, int d, int dir) const
+    {
+      int stride = 1;
+      for (int e = 0; e < d; e++) stride *= arg.block;
+      int o = (i / stride) % arg.block;
+      if (dir > 0) return o + 1 < arg.block ? i + stride : -1;
+      return o > 0 ? i - stride : -1;
+    }
+
+    /**
+       @brief Apply the coarse operator restricted to the block, out = A_BB in
+    */
+    inline void apply(complex<real> *out, const complex<real> *in) const
+    {
+      for (int i = 0; i < arg.block_volume; i++) {
+        for (int row = 0; row < n; row++) {
+          complex<real> clover = 0.0;
+          for (int col = 0; col < n; col++) clover = cmac(arg.X(0, parity[i], x_cb[i], row, col), in[i * n + col], clover);
+
+          complex<real> hop = 0.0;
+          for (int d = 0; d < Arg::nDim; d++) {
+            const int fwd = neighbor(i, d, +1);
+            if (fwd >= 0) {
+              for (int col = 0; col < n; col++)
+                hop = cmac(arg.Y(d + 4, parity[i], x_cb[i], row, col), in[fwd * n + col], hop);
+            }
+            const int back = neighbor(i, d, -1);
+            if (back >= 0) {
+              for (int col = 0; col < n; col++)
+                hop = cmac(conj(arg.Y(d, parity[back], x_cb[back], col, row)), in[back * n + col], hop);
+            }
+          }
+          out[i * n + row] = clover - arg.kappa * hop;
+        }
+      }
+    }
+
+    inline void operator()(int block_idx)
+    {
+      // map the block-local site index to the local checkerboard index
+      int block_coord[Arg::nDim];
+      for (int d = 0, idx = block_idx; d < Arg::nDim; d++) {
+        block_coord[d] = idx % arg.n_block[d];
+        idx /= arg.n_block[d];
+      }
+
+      for (int i = 0; i < arg.block_volume; i++) {
+        int full = 0, sum = 0;
+        for (int d = Arg::nDim - 1, idx = i; d >= 0; d--) {
+          int stride = 1;
+          for (int e = 0; e < d; e++) stride *= arg.block;
+          int c = block_coord[d] * arg.block + (idx / stride);
+          idx %= stride;
+          full = full * arg.dim[d] + c;
+          sum += c;
+        }
+        parity[i] = sum & 1;
+        x_cb[i] = full / 2;
+      }
+
+      for (int i = 0; i < arg.block_volume; i++) {
+        for (int s = 0; s < Arg::nSpin; s++) {
+          for (int c = 0; c < Arg::nColor; c++) {
+            r[(i * Arg::nSpin + s) * Arg::nColor + c] = arg.b(parity[i], x_cb[i], s, c);
+            x[(i * Arg::nSpin + s) * Arg::nColor + c] = 0.0;
+          }
+        }
+      }
+
+      for (int k = 0; k < arg.n_iter; k++) {
+        apply(Ar.data(), r.data());
+
+        // alpha = <Ar, r> / <Ar, Ar>, accumulated in double
+        double dot_re = 0.0, dot_im = 0.0, norm = 0.0;
+        for (int j = 0; j < arg.block_volume * n; j++) {
+          dot_re += Ar[j].real() * r[j].real() + Ar[j].imag() * r[j].imag();
+          dot_im += Ar[j].real() * r[j].imag() - Ar[j].imag() * r[j].real();
+          norm += Ar[j].real() * Ar[j].real() + Ar[j].imag() * Ar[j].imag();
+        }
+        if (norm == 0.0) break;
+
+        // x += alpha r, r -= alpha Ar
+        complex<real> alpha(dot_re / norm, dot_im / norm);
+        for (int j = 0; j < arg.block_volume * n; j++) {
+          x[j] += alpha * r[j];
+          r[j] -= alpha * Ar[j];
+        }
+      }
+
+      for (int i = 0; i < arg.block_volume; i++) {
+        for (int s = 0; s < Arg::nSpin; s++) {
+          for (int c = 0; c < Arg::nColor; c++)
+            arg.x(parity[i], x_cb[i], s, c) = arg.omega * x[(i * Arg::nSpin + s) * Arg::nColor + c];
+        }
+      }
+    }
+  };
+
+} // namespace quda
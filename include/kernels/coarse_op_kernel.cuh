@@ -421,6 +421,7 @@ namespace quda {
     using real = typename Arg::Float;
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr compute_uv(const Arg &arg) : arg(arg) { }
 
     /**
@@ -456,6 +457,7 @@ namespace quda {
     using real = typename Arg::Float;
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr compute_av(const Arg &arg) : arg(arg) { }
 
     /**
@@ -532,6 +534,7 @@ namespace quda {
     using real = typename Arg::Float;
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr compute_tmav(const Arg &arg) : arg(arg) { }
 
     /**
@@ -576,6 +579,7 @@ namespace quda {
     using real = typename Arg::Float;
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr compute_tmcav(const Arg &arg) : arg(arg) { }
 
     /**
@@ -1048,7 +1052,27 @@ namespace quda {
     }
   }
 
-  template <typename VUV, typename Arg>
+  /**
+     @brief Add a contribution to a coarse link element.  When the
+     element may be updated concurrently this is done atomically, else
+     with a plain read-modify-write (e.g., in the host aggregate kernels
+     where each thread owns its coarse site).
+     @tparam atomic Whether the update must be atomic
+     @param[in,out] Y The coarse link accessor
+     @param[in] val The contribution we are adding
+  */
+  template <bool atomic, typename Accessor, typename T>
+  __device__ __host__ inline void coarseLinkAdd(const Accessor &Y, int d, int parity, int x_cb, int s_row, int s_col,
+                                                int c_row, int c_col, const complex<T> &val)
+  {
+    IF_CONSTEXPR (atomic) {
+      Y.atomicAdd(d, parity, x_cb, s_row, s_col, c_row, c_col, val);
+    } else {
+      Y(d, parity, x_cb, s_row, s_col, c_row, c_col) += val;
+    }
+  }
+
+  template <bool atomic = true, typename VUV, typename Arg>
   inline __device__ __host__ void storeCoarseGlobalAtomic(VUV &vuv, bool isDiagonal, int coarse_x_cb, int coarse_parity, int i0, int j0, const Arg &arg)
   {
     using real = typename Arg::Float;
@@ -1065,7 +1089,7 @@ namespace quda {
           for (int i = 0; i < TileType::M; i++)
 #pragma unroll
             for (int j = 0; j < TileType::N; j++)
-              arg.X_atomic.atomicAdd(0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*Arg::coarseSpin+s_col](i,j));
+              coarseLinkAdd<atomic>(arg.X_atomic, 0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*Arg::coarseSpin+s_col](i,j));
         }
       }
     } else if (!isDiagonal) {
@@ -1077,7 +1101,7 @@ namespace quda {
           for (int i = 0; i < TileType::M; i++)
 #pragma unroll
             for (int j = 0; j < TileType::N; j++)
-              arg.Y_atomic.atomicAdd(dim_index,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*Arg::coarseSpin+s_col](i,j));
+              coarseLinkAdd<atomic>(arg.Y_atomic, dim_index,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*Arg::coarseSpin+s_col](i,j));
         }
       }
     } else {
@@ -1091,7 +1115,7 @@ namespace quda {
             for (int i = 0; i < TileType::M; i++)
 #pragma unroll
               for (int j = 0; j < TileType::N; j++)
-                arg.X_atomic.atomicAdd(0,coarse_parity,coarse_x_cb,s_col,s_row,j0+j,i0+i,conj(vuv[s_row*Arg::coarseSpin+s_col](i,j)));
+                coarseLinkAdd<atomic>(arg.X_atomic, 0,coarse_parity,coarse_x_cb,s_col,s_row,j0+j,i0+i,conj(vuv[s_row*Arg::coarseSpin+s_col](i,j)));
           }
         }
       } else {
@@ -1103,7 +1127,7 @@ namespace quda {
             for (int i = 0; i < TileType::M; i++)
 #pragma unroll
               for (int j = 0; j < TileType::N; j++)
-                arg.X_atomic.atomicAdd(0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*Arg::coarseSpin+s_col](i,j));
+                coarseLinkAdd<atomic>(arg.X_atomic, 0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*Arg::coarseSpin+s_col](i,j));
           }
         }
       }
@@ -1119,7 +1143,7 @@ namespace quda {
               for (int i = 0; i < TileType::M; i++)
 #pragma unroll
                 for (int j = 0; j < TileType::N; j++)
-                  arg.X_atomic.atomicAdd(0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*Arg::coarseSpin+s_col](i,j));
+                  coarseLinkAdd<atomic>(arg.X_atomic, 0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*Arg::coarseSpin+s_col](i,j));
             }
           }
         }
@@ -1128,7 +1152,7 @@ namespace quda {
 
   }
 
-  template <typename Arg>
+  template <bool atomic = true, typename Arg>
   __device__ __host__ void computeVUV(const Arg &arg, int parity, int x_cb, int i0, int j0, int parity_coarse_, int coarse_x_cb_)
   {
     using real = typename Arg::Float;
@@ -1164,7 +1188,7 @@ namespace quda {
     if (arg.shared_atomic)
       storeCoarseSharedAtomic(vuv, isDiagonal, coarse_x_cb, coarse_parity, i0, j0, parity, arg);
     else
-      storeCoarseGlobalAtomic(vuv, isDiagonal, coarse_x_cb, coarse_parity, i0, j0, arg);
+      storeCoarseGlobalAtomic<atomic>(vuv, isDiagonal, coarse_x_cb, coarse_parity, i0, j0, arg);
   }
 
   template <bool is_device> struct getIndices {
@@ -1250,6 +1274,74 @@ namespace quda {
     }
   };
 
+  /**
+     @brief Compute the contribution of the fine-grid clover term at a
+     given fine-grid site to the coarse clover term
+     @tparam atomic Whether the accumulation into the coarse clover must be atomic
+     @param[in] arg Kernel argument
+     @param[in] parity Fine grid parity
+     @param[in] x_cb Checkerboarded fine-grid site index
+     @param[in] c_row Coarse color row
+     @param[in] c_col Coarse color column
+  */
+  template <bool atomic = true, typename Arg>
+  __device__ __host__ inline void computeCoarseClover(const Arg &arg, int parity, int x_cb, int c_row, int c_col)
+  {
+    using real = typename Arg::Float;
+    constexpr int nDim = 4;
+
+    int coord[QUDA_MAX_DIM];
+    int coord_coarse[QUDA_MAX_DIM];
+
+    getCoords(coord, x_cb, arg.x_size, parity);
+    for (int d = 0; d < nDim; d++) coord_coarse[d] = coord[d]/arg.geo_bs[d];
+
+    int coarse_parity = 0;
+    for (int d = 0; d < nDim; d++) coarse_parity += coord_coarse[d];
+    coarse_parity &= 1;
+    coord_coarse[0] /= 2;
+    int coarse_x_cb = ((coord_coarse[3]*arg.xc_size[2]+coord_coarse[2])*arg.xc_size[1]+coord_coarse[1])*(arg.xc_size[0]/2) + coord_coarse[0];
+
+    coord[0] /= 2;
+
+    complex<real> X[Arg::coarseSpin * Arg::coarseSpin];
+    for (int i = 0; i < Arg::coarseSpin * Arg::coarseSpin; i++) X[i] = 0.0;
+
+    // If Nspin = 4, then the clover term has structure C_{\mu\nu} = \gamma_{\mu\nu}C^{\mu\nu}
+#pragma unroll
+    for (int chi = 0; chi < 2; chi++) {
+
+#pragma unroll
+      for (int s_row = 0; s_row < Arg::fineSpin / 2; s_row++) { // Loop over fine spin row within a chiral block
+        const int s_c = arg.spin_map(chi * Arg::fineSpin / 2 + s_row, parity);
+        // On the fine lattice, the clover field is chirally blocked, so loop over rows/columns
+        // in the same chiral block.
+#pragma unroll
+        for (int s_col = 0; s_col < Arg::fineSpin / 2; s_col++) { // Loop over fine spin column within a chiral block
+#pragma unroll
+          for (int ic = 0; ic < Arg::fineColor; ic++) { // Sum over fine color row
+            complex<real> CV = 0.0;
+#pragma unroll
+            for (int jc = 0; jc < Arg::fineColor; jc++) {  // Sum over fine color column
+              CV = cmac(arg.C(parity, x_cb, chi, s_row, s_col, ic, jc), arg.V(parity, x_cb, chi * Arg::fineSpin / 2 + s_col, jc, c_col), CV);
+            } // Fine color column
+            X[s_c * Arg::coarseSpin + s_c] =
+              cmac(conj(arg.V(parity, x_cb, chi * Arg::fineSpin / 2 + s_row, ic, c_row)), CV, X[s_c*Arg::coarseSpin + s_c]);
+          }  // Fine color row
+        }  // Fine spin column
+      } // Fine spin
+
+    }
+
+#pragma unroll
+    for (int si = 0; si < Arg::coarseSpin; si++) {
+#pragma unroll
+      for (int sj = 0; sj < Arg::coarseSpin; sj++) {
+        coarseLinkAdd<atomic>(arg.X_atomic, 0, coarse_parity, coarse_x_cb, si, sj, c_row, c_col, X[si*Arg::coarseSpin+sj]);
+      }
+    }
+  }
+
   template <typename Arg> struct compute_coarse_clover {
     static_assert(!Arg::from_coarse, "computeCoarseClover is only defined on the fine grid");
     const Arg &arg;
@@ -1264,61 +1356,94 @@ namespace quda {
     */
     __device__ __host__ inline void operator()(int x_cb, int parity_c_col, int c_row)
     {
-      using real = typename Arg::Float;
       int c_col = parity_c_col % Arg::coarseColor; // coarse color col index
       int parity = parity_c_col / Arg::coarseColor;
-      constexpr int nDim = 4;
-
-      int coord[QUDA_MAX_DIM];
-      int coord_coarse[QUDA_MAX_DIM];
-
-      getCoords(coord, x_cb, arg.x_size, parity);
-      for (int d = 0; d < nDim; d++) coord_coarse[d] = coord[d]/arg.geo_bs[d];
-
-      int coarse_parity = 0;
-      for (int d = 0; d < nDim; d++) coarse_parity += coord_coarse[d];
-      coarse_parity &= 1;
-      coord_coarse[0] /= 2;
-      int coarse_x_cb = ((coord_coarse[3]*arg.xc_size[2]+coord_coarse[2])*arg.xc_size[1]+coord_coarse[1])*(arg.xc_size[0]/2) + coord_coarse[0];
+      computeCoarseClover(arg, parity, x_cb, c_row, c_col);
+    }
+  };
 
-      coord[0] /= 2;
+  /**
+     @brief Helper that applies f(parity, x_cb) to each fine-grid
+     site of a given coarse aggregate, using the coarse-to-fine look-up
+     table (which is sorted by parity-ordered coarse index)
+     @param[in] arg Kernel argument
+     @param[in] x_coarse Parity-ordered coarse-grid site index
+     @param[in] f The function to apply
+  */
+  template <typename Arg, typename F> inline void forEachAggregateSite(const Arg &arg, int x_coarse, F &&f)
+  {
+    const int aggregate_size = arg.fineVolumeCB / arg.coarseVolumeCB;
+    for (int i = 0; i < aggregate_size; i++) {
+      int x_fine = arg.coarse_to_fine[x_coarse * aggregate_size + i];
+      int parity = x_fine >= arg.fineVolumeCB ? 1 : 0;
+      f(parity, x_fine - parity * arg.fineVolumeCB);
+    }
+  }
 
-      complex<real> X[Arg::coarseSpin * Arg::coarseSpin];
-      for (int i = 0; i < Arg::coarseSpin * Arg::coarseSpin; i++) X[i] = 0.0;
+  /**
+     Host-specialized fused UV and VUV computation.  Each coarse
+     aggregate is assigned to a single thread, which for each fine-grid
+     site of the aggregate computes the UV product and then immediately
+     the VUV product, so that UV is consumed while still resident in
+     cache.  All fine-grid sites of an aggregate contribute to the same
+     coarse site, so each thread owns its output and we accumulate into
+     the coarse links without atomics.
+  */
+  template <typename Arg> struct compute_uv_vuv_aggregate {
+    const Arg &arg;
+    static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
+    constexpr compute_uv_vuv_aggregate(const Arg &arg) : arg(arg) { }
 
-      // If Nspin = 4, then the clover term has structure C_{\mu\nu} = \gamma_{\mu\nu}C^{\mu\nu}
-#pragma unroll
-      for (int chi = 0; chi < 2; chi++) {
+    /**
+       @param[in] x_coarse Parity-ordered coarse-grid site index
+    */
+    __host__ void operator()(int x_coarse, int, int)
+    {
+      forEachAggregateSite(arg, x_coarse, [&](int parity, int x_cb) {
+        for (int ic = 0; ic < arg.uvTile.M_tiles; ic++) {
+          for (int jc = 0; jc < arg.uvTile.N_tiles; jc++) {
+            // only for preconditioned clover is V != AV, will need extra logic for staggered KD
+            if (arg.dir == QUDA_FORWARDS || arg.dir == QUDA_IN_PLACE)
+              computeUV(arg, arg.V, parity, x_cb, ic * arg.uvTile.M, jc * arg.uvTile.N);
+            else
+              computeUV(arg, arg.AV, parity, x_cb, ic * arg.uvTile.M, jc * arg.uvTile.N);
+          }
+        }
 
-#pragma unroll
-        for (int s_row = 0; s_row < Arg::fineSpin / 2; s_row++) { // Loop over fine spin row within a chiral block
-          const int s_c = arg.spin_map(chi * Arg::fineSpin / 2 + s_row, parity);
-          // On the fine lattice, the clover field is chirally blocked, so loop over rows/columns
-          // in the same chiral block.
-#pragma unroll
-          for (int s_col = 0; s_col < Arg::fineSpin / 2; s_col++) { // Loop over fine spin column within a chiral block
-#pragma unroll
-            for (int ic = 0; ic < Arg::fineColor; ic++) { // Sum over fine color row
-              complex<real> CV = 0.0;
-#pragma unroll
-              for (int jc = 0; jc < Arg::fineColor; jc++) {  // Sum over fine color column
-                CV = cmac(arg.C(parity, x_cb, chi, s_row, s_col, ic, jc), arg.V(parity, x_cb, chi * Arg::fineSpin / 2 + s_col, jc, c_col), CV);
-              } // Fine color column
-              X[s_c * Arg::coarseSpin + s_c] =
-                cmac(conj(arg.V(parity, x_cb, chi * Arg::fineSpin / 2 + s_row, ic, c_row)), CV, X[s_c*Arg::coarseSpin + s_c]);
-            }  // Fine color row
-          }  // Fine spin column
-        } // Fine spin
+        for (int c_row = 0; c_row < arg.vuvTile.M_tiles; c_row++) {
+          for (int c_col = 0; c_col < arg.vuvTile.N_tiles; c_col++) {
+            computeVUV<false>(arg, parity, x_cb, c_row * arg.vuvTile.M, c_col * arg.vuvTile.N, 0, 0);
+          }
+        }
+      });
+    }
+  };
 
-      }
+  /**
+     Host-specialized coarse clover computation, where each coarse
+     aggregate is assigned to a single thread which then accumulates
+     into its coarse clover term without atomics.
+  */
+  template <typename Arg> struct compute_coarse_clover_aggregate {
+    static_assert(!Arg::from_coarse, "computeCoarseClover is only defined on the fine grid");
+    const Arg &arg;
+    static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
+    constexpr compute_coarse_clover_aggregate(const Arg &arg) : arg(arg) { }
 
-#pragma unroll
-      for (int si = 0; si < Arg::coarseSpin; si++) {
-#pragma unroll
-        for (int sj = 0; sj < Arg::coarseSpin; sj++) {
-          arg.X_atomic.atomicAdd(0, coarse_parity, coarse_x_cb, si, sj, c_row, c_col, X[si*Arg::coarseSpin+sj]);
+    /**
+       @param[in] x_coarse Parity-ordered coarse-grid site index
+    */
+    __host__ void operator()(int x_coarse, int, int)
+    {
+      forEachAggregateSite(arg, x_coarse, [&](int parity, int x_cb) {
+        for (int c_col = 0; c_col < Arg::coarseColor; c_col++) {
+          for (int c_row = 0; c_row < Arg::coarseColor; c_row++) {
+            computeCoarseClover<false>(arg, parity, x_cb, c_row, c_col);
+          }
         }
-      }
+      });
     }
   };
 
@@ -1330,6 +1455,7 @@ namespace quda {
   template <typename Arg> struct reverse {
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr reverse(const Arg &arg) : arg(arg) { }
 
     /**
@@ -1367,6 +1493,7 @@ namespace quda {
     using real = typename Arg::Float;
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr add_coarse_diagonal(const Arg &arg) : arg(arg) { }
 
     /**
@@ -1390,6 +1517,7 @@ namespace quda {
     using real = typename Arg::Float;
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr add_coarse_staggered_mass(const Arg &arg) : arg(arg) { }
 
     /**
@@ -1414,6 +1542,7 @@ namespace quda {
     using real = typename Arg::Float;
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr add_coarse_tm(const Arg &arg) : arg(arg) { }
 
     /**
@@ -1442,6 +1571,7 @@ namespace quda {
     using real = typename Arg::Float;
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr convert(const Arg &arg) : arg(arg) { }
 
     /**
@@ -1492,6 +1622,7 @@ namespace quda {
     using real = typename Arg::Float;
     const Arg &arg;
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true;
     constexpr rescale(const Arg &arg) : arg(arg) { }
 
     /**
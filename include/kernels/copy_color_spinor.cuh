@@ -117,6 +117,7 @@ namespace quda {
     const Arg &arg;
     constexpr CopyColorSpinor_(const Arg &arg): arg(arg) {}
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true; // each site is written independently
 
     __device__ __host__ inline void operator()(int x_cb, int parity)
     {
@@ -7,6 +7,20 @@
 namespace quda
 {
 
+  /**
+     @brief Element type for coarse link fields, whose site matrices
+     are too large to be held in registers, so they are copied one
+     element at a time through the accessor
+  */
+  template <int nColor_> struct CoarseLinkElement {
+    static constexpr int nColor = nColor_;
+  };
+
+  template <class T> struct is_coarse_link : std::false_type {
+  };
+  template <int nColor> struct is_coarse_link<CoarseLinkElement<nColor>> : std::true_type {
+  };
+
   template <class Field_, class Element_, class Accessor_, QudaPCType pc_type_ = QUDA_4D_PC>
   struct CopyFieldOffsetArg : kernel_param<> {
 
@@ -113,7 +127,8 @@ namespace quda
   }
 
   template <class Arg>
-  __device__ __host__ inline typename std::enable_if<std::is_same<typename Arg::Field, GaugeField>::value, void>::type
+  __device__ __host__ inline typename std::enable_if<
+    std::is_same<typename Arg::Field, GaugeField>::value && !is_coarse_link<typename Arg::Element>::value, void>::type
   copy_field(int out, int in, int parity, const Arg &arg)
   {
     using Element = typename Arg::Element;
@@ -124,6 +139,19 @@ namespace quda
     }
   }
 
+  template <class Arg>
+  __device__ __host__ inline typename std::enable_if<
+    std::is_same<typename Arg::Field, GaugeField>::value && is_coarse_link<typename Arg::Element>::value, void>::type
+  copy_field(int out, int in, int parity, const Arg &arg)
+  {
+    constexpr int nColor = Arg::Element::nColor;
+    for (int d = 0; d < arg.in.geometry; d++) {
+      for (int i = 0; i < nColor; i++) {
+        for (int j = 0; j < nColor; j++) { arg.out(d, parity, out, i, j) = arg.in(d, parity, in, i, j); }
+      }
+    }
+  }
+
   template <typename Arg> struct copy_field_offset
   {
     const Arg &arg;
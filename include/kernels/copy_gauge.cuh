@@ -75,6 +75,7 @@ namespace quda {
     const Arg &arg;
     constexpr CopyGauge_(const Arg &arg) : arg(arg) {}
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true; // each site is written independently
 
     __device__ __host__ inline void operator()(int x, int, int parity_d)
     {
@@ -94,6 +95,7 @@ namespace quda {
     const Arg &arg;
     constexpr CopyGaugeFineGrained_(const Arg &arg) :arg(arg) {}
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true; // each site is written independently
 
     __device__ __host__ inline void operator()(int x, int i, int parity_d)
     {
@@ -111,6 +113,7 @@ namespace quda {
     const Arg &arg;
     constexpr CopyGhost_(const Arg &arg) : arg(arg) {}
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true; // each site is written independently
 
     __device__ __host__ inline void operator()(int x, int, int parity_d)
     {
@@ -133,6 +136,7 @@ namespace quda {
     const Arg &arg;
     constexpr CopyGhostFineGrained_(const Arg &arg) :arg(arg) {}
     static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true; // each site is written independently
 
     __device__ __host__ inline void operator()(int x, int i, int parity_d)
     {
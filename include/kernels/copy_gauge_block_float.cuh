@@ -0,0 +1,56 @@
+#include <gauge_field_order.h>
+#include <kernel.h>
+
+namespace quda
+{
+
+  template <typename storeFloat, typename inFloat, int nColor_> struct CopyGaugeBlockFloatArg : kernel_param<> {
+    using real = float;
+    static constexpr int nColor = nColor_;
+    using Out = gauge::FieldOrder<real, nColor, 1, QUDA_FLOAT2_GAUGE_ORDER, true, storeFloat, true>;
+    using In = gauge::FieldOrder<real, nColor, 1, QUDA_FLOAT2_GAUGE_ORDER, true, inFloat>;
+
+    Out out;
+    const In in;
+
+    CopyGaugeBlockFloatArg(GaugeField &out, const GaugeField &in) :
+      kernel_param(dim3(in.Stride(), 2, in.Geometry())), out(out), in(in)
+    {
+    }
+  };
+
+  /**
+     Compresses each link matrix, including those in the ghost zone
+     held in the pad, by first finding its maximum absolute element,
+     which sets the scale factor of that matrix, and then storing the
+     elements normalized by it.
+  */
+  template <typename Arg> struct CopyGaugeBlockFloat {
+    const Arg &arg;
+    constexpr CopyGaugeBlockFloat(const Arg &arg) : arg(arg) { }
+    static constexpr const char *filename() { return KERNEL_FILE; }
+    static constexpr bool host_parallel = true; // each matrix is written independently
+
+    __device__ __host__ inline void operator()(int x_cb, int parity, int d)
+    {
+      using real = typename Arg::real;
+      real max = 0.0;
+      for (int i = 0; i < Arg::nColor; i++) {
+        for (int j = 0; j < Arg::nColor; j++) {
+          complex<real> u = arg.in(d, parity, x_cb, i, j);
+          max = fmax(max, fmax(fabs(u.real()), fabs(u.imag())));
+        }
+      }
+
+      arg.out.accessor.set_max(d, parity, x_cb, max);
+
+      for (int i = 0; i < Arg::nColor; i++) {
+        for (int j = 0; j < Arg::nColor; j++) {
+          complex<real> u = arg.in(d, parity, x_cb, i, j);
+          arg.out(d, parity, x_cb, i, j) = u;
+        }
+      }
+    }
+  };
+
+} // namespace quda
@@ -36,6 +36,7 @@ namespace quda {
     const int parity;     // which parity we're acting on (if nParity=1)
     bool doublet;         // whether we applying the operator to a doublet
     const int volumeCB;   // checkerboarded volume
+    const int_fastdiv volume_4d_cb; // checkerboarded 4-d volume (multi-RHS fields share the clover term)
     real a;
     real b;
     real c;
@@ -49,7 +50,8 @@ namespace quda {
       cloverInv(clover, !dynamic_clover), // only inverse if !dynamic
       nParity(in.SiteSubset()), parity(parity),
       doublet(in.TwistFlavor() == QUDA_TWIST_DEG_DOUBLET || in.TwistFlavor() == QUDA_TWIST_NONDEG_DOUBLET),
-      volumeCB(doublet ? in.VolumeCB()/2 : in.VolumeCB()), a(0.0), b(0.0), c(0.0), twist(twist)
+      volumeCB(doublet ? in.VolumeCB()/2 : in.VolumeCB()), volume_4d_cb(in.getDslashConstant().volume_4d_cb),
+      a(0.0), b(0.0), c(0.0), twist(twist)
     {
       checkPrecision(out, in, clover);
       checkLocation(out, in, clover);
@@ -92,7 +94,7 @@ namespace quda {
 
 #pragma unroll
       for (int chirality=0; chirality<2; chirality++) {
-        HMatrix<real, N> A = arg.clover(x_cb, clover_parity, chirality);
+        HMatrix<real, N> A = arg.clover(x_cb % arg.volume_4d_cb, clover_parity, chirality);
         half_fermion chi = in.chiral_project(chirality);
 
         if (arg.dynamic_clover && arg.inverse) {
@@ -18,7 +18,8 @@ namespace quda {
   constexpr int colors_per_thread(int nColor, int dim_stride) { return (nColor % 2 == 0 && nColor <= 32 && dim_stride <= 2) ? 2 : 1; }
 
   template <bool dslash_, bool clover_, bool dagger_, DslashType type_, int color_stride_, int dim_stride_, typename Float,
-            typename yFloat, typename ghostFloat, int nSpin_, int nColor_, QudaFieldOrder csOrder, QudaGaugeFieldOrder gOrder>
+            typename yFloat, typename ghostFloat, int nSpin_, int nColor_, QudaFieldOrder csOrder, QudaGaugeFieldOrder gOrder,
+            bool block_float = false>
   struct DslashCoarseArg : kernel_param<> {
     static constexpr bool dslash = dslash_;
     static constexpr bool clover = clover_;
@@ -33,8 +34,8 @@ namespace quda {
     static constexpr int nDim = 4;
 
     using F = typename colorspinor::FieldOrderCB<real, nSpin, nColor, 1, csOrder, Float, ghostFloat>;
-    using G = typename gauge::FieldOrder<real, nColor * nSpin, nSpin, gOrder, true, yFloat>;
-    using GY = typename gauge::FieldOrder<real, nColor * nSpin, nSpin, gOrder, true, yFloat>;
+    using G = typename gauge::FieldOrder<real, nColor * nSpin, nSpin, gOrder, true, yFloat, block_float>;
+    using GY = typename gauge::FieldOrder<real, nColor * nSpin, nSpin, gOrder, true, yFloat, block_float>;
 
     F out;
     const F inA;
@@ -104,7 +105,7 @@ namespace quda {
      @param out The result vector
      @param thread_dir Direction
      @param x_cb The checkerboarded site index
-     @param src_idx dummy for now
+     @param src_idx Which right-hand side of a multi-RHS field we are acting on
      @param parity The site parity
      @param s_row Which spin row are acting on
      @param color_block Which color row are we acting on
@@ -143,10 +144,10 @@ namespace quda {
 		  int col = s_col * Arg::nColor + c_col + color_offset;
 		  if (!Arg::dagger)
                     out[color_local] = cmac(arg.Y(d+4, parity, x_cb, row, col),
-                                            arg.inA.Ghost(d, 1, their_spinor_parity, ghost_idx + src_idx*arg.volumeCB, s_col, c_col+color_offset), out[color_local]);
+                                            arg.inA.Ghost(d, 1, their_spinor_parity, ghost_idx, s_col, c_col+color_offset), out[color_local]);
 		  else
 		    out[color_local] = cmac(arg.Y(d, parity, x_cb, row, col),
-                                            arg.inA.Ghost(d, 1, their_spinor_parity, ghost_idx + src_idx*arg.volumeCB, s_col, c_col+color_offset), out[color_local]);
+                                            arg.inA.Ghost(d, 1, their_spinor_parity, ghost_idx, s_col, c_col+color_offset), out[color_local]);
 		}
 	      }
 	    }
@@ -197,10 +198,10 @@ namespace quda {
 		  int col = s_col * Arg::nColor + c_col + color_offset;
 		  if (!Arg::dagger)
 		    out[color_local] = cmac(conj(arg.Y.Ghost(d, 1-parity, ghost_idx, col, row)),
-                                            arg.inA.Ghost(d, 0, their_spinor_parity, ghost_idx + src_idx*arg.volumeCB, s_col, c_col+color_offset), out[color_local]);
+                                            arg.inA.Ghost(d, 0, their_spinor_parity, ghost_idx, s_col, c_col+color_offset), out[color_local]);
 		  else
 		    out[color_local] = cmac(conj(arg.Y.Ghost(d+4, 1-parity, ghost_idx, col, row)),
-                                            arg.inA.Ghost(d, 0, their_spinor_parity, ghost_idx + src_idx*arg.volumeCB, s_col, c_col+color_offset), out[color_local]);
+                                            arg.inA.Ghost(d, 0, their_spinor_parity, ghost_idx, s_col, c_col+color_offset), out[color_local]);
 		}
 	    }
 	  }
@@ -317,7 +318,10 @@ namespace quda {
         color_offset = lane_id / vector_site_width;
       }
 
-      parity = (arg.nParity == 2) ? parity : arg.parity;
+      // y thread dimension is src_idx*nParity + parity, where src_idx
+      // indexes the right-hand side of a multi-RHS field
+      const int src_idx = parity / arg.nParity;
+      parity = (arg.nParity == 2) ? parity % 2 : arg.parity;
 
       // z thread dimension is (( s*(Nc/Mc) + color_block )*dim_thread_split + dim)*2 + dir
       constexpr int Mc = colors_per_thread(Arg::nColor, Arg::dim_stride);
@@ -328,7 +332,6 @@ namespace quda {
       int s = sM / (Arg::nColor/Mc);
       int color_block = (sM % (Arg::nColor/Mc)) * Mc;
 
-      constexpr int src_idx = 0;
       array<complex <typename Arg::real>, Mc> out{ };
 
       if (Arg::dslash) {
@@ -207,11 +207,11 @@ namespace quda
     if (face_num == 0) { // backwards
       int idx = indexFromFaceIndexStaggered<4, QUDA_4D_PC, dim, nFace, 0>(ghost_idx, parity, arg);
       Vector f = arg.in_pack(idx + s * arg.dc.volume_4d_cb, spinor_parity);
-      arg.in_pack.Ghost(dim, 0, ghost_idx + s * arg.dc.ghostFaceCB[dim], spinor_parity) = f;
+      arg.in_pack.Ghost(dim, 0, ghost_idx + s * nFace * arg.dc.ghostFaceCB[dim], spinor_parity) = f;
     } else { // forwards
       int idx = indexFromFaceIndexStaggered<4, QUDA_4D_PC, dim, nFace, 1>(ghost_idx, parity, arg);
       Vector f = arg.in_pack(idx + s * arg.dc.volume_4d_cb, spinor_parity);
-      arg.in_pack.Ghost(dim, 1, ghost_idx + s * arg.dc.ghostFaceCB[dim], spinor_parity) = f;
+      arg.in_pack.Ghost(dim, 1, ghost_idx + s * nFace * arg.dc.ghostFaceCB[dim], spinor_parity) = f;
     }
   }
 
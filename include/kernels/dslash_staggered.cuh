@@ -91,9 +91,12 @@ namespace quda
     typedef typename mapper<typename Arg::Float>::type real;
     typedef Matrix<complex<real>, Arg::nColor> Link;
     const int their_spinor_parity = (arg.nParity == 2) ? 1 - parity : 0;
+    // offset of this right-hand side for multi-RHS fields
+    const int s_offset = coord.s * arg.dc.volume_4d_cb;
 
 #pragma unroll
     for (int d = 0; d < 4; d++) { // loop over dimension
+      const int ghost_offset = coord.s * arg.nFace * arg.dc.ghostFaceCB[d];
 
       // standard - forward direction
       {
@@ -101,12 +104,12 @@ namespace quda
         if (doHalo<kernel_type>(d) && ghost) {
           const int ghost_idx = ghostFaceIndexStaggered<1>(coord, arg.dim, d, 1);
           const Link U = arg.improved ? arg.U(d, coord.x_cb, parity) : arg.U(d, coord.x_cb, parity, StaggeredPhase(coord, d, +1, arg));
-          Vector in = arg.in.Ghost(d, 1, ghost_idx, their_spinor_parity);
+          Vector in = arg.in.Ghost(d, 1, ghost_idx + ghost_offset, their_spinor_parity);
           out = mv_add(U, in, out);
         } else if (doBulk<kernel_type>() && !ghost) {
           const int fwd_idx = linkIndexP1(coord, arg.dim, d);
           const Link U = arg.improved ? arg.U(d, coord.x_cb, parity) : arg.U(d, coord.x_cb, parity, StaggeredPhase(coord, d, +1, arg));
-          Vector in = arg.in(fwd_idx, their_spinor_parity);
+          Vector in = arg.in(fwd_idx + s_offset, their_spinor_parity);
           out = mv_add(U, in, out);
         }
       }
@@ -117,12 +120,12 @@ namespace quda
         if (doHalo<kernel_type>(d) && ghost) {
           const int ghost_idx = ghostFaceIndexStaggered<1>(coord, arg.dim, d, arg.nFace);
           const Link L = arg.L(d, coord.x_cb, parity);
-          const Vector in = arg.in.Ghost(d, 1, ghost_idx, their_spinor_parity);
+          const Vector in = arg.in.Ghost(d, 1, ghost_idx + ghost_offset, their_spinor_parity);
           out = mv_add(L, in, out);
         } else if (doBulk<kernel_type>() && !ghost) {
           const int fwd3_idx = linkIndexP3(coord, arg.dim, d);
           const Link L = arg.L(d, coord.x_cb, parity);
-          const Vector in = arg.in(fwd3_idx, their_spinor_parity);
+          const Vector in = arg.in(fwd3_idx + s_offset, their_spinor_parity);
           out = mv_add(L, in, out);
         }
       }
@@ -136,14 +139,14 @@ namespace quda
           const int ghost_idx = arg.improved ? ghostFaceIndexStaggered<0>(coord, arg.dim, d, 3) : ghost_idx2;
           const Link U = arg.improved ? arg.U.Ghost(d, ghost_idx2, 1 - parity) :
             arg.U.Ghost(d, ghost_idx2, 1 - parity, StaggeredPhase(coord, d, -1, arg));
-          Vector in = arg.in.Ghost(d, 0, ghost_idx, their_spinor_parity);
+          Vector in = arg.in.Ghost(d, 0, ghost_idx + ghost_offset, their_spinor_parity);
           out = mv_add(conj(U), -in, out);
         } else if (doBulk<kernel_type>() && !ghost) {
           const int back_idx = linkIndexM1(coord, arg.dim, d);
           const int gauge_idx = back_idx;
           const Link U = arg.improved ? arg.U(d, gauge_idx, 1 - parity) :
             arg.U(d, gauge_idx, 1 - parity, StaggeredPhase(coord, d, -1, arg));
-          Vector in = arg.in(back_idx, their_spinor_parity);
+          Vector in = arg.in(back_idx + s_offset, their_spinor_parity);
           out = mv_add(conj(U), -in, out);
         }
       }
@@ -155,13 +158,13 @@ namespace quda
           // when updating replace arg.nFace with 1 here
           const int ghost_idx = ghostFaceIndexStaggered<0>(coord, arg.dim, d, 1);
           const Link L = arg.L.Ghost(d, ghost_idx, 1 - parity);
-          const Vector in = arg.in.Ghost(d, 0, ghost_idx, their_spinor_parity);
+          const Vector in = arg.in.Ghost(d, 0, ghost_idx + ghost_offset, their_spinor_parity);
           out = mv_add(conj(L), -in, out);
         } else if (doBulk<kernel_type>() && !ghost) {
           const int back3_idx = linkIndexM3(coord, arg.dim, d);
           const int gauge_idx = back3_idx;
           const Link L = arg.L(d, gauge_idx, 1 - parity);
-          const Vector in = arg.in(back3_idx, their_spinor_parity);
+          const Vector in = arg.in(back3_idx + s_offset, their_spinor_parity);
           out = mv_add(conj(L), -in, out);
         }
       }
@@ -189,6 +192,7 @@ namespace quda
                                   getCoords<QUDA_4D_PC, mykernel_type, Arg, 1>(arg, idx, s, parity, thread_dim);
 
       const int my_spinor_parity = nParity == 2 ? parity : 0;
+      const int xs = coord.x_cb + coord.s * arg.dc.volume_4d_cb;
 
       Vector out;
 
@@ -197,13 +201,13 @@ namespace quda
       out *= arg.dagger_scale;
 
       if (xpay && mykernel_type == INTERIOR_KERNEL) {
-        Vector x = arg.x(coord.x_cb, my_spinor_parity);
+        Vector x = arg.x(xs, my_spinor_parity);
         out = arg.a * x - out;
       } else if (mykernel_type != INTERIOR_KERNEL) {
-        Vector x = arg.out(coord.x_cb, my_spinor_parity);
+        Vector x = arg.out(xs, my_spinor_parity);
         out = x + (xpay ? -out : out);
       }
-      if (mykernel_type != EXTERIOR_KERNEL_ALL || active) arg.out(coord.x_cb, my_spinor_parity) = out;
+      if (mykernel_type != EXTERIOR_KERNEL_ALL || active) arg.out(xs, my_spinor_parity) = out;
     }
   };
 
@@ -30,10 +30,11 @@ namespace quda
     /**
        @brief Apply the twisted-mass dslash
        out(x) = M*in = a * D * in + (1 + i*b*gamma_5)*x
-       Note this routine only exists in xpay form.
+       Note this routine only exists in xpay form.  For multi-RHS
+       fields s indexes the right-hand side.
     */
     template <KernelType mykernel_type = kernel_type>
-    __device__ __host__ __forceinline__ void operator()(int idx, int, int parity)
+    __device__ __host__ __forceinline__ void operator()(int idx, int s, int parity)
     {
       typedef typename mapper<typename Arg::Float>::type real;
       typedef ColorSpinor<real, Arg::nColor, 4> Vector;
@@ -41,24 +42,25 @@ namespace quda
       bool active
         = mykernel_type == EXTERIOR_KERNEL_ALL ? false : true; // is thread active (non-trival for fused kernel only)
       int thread_dim;                                        // which dimension is thread working on (fused kernel only)
-      auto coord = getCoords<QUDA_4D_PC, mykernel_type>(arg, idx, 0, parity, thread_dim);
+      auto coord = getCoords<QUDA_4D_PC, mykernel_type>(arg, idx, s, parity, thread_dim);
 
       const int my_spinor_parity = nParity == 2 ? parity : 0;
+      const int xs = coord.x_cb + coord.s * arg.dc.volume_4d_cb;
       Vector out;
 
       // defined in dslash_wilson.cuh
       applyWilson<nParity, dagger, mykernel_type>(out, arg, coord, parity, idx, thread_dim, active);
 
       if (mykernel_type == INTERIOR_KERNEL) {
-        Vector x = arg.x(coord.x_cb, my_spinor_parity);
+        Vector x = arg.x(xs, my_spinor_parity);
         x += arg.b * x.igamma(4);
         out = x + arg.a * out;
       } else if (active) {
-        Vector x = arg.out(coord.x_cb, my_spinor_parity);
+        Vector x = arg.out(xs, my_spinor_parity);
         out = x + arg.a * out;
       }
 
-      if (mykernel_type != EXTERIOR_KERNEL_ALL || active) arg.out(coord.x_cb, my_spinor_parity) = out;
+      if (mykernel_type != EXTERIOR_KERNEL_ALL || active) arg.out(xs, my_spinor_parity) = out;
     }
   };
 
@@ -41,9 +41,10 @@ namespace quda
        @brief Apply the clover preconditioned Wilson dslash
        - no xpay: out(x) = M*in = A(x)^{-1}D * in(x-mu)
        - with xpay:  out(x) = M*in = (1 - kappa*A(x)^{-1}D) * in(x-mu)
+       For multi-RHS fields s indexes the right-hand side.
     */
     template <KernelType mykernel_type = kernel_type>
-    __device__ __host__ __forceinline__ void operator()(int idx, int, int parity)
+    __device__ __host__ __forceinline__ void operator()(int idx, int s, int parity)
     {
       using namespace linalg; // for Cholesky
       typedef typename mapper<typename Arg::Float>::type real;
@@ -53,9 +54,10 @@ namespace quda
       bool active
         = mykernel_type == EXTERIOR_KERNEL_ALL ? false : true; // is thread active (non-trival for fused kernel only)
       int thread_dim;                                        // which dimension is thread working on (fused kernel only)
-      auto coord = getCoords<QUDA_4D_PC, mykernel_type>(arg, idx, 0, parity, thread_dim);
+      auto coord = getCoords<QUDA_4D_PC, mykernel_type>(arg, idx, s, parity, thread_dim);
 
       const int my_spinor_parity = nParity == 2 ? parity : 0;
+      const int xs = coord.x_cb + coord.s * arg.dc.volume_4d_cb;
 
       Vector out;
 
@@ -64,7 +66,7 @@ namespace quda
 
       if (mykernel_type != INTERIOR_KERNEL && active) {
         // if we're not the interior kernel, then we must sum the partial
-        Vector x = arg.out(coord.x_cb, my_spinor_parity);
+        Vector x = arg.out(xs, my_spinor_parity);
         out += x;
       }
 
@@ -92,14 +94,14 @@ namespace quda
         tmp.toNonRel(); // switch back to non-chiral basis
 
         if (xpay) {
-          Vector x = arg.x(coord.x_cb, my_spinor_parity);
+          Vector x = arg.x(xs, my_spinor_parity);
           out = x + arg.a * tmp;
         } else {
           out = tmp;
         }
       }
 
-      if (mykernel_type != EXTERIOR_KERNEL_ALL || active) arg.out(coord.x_cb, my_spinor_parity) = out;
+      if (mykernel_type != EXTERIOR_KERNEL_ALL || active) arg.out(xs, my_spinor_parity) = out;
     }
   };
 
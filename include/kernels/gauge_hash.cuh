@@ -0,0 +1,81 @@
+#pragma once
+
+#include <gauge_field_order.h>
+#include <quda_matrix.h>
+#include <array.h>
+#include <reduction_kernel.h>
+
+namespace quda {
+
+  /**
+     The 64-bit hash of each link is split into n_hash_word 16-bit
+     words that are summed separately.  Each sum is an integer below
+     2^53, so it is exact in double precision and independent of the
+     order of the reduction.
+  */
+  constexpr int n_hash_word = 4;
+  using hash_t = array<double, n_hash_word>;
+
+  template <typename Float_, int nColor_, QudaReconstructType recon_>
+  struct GaugeHashArg : public ReduceArg<hash_t> {
+    using reduce_t = hash_t;
+    using Float = Float_;
+    using real = typename mapper<Float>::type;
+    static constexpr int nColor = nColor_;
+    static constexpr QudaReconstructType recon = recon_;
+    typedef typename gauge_mapper<Float,recon>::type Gauge;
+
+    Gauge U;
+    const uint64_t volumeCB;
+    const uint64_t geometry;
+    const uint64_t rank;
+
+    GaugeHashArg(const GaugeField &U_) :
+      ReduceArg<reduce_t>(dim3(U_.VolumeCB(), 1, 1)),
+      U(U_),
+      volumeCB(U_.VolumeCB()),
+      geometry(U_.Geometry()),
+      rank(comm_rank())
+    {
+    }
+
+    __device__ __host__ reduce_t init() const { return reduce_t{0, 0, 0, 0}; }
+  };
+
+  /**
+     @brief Scramble a 64-bit word (the splitmix64 finalizer)
+  */
+  __device__ __host__ inline uint64_t linkHashMix(uint64_t h)
+  {
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+    return h ^ (h >> 31);
+  }
+
+  template <typename Arg> struct LinkHash : plus<hash_t> {
+    using reduce_t = hash_t;
+    using plus<reduce_t>::operator();
+    const Arg &arg;
+    constexpr LinkHash(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    // return the hash words of the links at site (x_cb, parity)
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int x_cb, int parity)
+    {
+      reduce_t hash{0, 0, 0, 0};
+
+      for (uint64_t d = 0; d < arg.geometry; d++) {
+        const Matrix<complex<typename Arg::real>, Arg::nColor> u = arg.U(d, x_cb, parity);
+        // the link position is mixed in, so that permuted links change the hash
+        const uint64_t index = ((arg.rank * 2 + parity) * arg.volumeCB + x_cb) * arg.geometry + d;
+        const uint64_t h = linkHashMix(u.checksum() ^ linkHashMix(index));
+#pragma unroll
+        for (int i = 0; i < n_hash_word; i++) hash[i] += static_cast<double>((h >> (16 * i)) & 0xffff);
+      }
+
+      return plus::operator()(hash, value);
+    }
+
+  };
+
+} // namespace quda
@@ -29,11 +29,13 @@ namespace quda {
     const spin_mapper<fineSpin,coarseSpin> spin_map;
     const int parity; // the parity of the output field (if single parity)
     const int nParity; // number of parities of input fine field
+    const bool accumulate; // whether we are adding the prolongated field to out
 
     ProlongateArg(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField &V,
-                  const int *geo_map,  const int parity) :
+                  const int *geo_map,  const int parity, bool accumulate = false) :
       kernel_param(dim3(out.VolumeCB(), out.SiteSubset(), fineColor/fine_colors_per_thread<fineColor, coarseColor>())),
-      out(out), in(in), V(V), geo_map(geo_map), spin_map(), parity(parity), nParity(out.SiteSubset())
+      out(out), in(in), V(V), geo_map(geo_map), spin_map(), parity(parity), nParity(out.SiteSubset()),
+      accumulate(accumulate)
     { }
   };
 
@@ -90,6 +92,10 @@ namespace quda {
 
 #pragma unroll
         for (int k=1; k<color_unroll; k++) partial[0] += partial[k];
+        if (arg.accumulate) {
+          complex<typename Arg::real> out = arg.out(spinor_parity, x_cb, s, i);
+          partial[0] += out;
+        }
         arg.out(spinor_parity, x_cb, s, i) = partial[0];
       }
     }
@@ -32,6 +32,7 @@ namespace quda {
 
     FieldOrderCB<Float,coarseSpin,coarseColor,1,order> out;
     const FieldOrderCB<Float,fineSpin,fineColor,1,order> in;
+    const FieldOrderCB<Float,fineSpin,fineColor,1,order> sub; // subtracted from in when forming the residual
     const FieldOrderCB<Float,fineSpin,fineColor,coarseColor,order,vFloat> V;
     const int aggregate_size;    // number of sites that form a single aggregate
     const int aggregate_size_cb; // number of checkerboard sites that form a single aggregate
@@ -40,6 +41,7 @@ namespace quda {
     const spin_mapper<fineSpin,coarseSpin> spin_map;
     const int parity; // the parity of the input field (if single parity)
     const int nParity; // number of parities of input fine field
+    const bool residual; // whether we are restricting in - sub
 
     // enabling CTA swizzling improves spatial locality of MG blocks reducing cache line wastage
     static constexpr bool swizzle = true;
@@ -53,14 +55,28 @@ namespace quda {
     dim3 block_dim;
 
     RestrictArg(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField &V,
-		const int *fine_to_coarse, const int *coarse_to_fine, int parity) :
+		const int *fine_to_coarse, const int *coarse_to_fine, int parity, const ColorSpinorField *sub = nullptr) :
       kernel_param(dim3(in.Volume()/out.Volume(), coarseColor/coarse_colors_per_thread<fineColor, coarseColor>(), 1)),
-      out(out), in(in), V(V),
+      out(out), in(in), sub(sub ? *sub : in), V(V),
       aggregate_size(in.Volume()/out.Volume()),
       aggregate_size_cb(in.VolumeCB()/out.Volume()),
       fine_to_coarse(fine_to_coarse), coarse_to_fine(coarse_to_fine),
-      spin_map(), parity(parity), nParity(in.SiteSubset()), swizzle_factor(1)
+      spin_map(), parity(parity), nParity(in.SiteSubset()), residual(sub), swizzle_factor(1)
     { }
+
+    /**
+       @brief Load an element of the fine field being restricted,
+       forming the residual in - sub on the fly if requested
+    */
+    __device__ __host__ inline complex<real> fine(int parity, int x_cb, int s, int c) const
+    {
+      complex<real> x = in(parity, x_cb, s, c);
+      if (residual) {
+        complex<real> y = sub(parity, x_cb, s, c);
+        x -= y;
+      }
+      return x;
+    }
   };
 
   /**
@@ -96,7 +112,7 @@ namespace quda {
 	for (int j=0; j<Arg::fineColor; j+=color_unroll) {
 #pragma unroll
 	  for (int k=0; k<color_unroll; k++)
-	    partial[k] = cmac(conj(arg.V(v_parity, x_cb, s, j+k, i)), arg.in(spinor_parity, x_cb, s, j+k), partial[k]);
+	    partial[k] = cmac(conj(arg.V(v_parity, x_cb, s, j+k, i)), arg.fine(spinor_parity, x_cb, s, j+k), partial[k]);
 	}
 
 #pragma unroll
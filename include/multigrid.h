@@ -2,8 +2,11 @@
 
 #include <invert_quda.h>
 #include <transfer.h>
+#include <worker.h>
 #include <vector>
+#include <thread>
 #include <complex_quda.h>
+#include <quda_api.h>
 
 // at the moment double-precision multigrid is only enabled when debugging
 #ifdef HOST_DEBUG
@@ -107,6 +110,9 @@ namespace quda {
     /** Whether to use tensor cores (if available) */
     bool use_mma;
 
+    /** Whether to restore the hierarchy from a checkpoint rather than computing it */
+    bool restore_hierarchy;
+
     /**
        This is top level instantiation done when we start creating the multigrid operator.
      */
@@ -135,7 +141,8 @@ namespace quda {
       location(param.location[level]),
       setup_location(param.setup_location[level]),
       transfer_type(param.transfer_type[level]),
-      use_mma(param.use_mma == QUDA_BOOLEAN_TRUE)
+      use_mma(param.use_mma == QUDA_BOOLEAN_TRUE),
+      restore_hierarchy(false)
     {
       // set the block size
       for (int i = 0; i < QUDA_MAX_DIM; i++) geoBlockSize[i] = param.geo_block_size[level][i];
@@ -171,7 +178,8 @@ namespace quda {
       location(param.mg_global.location[level]),
       setup_location(param.mg_global.setup_location[level]),
       transfer_type(param.mg_global.transfer_type[level]),
-      use_mma(param.use_mma)
+      use_mma(param.use_mma),
+      restore_hierarchy(param.restore_hierarchy)
     {
       // set the block size
       for (int i = 0; i < QUDA_MAX_DIM; i++) geoBlockSize[i] = param.mg_global.geo_block_size[level][i];
@@ -181,6 +189,129 @@ namespace quda {
     }
   };
 
+  /**
+     @brief Wrapper that runs the coarsest-grid solve on an
+     agglomerated processor grid.  When the local coarse volume is
+     small, halo exchange and global reductions dominate the coarsest
+     solve, so the coarse operator is gathered with split_field onto
+     sub-partitions of the processor grid given by split_key, each of
+     which holds the entire coarse grid on fewer processes.  On each
+     application the source is gathered likewise, every sub-partition
+     solves the system redundantly with the communicator of that
+     sub-partition active, and the solution is scattered back with
+     join_field.
+   */
+  class AgglomeratedSolver : public Solver
+  {
+    /** Number of sub-partitions in each dimension */
+    const CommKey split_key;
+
+    /** Key of the communicator active when the solver was created */
+    const CommKey parent_key;
+
+    /** Source and solution vectors on the agglomerated grid */
+    ColorSpinorField *b_agglomerate;
+    ColorSpinorField *x_agglomerate;
+
+    /** Temporaries for the agglomerated operator */
+    ColorSpinorField *tmp1;
+    ColorSpinorField *tmp2;
+
+    /** The coarse operator on the agglomerated grid */
+    DiracCoarse *dirac;
+
+    /** Wrapper for the agglomerated operator */
+    DiracMatrix *mat_agglomerate;
+
+    /** The solver that runs on the agglomerated grid */
+    Solver *solver;
+
+  public:
+    /**
+       @param[in] mat_coarse The coarse operator being solved for
+       @param[in] dirac_coarse The coarse Dirac operator underlying mat_coarse
+       @param[in] meta Vector defining the coarse grid
+       @param[in] split_key Number of sub-partitions in each dimension
+       @param[in] param Parameters for the solver that runs on the agglomerated grid
+       @param[in] profile Time profile
+       @param[in] prefix Prefix label used for printf by the solver
+     */
+    AgglomeratedSolver(const DiracMatrix &mat_coarse, const DiracCoarse &dirac_coarse, const ColorSpinorField &meta,
+                       const CommKey &split_key, SolverParam &param, TimeProfile &profile, const char *prefix);
+
+    virtual ~AgglomeratedSolver();
+
+    void operator()(ColorSpinorField &x, ColorSpinorField &b);
+
+    virtual bool hermitian() { return solver->hermitian(); } /** Use the inner solver */
+  };
+
+  /**
+     Worker that applies a CPU-located coarse-grid solve on a host
+     thread, so that it can run concurrently with the work on the next
+     finer level.  The thread inherits the output state of the
+     launching thread, runs OpenMP parallel regions with its own pool
+     of threads and reductions with its own buffers.  The first solve
+     is applied synchronously so that any tuning and allocation is
+     complete before the solve is ever run concurrently with the finer
+     level.  Since the worker thread communicates, this is only
+     supported on a single process.
+   */
+  class AsyncCoarseSolve : public Worker
+  {
+    /** The coarse-grid solver */
+    Solver &solver;
+
+    /** Coarse solution vector */
+    ColorSpinorField &x;
+
+    /** Coarse source vector */
+    ColorSpinorField &b;
+
+    /** Size of the host thread pool used by the solve (0 = OpenMP default) */
+    const int n_thread;
+
+    /** Whether the solve has been applied at least once */
+    bool applied;
+
+    /** The thread running the solve */
+    std::thread thread;
+
+    /** Reduction buffers used by the worker thread */
+    void *reduce_buffers;
+
+  public:
+    /**
+       @param[in] solver The coarse-grid solver
+       @param[in] x Coarse solution vector
+       @param[in] b Coarse source vector
+       @param[in] n_thread Size of the host thread pool used by the solve
+     */
+    AsyncCoarseSolve(Solver &solver, ColorSpinorField &x, ColorSpinorField &b, int n_thread);
+
+    virtual ~AsyncCoarseSolve();
+
+    /**
+       @brief Apply the coarse-grid solve on the calling thread
+     */
+    void apply(const qudaStream_t = device::get_default_stream());
+
+    /**
+       @brief Start the coarse-grid solve on the worker thread
+     */
+    void launch();
+
+    /**
+       @brief Wait for a launched coarse-grid solve to complete
+     */
+    void wait();
+
+    /**
+       @return Whether the solve can be launched asynchronously
+     */
+    bool ready() const { return applied; }
+  };
+
   /**
      Adaptive Multigrid solver
    */
@@ -217,6 +348,9 @@ namespace quda {
     /** The coarse grid solver - this either points at "coarse" or a solver preconditioned by "coarse" */
     Solver *coarse_solver;
 
+    /** Worker that applies the coarse grid solver asynchronously, if enabled */
+    AsyncCoarseSolve *coarse_async;
+
     /** Storage for the parameter struct for the coarse grid */
     MGParam *param_coarse;
 
@@ -283,6 +417,88 @@ namespace quda {
     /** Parallel hyper-cubic random number generator for generating null-space vectors */
     RNG *rng;
 
+    /** Work observed in the K-cycle on this level since the last call to adaptCycle() */
+    struct CycleWork {
+      int cycles = 0;           /**< Number of cycles applied */
+      long coarse_iter = 0;     /**< Total iterations of the coarse-grid Krylov solve */
+      double smooth_time = 0.0; /**< Time spent in pre- and post-smoothing */
+      double coarse_time = 0.0; /**< Time spent in the coarse-grid correction */
+    } cycle_work;
+
+    /**
+       Pairs of events recorded around a piece of work in each cycle.
+       Recording does not synchronize the cycle with the host; the
+       elapsed times are only read back in adaptCycle().  Work on a
+       level that runs on the host is timed with a host timer instead.
+    */
+    class CycleEvents
+    {
+      /** Upper limit on the recorded events, beyond which they are folded into time */
+      static constexpr size_t max_events = 1024;
+      std::vector<std::pair<qudaEvent_t, qudaEvent_t>> events;
+      size_t n_recorded = 0;
+      double time = 0.0;
+      bool running = false;
+
+      /** Whether the work runs on the host, in which case host_timer is used */
+      const bool host;
+      host_timer_t host_timer;
+
+      /** @brief Accumulate the elapsed time of the recorded events into time */
+      void fold();
+
+    public:
+      /**
+         @param[in] location Location of the work being timed
+      */
+      CycleEvents(QudaFieldLocation location) : host(location == QUDA_CPU_FIELD_LOCATION) { }
+      CycleEvents(const CycleEvents &) = delete;
+      CycleEvents &operator=(const CycleEvents &) = delete;
+      ~CycleEvents();
+
+      /** @brief Record the start of the work */
+      void start();
+
+      /** @brief Record the end of the work */
+      void stop();
+
+      /**
+         @brief Wait for the recorded work to complete and discard the
+         recorded events
+         @return The total time in seconds between each start and stop
+      */
+      double elapsed();
+
+      /** @brief Discard the recorded events */
+      void reset()
+      {
+        n_recorded = 0;
+        time = 0.0;
+        host_timer.time = 0.0;
+      }
+    };
+
+    /** Events used to record the smoothing and coarse-grid correction work */
+    CycleEvents smooth_events, coarse_events;
+
+    /** Work per solve with the accepted smoothing, negative if not yet measured */
+    double adapt_reference;
+
+    /** Direction (+1 or -1) in which the smoothing is being varied */
+    int adapt_direction;
+
+    /** Number of rejected trial smoothings; the smoothing is settled after two */
+    int adapt_rejected;
+
+    /** Whether a trial smoothing in the current direction has been accepted */
+    bool adapt_improved;
+
+    /** The accepted number of pre- and post-smoothing iterations */
+    int nu_pre_accepted, nu_post_accepted;
+
+    /** Upper limits for the number of pre- and post-smoothing iterations */
+    int nu_pre_max, nu_post_max;
+
     /**
        @brief Helper function called on entry to each MG function
        @param[in] level The level we working on
@@ -316,14 +532,41 @@ namespace quda {
     /**
        @brief This method resets the solver, e.g., when a parameter has changed such as the mass.
        @param Whether we are refreshing the null-space components or just updating the operators
+       @param gauge_change Relative change of the gauge field since
+       the last update.  If non-negative, a refresh is incremental:
+       the number of null-space relaxation iterations is sized to the
+       change, and the transfer operators are only rebuilt where the
+       relaxed null space is no longer captured by them
      */
-    void reset(bool refresh=false);
+    void reset(bool refresh = false, double gauge_change = -1.0);
 
     /**
        @brief Dump the null-space vectors to disk.  Will recurse dumping all levels.
     */
     void dumpNullVectors() const;
 
+    /**
+       @brief Checkpoint the entire hierarchy (null-space vectors,
+       prolongators and coarse operators) to disk using the
+       filename prefix QudaMultigridParam::hierarchy_outfile.  Will
+       recurse dumping all levels.
+       @param[in] checksum Checksum identifying the fine-grid state
+       (gauge field and operator parameters) the hierarchy was built from
+    */
+    void dumpHierarchy(uint64_t checksum) const;
+
+    /**
+       @brief Query whether a complete hierarchy checkpoint matching
+       the given checksum exists at the filename prefix
+       QudaMultigridParam::hierarchy_infile.  This is a collective
+       operation that returns true only if all processes can restore
+       every level.
+       @param[in] mg_param The global multigrid parameters
+       @param[in] checksum Checksum identifying the fine-grid state
+       @return Whether the hierarchy can be restored
+    */
+    static bool checkHierarchy(const QudaMultigridParam &mg_param, uint64_t checksum);
+
     /**
        @brief Create the smoothers
     */
@@ -339,6 +582,17 @@ namespace quda {
     */
     void createCoarseDirac();
 
+    /**
+       @brief Determine the processor sub-grid onto which the
+       coarsest-grid solve is agglomerated: the processor grid is
+       successively halved, in the dimension with the most processes,
+       until the local coarse volume reaches the threshold given by
+       coarse_solver_agglomerate_volume.
+       @return The number of sub-partitions in each dimension, which
+       is unity in all dimensions if no agglomeration is done
+    */
+    CommKey agglomerationKey() const;
+
     /**
        @brief Create the solver wrapper
     */
@@ -362,6 +616,17 @@ namespace quda {
      */
     void verify(bool recursively = false);
 
+    /**
+       @brief Retune the number of pre- and post-smoothing iterations
+       on each K-cycle level from the work observed since the last
+       call, and reset the work record.  This should be called
+       between solves.  Each level varies its smoothing one
+       iteration at a time, keeping a change if it reduced the time
+       spent on the level during the solve, and settles once neither
+       direction improves.  Will recurse over all levels.
+    */
+    void adaptCycle();
+
     /**
        This applies the V-cycle to the residual vector returning the residual vector
        @param out The solution vector
@@ -385,8 +650,31 @@ namespace quda {
        @brief Generate the null-space vectors
        @param B Generated null-space vectors
        @param refresh Whether we refreshing pre-exising vectors or starting afresh
+       @param maxiter Maximum number of iterations for each setup
+       solve (0 = setup_maxiter, or setup_maxiter_refresh if refreshing)
+    */
+    void generateNullVectors(std::vector<ColorSpinorField*> &B, bool refresh=false, int maxiter=0);
+
+    /**
+       @brief Relax a batch of null-space vectors simultaneously
+       against the homogeneous system using minimal-residual
+       iterations.  The operator is applied to the whole batch at
+       once, and the batch is orthonormalized after each iteration
+       with a single Cholesky-QR step.
+       @param B Null-space vectors we are relaxing
+       @param mat The operator we are relaxing against
+       @param solverParam Setup parameters (precision, tolerance, maximum iterations)
+    */
+    void relaxNullVectorsBatched(std::vector<ColorSpinorField *> &B, const DiracMatrix &mat,
+                                 const SolverParam &solverParam);
+
+    /**
+       @brief Compute how well the existing transfer operator captures
+       the null-space vectors
+       @return The maximum relative defect ||(1 - P R) B|| / ||B||
+       over the null-space vectors
     */
-    void generateNullVectors(std::vector<ColorSpinorField*> &B, bool refresh=false);
+    double transferDefect();
 
     /**
        @brief Generate lowest eigenvectors
@@ -428,6 +716,35 @@ namespace quda {
 		   bool dslash=true, bool clover=true, bool dagger=false, const int *commDim=0,
                    QudaPrecision halo_precision=QUDA_INVALID_PRECISION);
 
+  /**
+     @brief Block-Jacobi approximate solve of the coarse operator on a
+     CPU-located level.  The local lattice is partitioned into
+     hypercubic blocks and n_iter MR iterations are run on each block
+     independently, neglecting the coupling between blocks, so each
+     host thread works entirely within its own cache-resident block.
+     @param x[out] Output field, x = omega * sum_B A_BB^{-1} b_B (approximately)
+     @param b[in] Input source field
+     @param Y[in] Coarse link field
+     @param X[in] Coarse clover field
+     @param kappa Scaling parameter
+     @param block Hypercubic block extent, must divide the local dimensions
+     @param n_iter Number of MR iterations per block
+     @param omega Relaxation parameter applied to the block solution
+   */
+  void ApplyCoarseBlockMR(ColorSpinorField &x, const ColorSpinorField &b, const GaugeField &Y, const GaugeField &X,
+                          double kappa, int block, int n_iter, double omega);
+
+  /**
+     @brief Zero all sites of a CPU-located coarse field that lie
+     outside of one hypercubic block of the local lattice.  Together
+     with the full coarse operator this gives a reference for
+     ApplyCoarseBlockMR.
+     @param x[in,out] Field to be masked
+     @param block Hypercubic block extent, must divide the local dimensions
+     @param block_idx Index of the block that is retained
+   */
+  void CoarseBlockMask(ColorSpinorField &x, int block, int block_idx);
+
   /**
      @brief Coarse operator construction from a fine-grid operator (Wilson / Clover)
      @param Y[out] Coarse link field
@@ -519,8 +836,20 @@ namespace quda {
     MG *mg;
     TimeProfile &profile;
 
+    /** Snapshot of the gauge field at the last setup or update, used for incremental refresh */
+    GaugeField *gauge_ref = nullptr;
+
     multigrid_solver(QudaMultigridParam &mg_param, TimeProfile &profile);
 
+    /**
+       @brief Compute the relative change of the gauge field since the
+       last call, ||U - U_ref|| / ||U_ref||, and make the present gauge
+       field the new reference
+       @param[in] gauge The present gauge field
+       @return The relative change, or -1 if there is no reference yet
+    */
+    double gaugeChange(const GaugeField &gauge);
+
     virtual ~multigrid_solver()
     {
       profile.TPSTART(QUDA_PROFILE_FREE);
@@ -530,6 +859,8 @@ namespace quda {
 
       for (unsigned int i=0; i<B.size(); i++) delete B[i];
 
+      if (gauge_ref) delete gauge_ref;
+
       if (m) delete m;
       if (mSmooth) delete mSmooth;
       if (mSmoothSloppy) delete mSmoothSloppy;
@@ -89,6 +89,7 @@ extern "C" {
     size_t gauge_offset; /**< Offset into MILC site struct to the gauge field (only if gauge_order=MILC_SITE_GAUGE_ORDER) */
     size_t mom_offset; /**< Offset into MILC site struct to the momentum field (only if gauge_order=MILC_SITE_GAUGE_ORDER) */
     size_t site_size; /**< Size of MILC site struct (only if gauge_order=MILC_SITE_GAUGE_ORDER) */
+    int cache_site_gauge; /**< Keep a device copy of the gauge field, reused while the host links are unchanged (only if gauge_order=MILC_SITE_GAUGE_ORDER) */
   } QudaGaugeParam;
 
 
@@ -147,6 +148,9 @@ extern "C" {
     double reliable_delta_refinement; /**< Reliable update tolerance used in post multi-shift solver refinement */
     int use_alternative_reliable; /**< Whether to use alternative reliable updates */
     int use_sloppy_partial_accumulator; /**< Whether to keep the partial solution accumuator in sloppy precision */
+    int use_adaptive_precision; /**< Whether to adapt the sloppy precision at runtime, stepping between the precondition,
+                                   sloppy and full precision operators depending on the residual drift observed at
+                                   reliable updates (CG only at the moment) */
 
     /**< This parameter determines how often we accumulate into the
        solution vector from the direction vectors in the solver.
@@ -422,10 +426,10 @@ extern "C" {
     /** Use Polynomial Acceleration **/
     QudaBoolean use_poly_acc;
 
-    /** Degree of the Chebysev polynomial **/
+    /** Degree of the Chebysev polynomial (if zero, chosen automatically) **/
     int poly_deg;
 
-    /** Range used in polynomial acceleration **/
+    /** Range used in polynomial acceleration (if zero, a_min is chosen automatically and a_max is estimated) **/
     double a_min;
     double a_max;
 
@@ -487,7 +491,8 @@ extern "C" {
     int check_interval;
     /** For IRLM/IRAM, quit after n restarts **/
     int max_restarts;
-    /** For the Ritz rotation, the maximal number of extra vectors the solver may allocate **/
+    /** For the Ritz rotation, the maximal number of extra vectors the solver may allocate (if zero, this is chosen
+        automatically from the available memory) **/
     int batched_rotate;
     /** For block method solvers, the block size **/
     int block_size;
@@ -586,6 +591,11 @@ extern "C" {
     /** Number of setup iterations */
     int num_setup_iter[QUDA_MAX_MG_LEVEL];
 
+    /** Number of null-space vectors relaxed simultaneously in the
+        setup phase with a multi-RHS minimal-residual relaxation (1 =
+        solve for each vector in turn with setup_inv_type) */
+    int setup_batch_size[QUDA_MAX_MG_LEVEL];
+
     /** Tolerance to use in the setup phase */
     double setup_tol[QUDA_MAX_MG_LEVEL];
 
@@ -625,7 +635,7 @@ extern "C" {
     /** Maximum number of iterations for the solver that wraps around the coarse grid correction and smoother */
     int coarse_solver_maxiter[QUDA_MAX_MG_LEVEL];
 
-    /** Basis to use for CA-CGN(E/R) coarse solver */
+    /** Basis to use for CA-CGN(E/R) or CA-GCR coarse solver */
     QudaCABasis coarse_solver_ca_basis[QUDA_MAX_MG_LEVEL];
 
     /** Basis size for CACG coarse solver */
@@ -637,6 +647,18 @@ extern "C" {
     /** Maximum eigenvalue for Chebyshev CA basis */
     double coarse_solver_ca_lambda_max[QUDA_MAX_MG_LEVEL];
 
+    /** Local coarse-grid volume below which the coarse solver is agglomerated onto fewer processes (0 = never) */
+    int coarse_solver_agglomerate_volume[QUDA_MAX_MG_LEVEL];
+
+    /** Whether a CPU-located coarsest-level solve is run on a worker
+        thread, overlapping with the post-smoothing on the next finer
+        level (this makes the coarse-grid correction additive).  Only
+        supported on a single process. */
+    QudaBoolean coarse_solver_async[QUDA_MAX_MG_LEVEL];
+
+    /** Size of the host thread pool used by the asynchronous coarse solve (0 = OpenMP default) */
+    int coarse_solver_async_threads[QUDA_MAX_MG_LEVEL];
+
     /** Smoother to use on each level */
     QudaInverterType smoother[QUDA_MAX_MG_LEVEL];
 
@@ -655,12 +677,23 @@ extern "C" {
     /** Precision to use for halo communication in the smoother */
     QudaPrecision smoother_halo_precision[QUDA_MAX_MG_LEVEL];
 
+    /** Precision of the block floating point coarse links used by the
+        smoother on each coarse level, where each link matrix carries
+        its own scale factor (QUDA_HALF_PRECISION or
+        QUDA_QUARTER_PRECISION; QUDA_INVALID_PRECISION disables) */
+    QudaPrecision block_float_precision[QUDA_MAX_MG_LEVEL];
+
     /** Whether to use additive or multiplicative Schwarz preconditioning in the smoother */
     QudaSchwarzType smoother_schwarz_type[QUDA_MAX_MG_LEVEL];
 
     /** Number of Schwarz cycles to apply */
     int smoother_schwarz_cycle[QUDA_MAX_MG_LEVEL];
 
+    /** Hypercubic block extent of the independent sub-domains used by
+        block-Jacobi Schwarz smoothing; must divide the local lattice
+        dimensions of the level */
+    int smoother_schwarz_block[QUDA_MAX_MG_LEVEL];
+
     /** The type of residual to send to the next coarse grid, and thus the
 	type of solution to receive back from this coarse grid */
     QudaSolutionType coarse_grid_solution_type[QUDA_MAX_MG_LEVEL];
@@ -668,7 +701,11 @@ extern "C" {
     /** The type of smoother solve to do on each grid (e/o preconditioning or not)*/
     QudaSolveType smoother_solve_type[QUDA_MAX_MG_LEVEL];
 
-    /** The type of multigrid cycle to perform at each level */
+    /** The type of multigrid cycle to perform at each level.  The
+        K-cycle (QUDA_MG_CYCLE_KCYCLE) solves each coarse level with
+        a flexible Krylov solver to the relative tolerance
+        coarse_solver_tol, and retunes nu_pre and nu_post between
+        solves from the observed work on the level */
     QudaMultigridCycleType cycle_type[QUDA_MAX_MG_LEVEL];
 
     /** Whether to use global reductions or not for the smoother / solver at each level */
@@ -738,6 +775,38 @@ extern "C" {
 
     /** Whether to do a full (false) or thin (true) update in the context of updateMultigridQuda */
     QudaBoolean thin_update_only;
+
+    /** Whether a full update in updateMultigridQuda is incremental:
+        the null-space vectors are relaxed with a number of iterations
+        sized to the gauge-field change since the last update, and the
+        transfer operators are only rebuilt where the relaxed vectors
+        are no longer captured by them */
+    QudaBoolean incremental_refresh;
+
+    /** Relative gauge-field change ||U - U_old|| / ||U_old|| for which
+        incremental refresh uses setup_maxiter_refresh iterations, with
+        proportionally fewer for smaller changes */
+    double incremental_refresh_gauge_change;
+
+    /** Relative defect ||(1 - P R) B|| / ||B|| of the relaxed
+        null-space vectors with respect to the existing transfer
+        operator above which incremental refresh rebuilds it */
+    double incremental_refresh_transfer_tol;
+
+    /** Whether to restore the full multigrid hierarchy (null-space
+        vectors, prolongators and coarse operators) from a checkpoint
+        if one exists that matches the current gauge field */
+    QudaBoolean hierarchy_load;
+
+    /** Filename prefix from which to restore the multigrid hierarchy */
+    char hierarchy_infile[256];
+
+    /** Whether dumpMultigridQuda saves the full multigrid hierarchy
+        (rather than just the null-space vectors) */
+    QudaBoolean hierarchy_store;
+
+    /** Filename prefix for where to save the multigrid hierarchy */
+    char hierarchy_outfile[256];
   } QudaMultigridParam;
 
   typedef struct QudaGaugeObservableParam_s {
@@ -998,6 +1067,38 @@ extern "C" {
    */
   void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param);
 
+  /**
+   * Callback used by loadGaugeStreamQuda to read a slab of local time
+   * slices [t_begin, t_end) of the host gauge field.
+   *
+   * @param h_gauge Base pointer to a host gauge field covering only
+   *                the slab, in the order given by
+   *                QudaGaugeParam::gauge_order (for QDP order this is
+   *                an array of per-dimension pointers)
+   * @param t_begin First local time slice of the slab
+   * @param t_end   One past the last local time slice of the slab
+   * @param context Auxiliary data passed to loadGaugeStreamQuda
+   * @return        Zero on success
+   */
+  typedef int (*QudaGaugeReader)(void *h_gauge, int t_begin, int t_end, void *context);
+
+  /**
+   * Load the gauge field from the host in slabs of local time
+   * slices, such that the full host field never needs to be
+   * resident.  Reading a slab, reordering the previous slab and
+   * transferring the one before that to the device are overlapped.
+   * Otherwise equivalent to loadGaugeQuda.  Fixed-point fat links
+   * need their global max first, so every slab is read twice.  The
+   * reader must therefore be repeatable.
+   * @param reader  Callback that fills in each slab
+   * @param context Auxiliary data passed to the reader
+   * @param slab    Number of local time slices per slab (must be
+   *                even and divide the local temporal extent); zero
+   *                selects a default
+   * @param param   Contains all metadata regarding host and device storage
+   */
+  void loadGaugeStreamQuda(QudaGaugeReader reader, void *context, int slab, QudaGaugeParam *param);
+
   /**
    * Free QUDA's internal copy of the gauge field.
    */
@@ -1066,7 +1167,9 @@ extern "C" {
    * gauge_param are used if for inv_param split_grid[0] * split_grid[1] * split_grid[2] * split_grid[3]
    * is larger than 1, in which case gauge field is not required to be loaded beforehand; otherwise
    * this interface would just work as @invertQuda, which requires gauge field to be loaded beforehand,
-   * and the gauge field pointer and gauge_param are not used.
+   * and the gauge field pointer and gauge_param are not used.  As an alternative to splitting the
+   * grid, if the grid is not split and inv_type is QUDA_BLOCK_CG_INVERTER, all num_src rhs' are
+   * solved for at once with block CG; param->true_res_offset then holds the residual of each rhs.
    * @param _hp_x       Array of solution spinor fields
    * @param _hp_b       Array of source spinor fields
    * @param param       Contains all metadata regarding host and device storage and solver parameters
@@ -1138,7 +1241,13 @@ extern "C" {
   void updateMultigridQuda(void *mg_instance, QudaMultigridParam *param);
 
   /**
-   * @brief Dump the null-space vectors to disk
+   * @brief Dump the null-space vectors to disk.  If
+   * QudaMultigridParam::hierarchy_store is set, the entire
+   * hierarchy (null-space vectors, prolongators and coarse
+   * operators) is instead checkpointed to
+   * QudaMultigridParam::hierarchy_outfile, such that a subsequent
+   * newMultigridQuda call on the same gauge field with
+   * QudaMultigridParam::hierarchy_load set can skip the setup.
    * @param[in] mg_instance Pointer to the instance of multigrid_solver
    * @param[in] param Contains all metadata regarding host and device
    * storage and solver parameters (QudaMultigridParam::vec_outfile
@@ -1162,6 +1271,13 @@ extern "C" {
    * The QudaInvertParam object specifies how the solve should be performed on each sub-partition.
    * Unlike @invertQuda, the interface also takes the host side gauge as
    * input - gauge field is not required to be loaded beforehand.
+   * If the grid is not split (split_grid is all ones) and num_src > 1,
+   * Wilson, clover, staggered and asqtad (with Ls = 1) dslashes are
+   * instead applied locally in a batched mode: the sources are packed
+   * into a single multi-RHS field and the dslash is applied once, such
+   * that the links are loaded once for all sources.  As with
+   * @dslashQuda the gauge (and clover) fields must then be loaded
+   * beforehand.
    * @param _hp_x       Array of solution spinor fields
    * @param _hp_b       Array of source spinor fields
    * @param param       Contains all metadata regarding host and device storage and solver parameters
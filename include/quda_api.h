@@ -53,6 +53,21 @@ namespace quda
   void qudaMemcpyAsync_(void *dst, const void *src, size_t count, qudaMemcpyKind kind, const qudaStream_t &stream,
                         const char *func, const char *file, const char *line);
 
+  /**
+     @brief Wrapper around cudaMemcpy2DAsync or driver API equivalent
+     @param[out] dst Destination pointer
+     @param[in] dpitch Destination pitch in bytes
+     @param[in] src Source pointer
+     @param[in] spitch Source pitch in bytes
+     @param[in] width Width of each row in bytes
+     @param[in] height Number of rows
+     @param[in] kind Type of memory copy
+     @param[in] stream Stream to issue copy
+  */
+  void qudaMemcpy2DAsync_(void *dst, size_t dpitch, const void *src, size_t spitch, size_t width, size_t height,
+                          qudaMemcpyKind kind, const qudaStream_t &stream, const char *func, const char *file,
+                          const char *line);
+
   /**
      @brief Wrapper around cudaMemcpyAsync or driver API equivalent for peer-to-peer copies
      @param[out] dst Destination pointer
@@ -218,6 +233,10 @@ namespace quda
 #define qudaMemcpyAsync(dst, src, count, kind, stream)                                                                 \
   ::quda::qudaMemcpyAsync_(dst, src, count, kind, stream, __func__, quda::file_name(__FILE__), __STRINGIFY__(__LINE__))
 
+#define qudaMemcpy2DAsync(dst, dpitch, src, spitch, width, height, kind, stream)                                       \
+  ::quda::qudaMemcpy2DAsync_(dst, dpitch, src, spitch, width, height, kind, stream, __func__,                          \
+                             quda::file_name(__FILE__), __STRINGIFY__(__LINE__))
+
 #define qudaMemcpyP2PAsync(dst, src, count, stream)                                                                    \
   ::quda::qudaMemcpyP2PAsync_(dst, src, count, stream, __func__, quda::file_name(__FILE__), __STRINGIFY__(__LINE__))
 
@@ -55,6 +55,27 @@ namespace quda
        reductions with the host
      */
     qudaEvent_t &get_event();
+
+    /**
+       @brief Allocate a separate set of reduction buffers, which a
+       host thread can bind to reduce concurrently with the main
+       thread (see set_thread_buffers)
+       @return Handle to the buffers
+     */
+    void *create_buffers();
+
+    /**
+       @brief Free a set of reduction buffers allocated with create_buffers
+       @param[in] buffers Handle to the buffers
+     */
+    void destroy_buffers(void *buffers);
+
+    /**
+       @brief Bind the calling thread to a set of reduction buffers,
+       such that all reductions it launches use these
+       @param[in] buffers Handle to the buffers (nullptr for the default set)
+     */
+    void set_thread_buffers(void *buffers);
   } // namespace reducer
 
   constexpr int max_n_reduce() { return QUDA_MAX_MULTI_REDUCE; }
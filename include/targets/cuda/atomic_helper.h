@@ -71,10 +71,18 @@ namespace quda
   }
 
   template <bool is_device> struct atomic_fetch_abs_max_impl {
+    /**
+       @brief Host implementation of atomic max.  OpenMP atomics do
+       not support max, so we use a compare-and-swap loop that only
+       stores when val is larger than the current value.
+       @param addr Address that stores the atomic variable to be updated
+       @param val Value to be compared against
+    */
     template <typename T> inline void operator()(T *addr, T val)
     {
-#pragma omp atomic update
-      *addr = std::max(*addr, val);
+      T old;
+      __atomic_load(addr, &old, __ATOMIC_RELAXED);
+      while (old < val && !__atomic_compare_exchange(addr, &old, &val, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) { }
     }
   };
 
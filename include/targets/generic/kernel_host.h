@@ -1,15 +1,80 @@
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+
 namespace quda
 {
 
-  template <template <typename> class Functor, typename Arg> void Kernel1D_host(const Arg &arg)
+  /**
+     @brief Trait that determines whether a functor may be applied
+     concurrently to different x indices on the host, i.e., each x
+     index only writes to its own output.  Functors opt in by defining
+     `static constexpr bool host_parallel = true`; all others retain
+     the serial host kernels below.
+  */
+  template <typename F, typename = void> struct host_parallel : std::false_type {
+  };
+  template <typename F> struct host_parallel<F, std::enable_if_t<F::host_parallel>> : std::true_type {
+  };
+
+  /**
+     Number of consecutive x indices that are processed as a block by
+     the parallel host kernels.  All y and z indices of a block are
+     applied before moving on to the next block, so that for
+     reordering kernels the source and destination lines touched by a
+     block stay resident in cache, and the innermost loop runs over
+     contiguous x indices.
+  */
+  constexpr int host_block_x = 64;
+
+  /**
+     @brief Trait that returns the number of x indices a parallel
+     host kernel processes as a block.  Functors whose x index is
+     already a coarse work item (e.g., a whole lattice block) set
+     `static constexpr int host_block_x = 1` so that each x index is
+     scheduled independently; all others use the default above.
+  */
+  template <typename F, typename = void> struct host_block_size : std::integral_constant<int, host_block_x> {
+  };
+  template <typename F>
+  struct host_block_size<F, std::enable_if_t<(F::host_block_x > 0)>> : std::integral_constant<int, F::host_block_x> {
+  };
+
+  /**
+     @brief Apply the function g to each block of x indices,
+     distributing the blocks over threads if OpenMP is enabled.
+     @tparam block_x Number of x indices per block
+     @param[in] n_x Number of x indices
+     @param[in] g Function with signature g(x_begin, x_end)
+  */
+  template <int block_x = host_block_x, typename G> void host_block_for(int n_x, const G &g)
+  {
+    const int n_block = (n_x + block_x - 1) / block_x;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < n_block; b++) g(b * block_x, std::min(n_x, (b + 1) * block_x));
+  }
+
+  template <template <typename> class Functor, typename Arg>
+  std::enable_if_t<!host_parallel<Functor<Arg>>::value, void> Kernel1D_host(const Arg &arg)
   {
     Functor<Arg> f(const_cast<Arg &>(arg));
     for (int i = 0; i < static_cast<int>(arg.threads.x); i++) { f(i); }
   }
 
-  template <template <typename> class Functor, typename Arg> void Kernel2D_host(const Arg &arg)
+  template <template <typename> class Functor, typename Arg>
+  std::enable_if_t<host_parallel<Functor<Arg>>::value, void> Kernel1D_host(const Arg &arg)
+  {
+    host_block_for<host_block_size<Functor<Arg>>::value>(arg.threads.x, [&](int x_begin, int x_end) {
+      Functor<Arg> f(const_cast<Arg &>(arg));
+      for (int i = x_begin; i < x_end; i++) { f(i); }
+    });
+  }
+
+  template <template <typename> class Functor, typename Arg>
+  std::enable_if_t<!host_parallel<Functor<Arg>>::value, void> Kernel2D_host(const Arg &arg)
   {
     Functor<Arg> f(const_cast<Arg &>(arg));
     for (int i = 0; i < static_cast<int>(arg.threads.x); i++) {
@@ -17,7 +82,19 @@ namespace quda
     }
   }
 
-  template <template <typename> class Functor, typename Arg> void Kernel3D_host(const Arg &arg)
+  template <template <typename> class Functor, typename Arg>
+  std::enable_if_t<host_parallel<Functor<Arg>>::value, void> Kernel2D_host(const Arg &arg)
+  {
+    host_block_for<host_block_size<Functor<Arg>>::value>(arg.threads.x, [&](int x_begin, int x_end) {
+      Functor<Arg> f(const_cast<Arg &>(arg));
+      for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
+        for (int i = x_begin; i < x_end; i++) { f(i, j); }
+      }
+    });
+  }
+
+  template <template <typename> class Functor, typename Arg>
+  std::enable_if_t<!host_parallel<Functor<Arg>>::value, void> Kernel3D_host(const Arg &arg)
   {
     Functor<Arg> f(const_cast<Arg &>(arg));
     for (int i = 0; i < static_cast<int>(arg.threads.x); i++) {
@@ -27,4 +104,17 @@ namespace quda
     }
   }
 
+  template <template <typename> class Functor, typename Arg>
+  std::enable_if_t<host_parallel<Functor<Arg>>::value, void> Kernel3D_host(const Arg &arg)
+  {
+    host_block_for<host_block_size<Functor<Arg>>::value>(arg.threads.x, [&](int x_begin, int x_end) {
+      Functor<Arg> f(const_cast<Arg &>(arg));
+      for (int k = 0; k < static_cast<int>(arg.threads.z); k++) {
+        for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
+          for (int i = x_begin; i < x_end; i++) { f(i, j, k); }
+        }
+      }
+    });
+  }
+
 } // namespace quda
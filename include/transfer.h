@@ -11,6 +11,7 @@
  */
 
 #include <color_spinor_field.h>
+#include <checkpoint_io.h>
 #include <vector>
 
 namespace quda {
@@ -171,9 +172,13 @@ namespace quda {
      * @param parity For single-parity fields are these QUDA_EVEN_PARITY or QUDA_ODD_PARITY
      * @param null_precision The precision to store the null-space basis vectors in
      * @param enable_gpu Whether to enable this to run on GPU (as well as CPU)
+     * @param compute Whether to compute the geometry maps and block
+     * orthogonalize the null-space vectors.  If false, the transfer
+     * is left uninitialized and must be populated with load().
      */
     Transfer(const std::vector<ColorSpinorField *> &B, int Nvec, int NblockOrtho, bool blockOrthoTwoPass, int *geo_bs,
-             int spin_bs, QudaPrecision null_precision, const QudaTransferType transfer_type, TimeProfile &profile);
+             int spin_bs, QudaPrecision null_precision, const QudaTransferType transfer_type, TimeProfile &profile,
+             bool compute = true);
 
     /** The destructor for Transfer */
     virtual ~Transfer();
@@ -183,19 +188,53 @@ namespace quda {
      */
     void reset();
 
+    /**
+       @brief Save the geometry maps and the block-orthogonalized
+       null-space vectors to a checkpoint
+       @param[in] io The checkpoint we are writing to
+     */
+    void save(CheckpointIO &io) const;
+
+    /**
+       @brief Restore the geometry maps and the block-orthogonalized
+       null-space vectors from a checkpoint, in lieu of computing them
+       @param[in] io The checkpoint we are reading from
+     */
+    void load(CheckpointIO &io);
+
     /**
      * Apply the prolongator
      * @param out The resulting field on the fine lattice
      * @param in The input field on the coarse lattice
+     * @param accumulate Whether to add the prolongated field to out
+     * (out += P in) in the same pass, rather than overwrite it.
+     * Requires fusable(out, in).
      */
-    void P(ColorSpinorField &out, const ColorSpinorField &in) const;
+    void P(ColorSpinorField &out, const ColorSpinorField &in, bool accumulate = false) const;
 
     /**
      * Apply the restrictor
      * @param out The resulting field on the coarse lattice
      * @param in The input field on the fine lattice
+     * @param sub Optional fine field that is subtracted from in as it
+     * is read, so that out = R (in - sub), e.g., restricting the
+     * residual b - Ax directly from b and Ax.  Requires fusable(in, out)
+     * and fusable(*sub, out).
+     */
+    void R(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField *sub = nullptr) const;
+
+    /**
+     * @brief Whether the fused prolongate-accumulate and
+     * residual-restrict variants of P and R can be applied directly
+     * to this fine-grid field, which requires the aggregation
+     * transfer to run in place on the field without any staging, so
+     * the field must match the precision and order of the coarse
+     * field and null space
+     * @param fine The fine-grid field we wish to transfer
+     * @param coarse The coarse-grid field it is transferred to or from
+     * @return Whether the fused transfer is supported for these fields
      */
-    void R(ColorSpinorField &out, const ColorSpinorField &in) const;
+    bool fusable(const ColorSpinorField &fine, const ColorSpinorField &coarse) const;
 
     /**
      * @brief The precision of the packed null-space vectors
@@ -307,10 +346,11 @@ namespace quda {
      @param[in] fine_to_coarse Fine-to-coarse lookup table (linear indices)
      @param[in] spin_map Spin blocking lookup table
      @param[in] parity of the output fine field (if single parity output field)
+     @param[in] accumulate Whether to add the result to out instead of overwriting it
    */
   void Prolongate(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField &v, 
 		  int Nvec, const int *fine_to_coarse, const int * const *spin_map,
-		  int parity=QUDA_INVALID_PARITY);
+		  int parity=QUDA_INVALID_PARITY, bool accumulate=false);
 
   /**
      @brief Apply the restriction operator
@@ -321,10 +361,11 @@ namespace quda {
      @param[in] fine_to_coarse Fine-to-coarse lookup table (linear indices)
      @param[in] spin_map Spin blocking lookup table
      @param[in] parity of the input fine field (if single parity input field)
+     @param[in] sub Optional fine field to subtract from in before restriction
    */
   void Restrict(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField &v, 
 		int Nvec, const int *fine_to_coarse, const int *coarse_to_fine, const int * const *spin_map,
-		int parity=QUDA_INVALID_PARITY);
+		int parity=QUDA_INVALID_PARITY, const ColorSpinorField *sub=nullptr);
 
   /**
      @brief Apply the unitary "prolongation" operator for Kahler-Dirac preconditioning
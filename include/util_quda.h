@@ -68,6 +68,13 @@ char *getPrintBuffer();
 */
 char* getOmpThreadStr();
 
+/**
+   @brief Return the number of threads the parallel host kernels,
+   e.g., the host reordering, are distributed over.
+   @return Number of host kernel threads
+*/
+int host_kernel_threads();
+
 void errorQuda_(const char *func, const char *file, int line, ...);
 
 #define errorQuda(...)                                                                                                 \
@@ -0,0 +1,432 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <util_quda.h>
+#include <eigen_helper.h>
+#include <arrow_eigensolver.h>
+
+namespace quda
+{
+
+  namespace
+  {
+
+    /** Tridiagonal blocks at or below this size are diagonalized directly */
+    constexpr int arrow_base_size = 32;
+
+    /**
+       @brief The eigen-decomposition of an arrowhead matrix, with the
+       eigenvectors expressed in the basis of the blocks (and apex) it
+       was formed from
+    */
+    struct Arrowhead {
+      VectorXd evals;             /** Eigenvalues in ascending order */
+      MatrixXd evecs;             /** Eigenvectors (columns) */
+      std::vector<char> deflated; /** Whether an eigenvector was deflated, i.e., it is sparse */
+    };
+
+    /**
+       @brief Find the root of the secular equation
+       f(tau) = alpha - tau - sum_i z2_i / (d_i - tau)
+       in the bracket (lo, hi), using Newton's method safeguarded by
+       bisection.  The poles d and apex alpha have been shifted by the
+       pole nearest to the root, so that the root is found to high
+       relative accuracy with respect to that pole.
+       @param[in] d The shifted poles
+       @param[in] z2 The squared couplings
+       @param[in] alpha The shifted apex
+       @param[in] lo Lower end of the bracket, f(lo) > 0
+       @param[in] hi Upper end of the bracket, f(hi) < 0
+       @return The root
+    */
+    double secularRoot(const std::vector<double> &d, const std::vector<double> &z2, double alpha, double lo, double hi)
+    {
+      constexpr double eps = std::numeric_limits<double>::epsilon();
+      constexpr int max_iter = 256;
+
+      double tau = 0.5 * (lo + hi);
+      for (int iter = 0; iter < max_iter; iter++) {
+        double f = alpha - tau;
+        double df = -1.0;
+        for (auto i = 0u; i < d.size(); i++) {
+          double r = 1.0 / (d[i] - tau);
+          double t = z2[i] * r;
+          f -= t;
+          df -= t * r;
+        }
+        if (f == 0.0) break;
+
+        // f is monotonically decreasing between the poles
+        if (f > 0.0)
+          lo = tau;
+        else
+          hi = tau;
+
+        double tau_new = tau - f / df;
+        if (!(tau_new > lo && tau_new < hi)) tau_new = 0.5 * (lo + hi);
+
+        bool done = std::abs(tau_new - tau) <= 2.0 * eps * std::abs(tau_new)
+          || hi - lo <= 2.0 * eps * std::max(std::abs(lo), std::abs(hi));
+        tau = tau_new;
+        if (done) break;
+      }
+
+      return tau;
+    }
+
+    /**
+       @brief Compute the eigen-decomposition of the arrowhead matrix
+       [[diag(delta), z], [z^T, alpha]], where in the output basis the
+       apex row is inserted at position apex
+       @param[in] delta The diagonal entries, in any order
+       @param[in] z The couplings to the apex
+       @param[in] alpha The apex diagonal entry
+       @param[in] apex The row of the apex in the output basis
+       @param[out] arrow The eigen-decomposition
+    */
+    void solveArrowhead(const VectorXd &delta, const VectorXd &z, double alpha, int apex, Arrowhead &arrow)
+    {
+      constexpr double eps = std::numeric_limits<double>::epsilon();
+      const int n_d = delta.size();
+      const int n = n_d + 1;
+
+      double norm = std::max(std::abs(alpha), z.norm());
+      if (n_d > 0) norm = std::max(norm, delta.cwiseAbs().maxCoeff());
+      const double tol = 8.0 * eps * norm;
+
+      // sort the poles
+      std::vector<int> perm(n_d);
+      std::iota(perm.begin(), perm.end(), 0);
+      std::sort(perm.begin(), perm.end(), [&](int a, int b) { return delta[a] < delta[b]; });
+      std::vector<double> d(n_d);
+      std::vector<double> w(n_d);
+      for (int i = 0; i < n_d; i++) {
+        d[i] = delta[perm[i]];
+        w[i] = z[perm[i]];
+      }
+
+      // deflate negligible couplings, and rotate away the coupling of
+      // one of each pair of coincident poles
+      struct Rotation {
+        int a;
+        int b;
+        double c;
+        double s;
+      };
+      std::vector<Rotation> rotations;
+      std::vector<char> deflate(n_d, 0);
+      int last = -1;
+      for (int i = 0; i < n_d; i++) {
+        if (std::abs(w[i]) <= tol) {
+          deflate[i] = 1;
+          continue;
+        }
+        if (last >= 0 && d[i] - d[last] <= tol) {
+          double r = std::hypot(w[last], w[i]);
+          rotations.push_back({last, i, w[i] / r, w[last] / r});
+          w[i] = r;
+          w[last] = 0.0;
+          deflate[last] = 1;
+        }
+        last = i;
+      }
+
+      std::vector<int> idx;
+      for (int i = 0; i < n_d; i++)
+        if (!deflate[i]) idx.push_back(i);
+      const int k = idx.size();
+
+      // the k + 1 secular roots: root j lies between poles j - 1 and
+      // j, and each is stored relative to its nearest pole
+      std::vector<int> origin(k + 1, 0);
+      std::vector<double> tau(k + 1, alpha);
+      std::vector<double> lambda(k + 1, alpha);
+
+      if (k > 0) {
+        double z_norm = 0.0;
+        for (auto i : idx) z_norm += w[i] * w[i];
+        z_norm = std::sqrt(z_norm);
+        const double lower = std::min(d[idx[0]], alpha) - z_norm;
+        const double upper = std::max(d[idx[k - 1]], alpha) + z_norm;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+        for (int j = 0; j <= k; j++) {
+          int o;
+          double lo, hi;
+          if (j == 0) {
+            o = 0;
+            lo = lower - d[idx[0]];
+            hi = 0.0;
+          } else if (j == k) {
+            o = k - 1;
+            lo = 0.0;
+            hi = upper - d[idx[k - 1]];
+          } else {
+            // the sign of f at the mid point tells us which pole is nearest
+            double mid = 0.5 * (d[idx[j - 1]] + d[idx[j]]);
+            double f = alpha - mid;
+            for (int i = 0; i < k; i++) f -= w[idx[i]] * w[idx[i]] / (d[idx[i]] - mid);
+            if (f >= 0.0) {
+              o = j;
+              lo = mid - d[idx[j]];
+              hi = 0.0;
+            } else {
+              o = j - 1;
+              lo = 0.0;
+              hi = mid - d[idx[j - 1]];
+            }
+          }
+
+          std::vector<double> d_shift(k);
+          std::vector<double> z2(k);
+          for (int i = 0; i < k; i++) {
+            d_shift[i] = d[idx[i]] - d[idx[o]];
+            z2[i] = w[idx[i]] * w[idx[i]];
+          }
+
+          origin[j] = o;
+          tau[j] = secularRoot(d_shift, z2, alpha - d[idx[o]], lo, hi);
+          lambda[j] = d[idx[o]] + tau[j];
+        }
+      }
+
+      // accurate difference between non-deflated pole i and root j
+      auto diff = [&](int i, int j) { return (d[idx[i]] - d[idx[origin[j]]]) - tau[j]; };
+
+      // recompute the couplings such that the computed roots are the
+      // exact eigenvalues of a nearby arrowhead matrix (Loewner)
+      std::vector<double> w_hat(k);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (int i = 0; i < k; i++) {
+        double prod = diff(i, i) * diff(i, i + 1);
+        for (int l = 0; l < i; l++) prod *= diff(i, l) / (d[idx[i]] - d[idx[l]]);
+        for (int l = i + 1; l < k; l++) prod *= diff(i, l + 1) / (d[idx[i]] - d[idx[l]]);
+        w_hat[i] = std::copysign(std::sqrt(std::max(-prod, 0.0)), w[idx[i]]);
+      }
+
+      // order the deflated poles and secular roots together: a
+      // negative source denotes deflated pole -(source + 1)
+      std::vector<std::pair<double, int>> order;
+      order.reserve(n);
+      for (int i = 0; i < n_d; i++)
+        if (deflate[i]) order.push_back({d[i], -(i + 1)});
+      for (int j = 0; j <= k; j++) order.push_back({lambda[j], j});
+      std::stable_sort(order.begin(), order.end(),
+                       [](const std::pair<double, int> &a, const std::pair<double, int> &b) { return a.first < b.first; });
+
+      arrow.evals.resize(n);
+      arrow.evecs.resize(n, n);
+      arrow.deflated.resize(n);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (int c = 0; c < n; c++) {
+        // eigenvector in the basis of sorted (and rotated) poles, with the apex last
+        std::vector<double> v(n, 0.0);
+        int source = order[c].second;
+        if (source < 0) {
+          v[-(source + 1)] = 1.0;
+        } else {
+          double norm2 = 1.0;
+          v[n_d] = 1.0;
+          for (int i = 0; i < k; i++) {
+            v[idx[i]] = -w_hat[i] / diff(i, source);
+            norm2 += v[idx[i]] * v[idx[i]];
+          }
+          double inv_norm = 1.0 / std::sqrt(norm2);
+          for (auto &v_i : v) v_i *= inv_norm;
+        }
+
+        // undo the rotations
+        for (auto r = rotations.rbegin(); r != rotations.rend(); r++) {
+          double y_a = v[r->a];
+          double y_b = v[r->b];
+          v[r->a] = r->c * y_a + r->s * y_b;
+          v[r->b] = -r->s * y_a + r->c * y_b;
+        }
+
+        // undo the sort and insert the apex
+        for (int i = 0; i < n_d; i++) arrow.evecs(perm[i] < apex ? perm[i] : perm[i] + 1, c) = v[i];
+        arrow.evecs(apex, c) = v[n_d];
+        arrow.evals[c] = order[c].first;
+        arrow.deflated[c] = source < 0;
+      }
+    }
+
+    /**
+       @brief Form the eigenvectors of a matrix from the
+       eigen-decomposition of its arrowhead form and the
+       eigen-decompositions of the blocks above and below the apex
+       @param[out] evecs The first n_vec eigenvectors
+       @param[in] arrow_evecs Eigenvectors of the arrowhead matrix
+       @param[in] deflated Which arrowhead eigenvectors are sparse
+       @param[in] left Eigenvectors of the block above the apex (nullptr if diagonal)
+       @param[in] right Eigenvectors of the block below the apex
+       @param[in] n_left Size of the block above the apex
+       @param[in] n_vec The number of eigenvectors to form
+    */
+    void formEigenvectors(MatrixXd &evecs, const Ref<const MatrixXd> &arrow_evecs, const std::vector<char> &deflated,
+                          const Ref<const MatrixXd> *left, const Ref<const MatrixXd> &right, int n_left, int n_vec)
+    {
+      const int n = arrow_evecs.rows();
+      const int n_right = n - n_left - 1;
+      evecs.resize(n, n_vec);
+
+      std::vector<int> dense;
+      std::vector<int> sparse;
+      for (int c = 0; c < n_vec; c++) (deflated[c] ? sparse : dense).push_back(c);
+
+      // dense eigenvectors are formed with matrix products
+      if (dense.size() > 0) {
+        MatrixXd W(n, dense.size());
+        for (auto j = 0u; j < dense.size(); j++) W.col(j) = arrow_evecs.col(dense[j]);
+        MatrixXd top = left ? MatrixXd((*left) * W.topRows(n_left)) : MatrixXd(W.topRows(n_left));
+        MatrixXd bottom = right * W.bottomRows(n_right);
+        for (auto j = 0u; j < dense.size(); j++) {
+          evecs.col(dense[j]).head(n_left) = top.col(j);
+          evecs(n_left, dense[j]) = W(n_left, j);
+          evecs.col(dense[j]).tail(n_right) = bottom.col(j);
+        }
+      }
+
+      // deflated eigenvectors only have a few non-zero components
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (int s = 0; s < static_cast<int>(sparse.size()); s++) {
+        const int c = sparse[s];
+        evecs.col(c).setZero();
+        for (int r = 0; r < n_left; r++) {
+          if (arrow_evecs(r, c) == 0.0) continue;
+          if (left)
+            evecs.col(c).head(n_left) += arrow_evecs(r, c) * left->col(r);
+          else
+            evecs(r, c) += arrow_evecs(r, c);
+        }
+        evecs(n_left, c) = arrow_evecs(n_left, c);
+        for (int r = 0; r < n_right; r++) {
+          if (arrow_evecs(n_left + 1 + r, c) == 0.0) continue;
+          evecs.col(c).tail(n_right) += arrow_evecs(n_left + 1 + r, c) * right.col(r);
+        }
+      }
+    }
+
+    /**
+       @brief Compute the eigen-decomposition of a symmetric tridiagonal
+       matrix by divide and conquer
+       @param[in] d The diagonal, of length n
+       @param[in] e The sub-diagonal, of length n - 1
+       @param[in] n The matrix dimension
+       @param[out] evals The eigenvalues in ascending order
+       @param[out] evecs The eigenvectors
+    */
+    void tridiagonalEigensolve(const double *d, const double *e, int n, VectorXd &evals, MatrixXd &evecs)
+    {
+      if (n == 0) {
+        evals.resize(0);
+        evecs.resize(0, 0);
+        return;
+      } else if (n <= arrow_base_size) {
+        VectorXd diag = Map<const VectorXd>(d, n);
+        VectorXd sub = n > 1 ? VectorXd(Map<const VectorXd>(e, n - 1)) : VectorXd::Zero(0);
+        SelfAdjointEigenSolver<MatrixXd> solver;
+        solver.computeFromTridiagonal(diag, sub, ComputeEigenvectors);
+        evals = solver.eigenvalues();
+        evecs = solver.eigenvectors();
+        return;
+      }
+
+      // split about the middle row, which becomes the apex
+      const int m = n / 2;
+      VectorXd evals_l, evals_r;
+      MatrixXd evecs_l, evecs_r;
+      tridiagonalEigensolve(d, e, m, evals_l, evecs_l);
+      tridiagonalEigensolve(d + m + 1, e + m + 1, n - m - 1, evals_r, evecs_r);
+
+      VectorXd delta(n - 1);
+      VectorXd z(n - 1);
+      delta << evals_l, evals_r;
+      z << e[m - 1] * evecs_l.row(m - 1).transpose(), e[m] * evecs_r.row(0).transpose();
+
+      Arrowhead arrow;
+      solveArrowhead(delta, z, d[m], m, arrow);
+
+      evals = arrow.evals;
+      Ref<const MatrixXd> left(evecs_l);
+      formEigenvectors(evecs, arrow.evecs, arrow.deflated, &left, evecs_r, m, n);
+    }
+
+  } // namespace
+
+  void ArrowEigensolver::compute(const double *diag, const double *offdiag, int dim, int arrow_pos)
+  {
+    if (dim <= 0) errorQuda("Invalid dimension %d", dim);
+    if (arrow_pos >= dim) errorQuda("Invalid arrow position %d for dimension %d", arrow_pos, dim);
+
+    // the outermost apex is the arrow, or the middle row if there is no arrow
+    const int apex = arrow_pos > 0 ? arrow_pos : dim / 2;
+    const int n_right = dim - apex - 1;
+    this->dim = dim;
+    n_left = apex;
+    left_diagonal = arrow_pos > 0;
+
+    VectorXd evals_l, evals_r;
+    MatrixXd evecs_l, evecs_r;
+    if (left_diagonal)
+      evals_l = Map<const VectorXd>(diag, n_left);
+    else
+      tridiagonalEigensolve(diag, offdiag, n_left, evals_l, evecs_l);
+    tridiagonalEigensolve(diag + apex + 1, offdiag + apex + 1, n_right, evals_r, evecs_r);
+
+    VectorXd delta(dim - 1);
+    VectorXd z(dim - 1);
+    delta.head(n_left) = evals_l;
+    delta.tail(n_right) = evals_r;
+    if (left_diagonal)
+      z.head(n_left) = Map<const VectorXd>(offdiag, n_left);
+    else if (n_left > 0)
+      z.head(n_left) = offdiag[apex - 1] * evecs_l.row(n_left - 1).transpose();
+    if (n_right > 0) z.tail(n_right) = offdiag[apex] * evecs_r.row(0).transpose();
+
+    Arrowhead arrow;
+    solveArrowhead(delta, z, diag[apex], apex, arrow);
+
+    evals.assign(arrow.evals.data(), arrow.evals.data() + dim);
+
+    // the last row is all we need of the eigenvectors to compute the residua
+    last_row.resize(dim);
+    Map<VectorXd> last(last_row.data(), dim);
+    if (n_right > 0)
+      last = (evecs_r.row(n_right - 1) * arrow.evecs.bottomRows(n_right)).transpose();
+    else
+      last = arrow.evecs.row(apex).transpose();
+
+    left_evecs.assign(evecs_l.data(), evecs_l.data() + evecs_l.size());
+    right_evecs.assign(evecs_r.data(), evecs_r.data() + evecs_r.size());
+    arrow_evecs.assign(arrow.evecs.data(), arrow.evecs.data() + arrow.evecs.size());
+  }
+
+  void ArrowEigensolver::eigenvectors(double *evecs, int n_vec) const
+  {
+    if (n_vec < 0 || n_vec > dim) errorQuda("Invalid number of eigenvectors %d for dimension %d", n_vec, dim);
+    const int n_right = dim - n_left - 1;
+
+    Map<const MatrixXd> arrow(arrow_evecs.data(), dim, dim);
+    Map<const MatrixXd> left(left_evecs.data(), n_left, left_diagonal ? 0 : n_left);
+    Map<const MatrixXd> right(right_evecs.data(), n_right, n_right);
+    Ref<const MatrixXd> left_ref(left);
+
+    MatrixXd V;
+    formEigenvectors(V, arrow, std::vector<char>(dim, 0), left_diagonal ? nullptr : &left_ref, right, n_left, n_vec);
+    Map<MatrixXd>(evecs, dim, n_vec) = V;
+  }
+
+} // namespace quda
@@ -129,6 +129,7 @@ void printQudaGaugeParam(QudaGaugeParam *param) {
   P(gauge_offset, 0);
   P(mom_offset, 0);
   P(site_size, 0);
+  P(cache_site_gauge, 1);
 #else
   P(overwrite_mom, INVALID_INT);
   P(use_resident_gauge, INVALID_INT);
@@ -140,6 +141,7 @@ void printQudaGaugeParam(QudaGaugeParam *param) {
   P(gauge_offset, (size_t)INVALID_INT);
   P(mom_offset, (size_t)INVALID_INT);
   P(site_size, (size_t)INVALID_INT);
+  P(cache_site_gauge, INVALID_INT);
 #endif
 
 #ifdef INIT_PARAM
@@ -405,6 +407,7 @@ void printQudaInvertParam(QudaInvertParam *param) {
 #ifdef INIT_PARAM
   P(use_alternative_reliable, 0); /**< Default is to not use alternative relative updates, e.g., use delta to determine reliable trigger */
   P(use_sloppy_partial_accumulator, 0); /**< Default is to use a high-precision accumulator (not yet supported in all solvers) */
+  P(use_adaptive_precision, 0); /**< Default is to keep the sloppy precision fixed */
   P(solution_accumulator_pipeline, 1); /**< Default is solution accumulator depth of 1 */
   P(max_res_increase, 1); /**< Default is to allow one consecutive residual increase */
   P(max_res_increase_total, 10); /**< Default is to allow ten residual increase */
@@ -414,6 +417,7 @@ void printQudaInvertParam(QudaInvertParam *param) {
  #else
   P(use_alternative_reliable, INVALID_INT);
   P(use_sloppy_partial_accumulator, INVALID_INT);
+  P(use_adaptive_precision, INVALID_INT);
   P(solution_accumulator_pipeline, INVALID_INT);
   P(max_res_increase, INVALID_INT);
   P(max_res_increase_total, INVALID_INT);
@@ -585,7 +589,8 @@ void printQudaInvertParam(QudaInvertParam *param) {
 #else
   if (param->inv_type == QUDA_CA_CG_INVERTER ||
       param->inv_type == QUDA_CA_CGNE_INVERTER ||
-      param->inv_type == QUDA_CA_CGNR_INVERTER) {
+      param->inv_type == QUDA_CA_CGNR_INVERTER ||
+      param->inv_type == QUDA_CA_GCR_INVERTER) {
     P(ca_basis, QUDA_INVALID_BASIS);
     if (param->ca_basis == QUDA_CHEBYSHEV_BASIS) {
       P(ca_lambda_min, INVALID_DOUBLE);
@@ -757,6 +762,11 @@ void printQudaMultigridParam(QudaMultigridParam *param) {
 #else
     P(num_setup_iter[i], INVALID_INT);
 #endif
+#ifdef INIT_PARAM
+    P(setup_batch_size[i], 1);
+#else
+    P(setup_batch_size[i], INVALID_INT);
+#endif
 #ifdef INIT_PARAM
     P(use_eig_solver[i], QUDA_BOOLEAN_FALSE);
 #else
@@ -802,19 +812,28 @@ void printQudaMultigridParam(QudaMultigridParam *param) {
     P(coarse_solver_ca_basis_size[i], 4);
     P(coarse_solver_ca_lambda_min[i], 0.0);
     P(coarse_solver_ca_lambda_max[i], -1.0);
+    P(coarse_solver_agglomerate_volume[i], 0);
+    P(coarse_solver_async[i], QUDA_BOOLEAN_FALSE);
+    P(coarse_solver_async_threads[i], 0);
 #else
     P(coarse_solver_ca_basis[i], QUDA_INVALID_BASIS);
     P(coarse_solver_ca_basis_size[i], INVALID_INT);
     P(coarse_solver_ca_lambda_min[i], INVALID_DOUBLE);
     P(coarse_solver_ca_lambda_max[i], INVALID_DOUBLE);
+    P(coarse_solver_agglomerate_volume[i], INVALID_INT);
+    P(coarse_solver_async[i], QUDA_BOOLEAN_INVALID);
+    P(coarse_solver_async_threads[i], INVALID_INT);
 #endif
 
 #ifndef CHECK_PARAM
     P(smoother_halo_precision[i], QUDA_INVALID_PRECISION);
+    P(block_float_precision[i], QUDA_INVALID_PRECISION);
     P(smoother_schwarz_type[i], QUDA_INVALID_SCHWARZ);
     P(smoother_schwarz_cycle[i], 1);
+    P(smoother_schwarz_block[i], 2);
 #else
     P(smoother_schwarz_cycle[i], INVALID_INT);
+    P(smoother_schwarz_block[i], INVALID_INT);
 #endif
 
     // these parameters are not set for the bottom grid
@@ -939,6 +958,30 @@ void printQudaMultigridParam(QudaMultigridParam *param) {
   P(thin_update_only, QUDA_BOOLEAN_INVALID);
 #endif
 
+#ifdef INIT_PARAM
+  P(incremental_refresh, QUDA_BOOLEAN_FALSE);
+  P(incremental_refresh_gauge_change, 0.1);
+  P(incremental_refresh_transfer_tol, 1e-2);
+#else
+  P(incremental_refresh, QUDA_BOOLEAN_INVALID);
+  P(incremental_refresh_gauge_change, INVALID_DOUBLE);
+  P(incremental_refresh_transfer_tol, INVALID_DOUBLE);
+#endif
+
+#ifdef CHECK_PARAM
+  // the refresh iterations are scaled by the ratio of the gauge-field change to this
+  if (param->incremental_refresh == QUDA_BOOLEAN_TRUE && param->incremental_refresh_gauge_change <= 0.0)
+    errorQuda("incremental_refresh_gauge_change = %e must be positive", param->incremental_refresh_gauge_change);
+#endif
+
+#ifdef INIT_PARAM
+  P(hierarchy_load, QUDA_BOOLEAN_FALSE);
+  P(hierarchy_store, QUDA_BOOLEAN_FALSE);
+#else
+  P(hierarchy_load, QUDA_BOOLEAN_INVALID);
+  P(hierarchy_store, QUDA_BOOLEAN_INVALID);
+#endif
+
 #ifdef INIT_PARAM
   return ret;
 #endif
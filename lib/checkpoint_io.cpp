@@ -0,0 +1,136 @@
+#include <cstring>
+#include <color_spinor_field.h>
+#include <gauge_field.h>
+#include <comm_quda.h>
+#include <checkpoint_io.h>
+
+namespace quda
+{
+
+  namespace
+  {
+    constexpr char checkpoint_magic[8] = {'Q', 'U', 'D', 'A', 'C', 'K', 'P', 'T'};
+    constexpr int checkpoint_version = 1;
+
+    struct CheckpointHeader {
+      char magic[8];
+      int version;
+      int comm_size;
+      uint64_t checksum;
+    };
+
+    std::string rank_filename(const std::string &filename)
+    {
+      return filename + "_rank_" + std::to_string(comm_rank());
+    }
+  } // namespace
+
+  CheckpointIO::CheckpointIO(const std::string &filename, bool write, uint64_t checksum) :
+    filename(rank_filename(filename)), write(write), checksum(checksum), fp(nullptr)
+  {
+    if (filename.size() == 0) errorQuda("No checkpoint filename defined");
+
+    fp = fopen(this->filename.c_str(), write ? "wb" : "rb");
+    if (!fp) errorQuda("Unable to open checkpoint file %s for %s", this->filename.c_str(), write ? "writing" : "reading");
+
+    CheckpointHeader header;
+    if (write) {
+      memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+      header.version = checkpoint_version;
+      header.comm_size = comm_size();
+      header.checksum = checksum;
+      write_bytes(&header, sizeof(header));
+    } else {
+      read_bytes(&header, sizeof(header));
+      if (memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) != 0)
+        errorQuda("File %s is not a checkpoint file", this->filename.c_str());
+      if (header.version != checkpoint_version)
+        errorQuda("Checkpoint %s version %d does not match expected %d", this->filename.c_str(), header.version,
+                  checkpoint_version);
+      if (header.comm_size != static_cast<int>(comm_size()))
+        errorQuda("Checkpoint %s was written with %d processes, running with %lu", this->filename.c_str(),
+                  header.comm_size, comm_size());
+      this->checksum = header.checksum;
+    }
+  }
+
+  CheckpointIO::~CheckpointIO()
+  {
+    if (fp) fclose(fp);
+  }
+
+  bool CheckpointIO::valid(const std::string &filename, uint64_t checksum)
+  {
+    if (filename.size() == 0) return false;
+    FILE *fp = fopen(rank_filename(filename).c_str(), "rb");
+    if (!fp) return false;
+
+    CheckpointHeader header;
+    bool valid = fread(&header, sizeof(header), 1, fp) == 1;
+    fclose(fp);
+
+    return valid && memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) == 0
+      && header.version == checkpoint_version && header.comm_size == static_cast<int>(comm_size())
+      && header.checksum == checksum;
+  }
+
+  void CheckpointIO::write_bytes(const void *data, size_t bytes)
+  {
+    if (!write) errorQuda("Checkpoint %s opened for reading", filename.c_str());
+    if (bytes > 0 && fwrite(data, bytes, 1, fp) != 1)
+      errorQuda("Failed to write %lu bytes to checkpoint %s", bytes, filename.c_str());
+  }
+
+  void CheckpointIO::read_bytes(void *data, size_t bytes)
+  {
+    if (write) errorQuda("Checkpoint %s opened for writing", filename.c_str());
+    if (bytes > 0 && fread(data, bytes, 1, fp) != 1)
+      errorQuda("Failed to read %lu bytes from checkpoint %s", bytes, filename.c_str());
+  }
+
+  void CheckpointIO::save(const void *data, size_t bytes)
+  {
+    uint64_t size = bytes;
+    write_bytes(&size, sizeof(size));
+    write_bytes(data, bytes);
+  }
+
+  void CheckpointIO::load(void *data, size_t bytes)
+  {
+    uint64_t size;
+    read_bytes(&size, sizeof(size));
+    if (size != bytes)
+      errorQuda("Checkpoint %s record size %lu does not match expected %lu", filename.c_str(), size, bytes);
+    read_bytes(data, bytes);
+  }
+
+  template <class Field> void CheckpointIO::save_field(const Field &field, size_t bytes)
+  {
+    void *buffer = pinned_malloc(bytes);
+    field.copy_to_buffer(buffer);
+    double scale = field.Scale();
+    write_bytes(&scale, sizeof(scale));
+    save(buffer, bytes);
+    host_free(buffer);
+  }
+
+  template <class Field> void CheckpointIO::load_field(Field &field, size_t bytes)
+  {
+    void *buffer = pinned_malloc(bytes);
+    double scale;
+    read_bytes(&scale, sizeof(scale));
+    load(buffer, bytes);
+    field.Scale(scale);
+    field.copy_from_buffer(buffer);
+    host_free(buffer);
+  }
+
+  void CheckpointIO::save(const ColorSpinorField &field) { save_field(field, field.TotalBytes()); }
+
+  void CheckpointIO::load(ColorSpinorField &field) { load_field(field, field.TotalBytes()); }
+
+  void CheckpointIO::save(const GaugeField &field) { save_field(field, field.TotalBytes()); }
+
+  void CheckpointIO::load(GaugeField &field) { load_field(field, field.TotalBytes()); }
+
+} // namespace quda
@@ -42,6 +42,9 @@ namespace quda {
     } else if (u.Order() == QUDA_MILC_GAUGE_ORDER) {
       ChecksumArg<T,QUDA_MILC_GAUGE_ORDER,Nc> arg(u,mini);
       checksum = ChecksumCPU(arg);
+    } else if (u.Order() == QUDA_MILC_SITE_GAUGE_ORDER) {
+      ChecksumArg<T,QUDA_MILC_SITE_GAUGE_ORDER,Nc> arg(u,mini);
+      checksum = ChecksumCPU(arg);
     } else if (u.Order() == QUDA_BQCD_GAUGE_ORDER) {
       ChecksumArg<T,QUDA_BQCD_GAUGE_ORDER,Nc> arg(u,mini);
       checksum = ChecksumCPU(arg);
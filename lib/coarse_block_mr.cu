@@ -0,0 +1,179 @@
+#include <gauge_field.h>
+#include <color_spinor_field.h>
+#include <tunable_nd.h>
+#include <index_helper.cuh>
+#include <kernels/coarse_block_mr.cuh>
+
+namespace quda
+{
+
+#ifdef GPU_MULTIGRID
+
+  template <typename Float, typename yFloat, int nSpin, int nColor> class CoarseBlockMRLaunch : public TunableKernel1D
+  {
+    using Arg = CoarseBlockMRArg<Float, yFloat, nSpin, nColor>;
+    Arg arg;
+    const ColorSpinorField &meta;
+    const GaugeField &Y;
+    const GaugeField &X;
+
+    unsigned int minThreads() const { return arg.threads.x; }
+
+  public:
+    CoarseBlockMRLaunch(ColorSpinorField &x, const ColorSpinorField &b, const GaugeField &Y, const GaugeField &X,
+                        double kappa, int block, int n_iter, double omega) :
+      TunableKernel1D(x),
+      arg(x, b, Y, X, kappa, block, n_iter, omega),
+      meta(x),
+      Y(Y),
+      X(X)
+    {
+      char aux2[TuneKey::aux_n];
+      strcat(aux, ",block=");
+      u32toa(aux2, block);
+      strcat(aux, aux2);
+      strcat(aux, ",n_iter=");
+      u32toa(aux2, n_iter);
+      strcat(aux, aux2);
+      strcat(aux, getOmpThreadStr());
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      launch_host<CoarseBlockMR>(tp, stream, arg);
+    }
+
+    void preTune() { meta.backup(); }
+    void postTune() { meta.restore(); }
+
+    long long flops() const
+    {
+      // each iteration is one block-restricted application plus the MR update
+      constexpr long long n = nSpin * nColor;
+      return arg.n_iter * (9 * 8 * n * n + 20 * n) * meta.Volume();
+    }
+
+    long long bytes() const
+    {
+      // the block working set stays in cache, so only the initial gather and final store touch memory
+      return 2 * meta.Bytes() + Y.Bytes() / 2 + X.Bytes();
+    }
+  };
+
+  template <typename Float, typename yFloat, int nSpin>
+  void ApplyCoarseBlockMR(ColorSpinorField &x, const ColorSpinorField &b, const GaugeField &Y, const GaugeField &X,
+                          double kappa, int block, int n_iter, double omega)
+  {
+    switch (x.Ncolor()) {
+    case 24: CoarseBlockMRLaunch<Float, yFloat, nSpin, 24>(x, b, Y, X, kappa, block, n_iter, omega); break;
+#ifdef NSPIN4
+    case 6: CoarseBlockMRLaunch<Float, yFloat, nSpin, 6>(x, b, Y, X, kappa, block, n_iter, omega); break;
+    case 32: CoarseBlockMRLaunch<Float, yFloat, nSpin, 32>(x, b, Y, X, kappa, block, n_iter, omega); break;
+#endif
+#ifdef NSPIN1
+    case 64: CoarseBlockMRLaunch<Float, yFloat, nSpin, 64>(x, b, Y, X, kappa, block, n_iter, omega); break;
+    case 96: CoarseBlockMRLaunch<Float, yFloat, nSpin, 96>(x, b, Y, X, kappa, block, n_iter, omega); break;
+#endif
+    default: errorQuda("Unsupported number of coarse colors %d", x.Ncolor());
+    }
+  }
+
+  void ApplyCoarseBlockMR(ColorSpinorField &x, const ColorSpinorField &b, const GaugeField &Y, const GaugeField &X,
+                          double kappa, int block, int n_iter, double omega)
+  {
+    if (checkLocation(x, b, Y, X) != QUDA_CPU_FIELD_LOCATION)
+      errorQuda("Block-Jacobi smoothing is only supported on CPU-located levels");
+    if (x.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER || b.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER
+        || Y.FieldOrder() != QUDA_QDP_GAUGE_ORDER || X.FieldOrder() != QUDA_QDP_GAUGE_ORDER)
+      errorQuda("Unsupported field order colorspinor=%d gauge=%d combination", x.FieldOrder(), Y.FieldOrder());
+    if (x.SiteSubset() != QUDA_FULL_SITE_SUBSET) errorQuda("Block-Jacobi smoothing requires full-parity fields");
+    if (x.Nspin() != 2) errorQuda("Unsupported number of coarse spins %d", x.Nspin());
+    for (int d = 0; d < 4; d++)
+      if (x.X(d) % block != 0) errorQuda("Block extent %d does not divide local dimension %d = %d", block, d, x.X(d));
+
+    QudaPrecision precision = checkPrecision(x, b);
+    if (precision == QUDA_DOUBLE_PRECISION) {
+#ifdef GPU_MULTIGRID_DOUBLE
+      if (Y.Precision() != QUDA_DOUBLE_PRECISION) errorQuda("Y Precision %d not supported", Y.Precision());
+      ApplyCoarseBlockMR<double, double, 2>(x, b, Y, X, kappa, block, n_iter, omega);
+#else
+      errorQuda("Double precision multigrid has not been enabled");
+#endif
+    } else if (precision == QUDA_SINGLE_PRECISION) {
+      if (Y.Precision() != QUDA_SINGLE_PRECISION) errorQuda("Y Precision %d not supported", Y.Precision());
+      ApplyCoarseBlockMR<float, float, 2>(x, b, Y, X, kappa, block, n_iter, omega);
+    } else {
+      errorQuda("Unsupported precision %d", precision);
+    }
+  }
+
+  template <typename Float, int nSpin, int nColor> void CoarseBlockMask(ColorSpinorField &x, int block, int block_idx)
+  {
+    colorspinor::FieldOrderCB<Float, nSpin, nColor, 1, QUDA_SPACE_SPIN_COLOR_FIELD_ORDER> A(x);
+
+    int block_coord[4];
+    for (int d = 0, idx = block_idx; d < 4; d++) {
+      block_coord[d] = idx % (x.X(d) / block);
+      idx /= x.X(d) / block;
+    }
+
+    for (int parity = 0; parity < 2; parity++) {
+      for (int x_cb = 0; x_cb < static_cast<int>(x.VolumeCB()); x_cb++) {
+        int coord[4];
+        getCoords(coord, x_cb, x.X(), parity);
+        bool inside = true;
+        for (int d = 0; d < 4; d++) inside = inside && (coord[d] / block == block_coord[d]);
+        if (inside) continue;
+        for (int s = 0; s < nSpin; s++)
+          for (int c = 0; c < nColor; c++) A(parity, x_cb, s, c) = 0.0;
+      }
+    }
+  }
+
+  template <typename Float> void CoarseBlockMask(ColorSpinorField &x, int block, int block_idx)
+  {
+    switch (x.Ncolor()) {
+    case 24: CoarseBlockMask<Float, 2, 24>(x, block, block_idx); break;
+#ifdef NSPIN4
+    case 6: CoarseBlockMask<Float, 2, 6>(x, block, block_idx); break;
+    case 32: CoarseBlockMask<Float, 2, 32>(x, block, block_idx); break;
+#endif
+#ifdef NSPIN1
+    case 64: CoarseBlockMask<Float, 2, 64>(x, block, block_idx); break;
+    case 96: CoarseBlockMask<Float, 2, 96>(x, block, block_idx); break;
+#endif
+    default: errorQuda("Unsupported number of coarse colors %d", x.Ncolor());
+    }
+  }
+
+  void CoarseBlockMask(ColorSpinorField &x, int block, int block_idx)
+  {
+    if (x.Location() != QUDA_CPU_FIELD_LOCATION || x.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER
+        || x.SiteSubset() != QUDA_FULL_SITE_SUBSET || x.Nspin() != 2)
+      errorQuda("Unsupported field location=%d order=%d subset=%d nSpin=%d", x.Location(), x.FieldOrder(),
+                x.SiteSubset(), x.Nspin());
+
+    if (x.Precision() == QUDA_DOUBLE_PRECISION) {
+      CoarseBlockMask<double>(x, block, block_idx);
+    } else if (x.Precision() == QUDA_SINGLE_PRECISION) {
+      CoarseBlockMask<float>(x, block, block_idx);
+    } else {
+      errorQuda("Unsupported precision %d", x.Precision());
+    }
+  }
+
+#else
+
+  void ApplyCoarseBlockMR(ColorSpinorField &, const ColorSpinorField &, const GaugeField &, const GaugeField &, double,
+                          int, int, double)
+  {
+    errorQuda("Multigrid has not been built");
+  }
+
+  void CoarseBlockMask(ColorSpinorField &, int, int) { errorQuda("Multigrid has not been built"); }
+
+#endif // GPU_MULTIGRID
+
+} // namespace quda
@@ -205,8 +205,8 @@ namespace quda {
       }
 
       if (type == COMPUTE_UV) {
+        // on the host the UV product is fused into the per-aggregate VUV computation, so only the max is needed here
         if (compute_max) launch_host<compute_uv>(tp, stream, ArgMax<Arg>(arg));
-        else launch_host<compute_uv>(tp, stream, arg);
       } else if (type == COMPUTE_AV) {
         if (from_coarse) errorQuda("compute_av should only be called from the fine grid");
 
@@ -237,10 +237,19 @@ namespace quda {
 #endif
 
       } else if (type == COMPUTE_VUV) {
-        launch_host<compute_vuv>(tp, stream, arg);
+        // partition over coarse aggregates so that each thread owns its coarse site
+        arg.threads.x = 2 * arg.coarseVolumeCB;
+        resizeVector(1, 1);
+        launch_host<compute_uv_vuv_aggregate>(tp, stream, arg);
+        arg.threads.x = minThreads();
+        resizeVector((arg.parity_flip ? 1 : 2) * arg.max_height_tiles_per_block, arg.max_width_tiles_per_block);
       } else if (type == COMPUTE_COARSE_CLOVER) {
 #if defined(WILSONCOARSE)
-        launch_host<compute_coarse_clover>(tp, stream, arg);
+        arg.threads.x = 2 * arg.coarseVolumeCB;
+        resizeVector(1, 1);
+        launch_host<compute_coarse_clover_aggregate>(tp, stream, arg);
+        arg.threads.x = minThreads();
+        resizeVector(2 * Arg::coarseColor, Arg::coarseColor);
 #else
         errorQuda("compute_coarse_clover not enabled for non-Wilson coarsenings");
 #endif
@@ -957,13 +966,14 @@ namespace quda {
         }
 
 	y.apply(device::get_default_stream());
-        if (getVerbosity() >= QUDA_VERBOSE) printfQuda("UV2[%d] = %e\n", d, arg.UV.norm2());
 
         // if we are writing to a temporary, we need to zero it before each computation
         if (Y_atomic.Geometry() == 1) Y_atomic_.zero();
 
         y.setComputeType(COMPUTE_VUV); // compute Y += VUV
         y.apply(device::get_default_stream());
+        // on the host UV is only formed during the VUV computation
+        if (getVerbosity() >= QUDA_VERBOSE) printfQuda("UV2[%d] = %e\n", d, arg.UV.norm2());
         if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
           printfQuda("Y2[%d] (atomic) = %e\n", 4+d, Y_atomic_.norm2((4+d) % arg.Y_atomic.geometry, coarseGaugeAtomic::fixedPoint()));
 
@@ -1027,13 +1037,13 @@ namespace quda {
       }
 
       y.apply(device::get_default_stream());
-      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("UAV2[%d] = %e\n", d, arg.UV.norm2());
 
       // if we are writing to a temporary, we need to zero it before each computation
       if (Y_atomic.Geometry() == 1) Y_atomic_.zero();
 
       y.setComputeType(COMPUTE_VUV); // compute Y += VUV
       y.apply(device::get_default_stream());
+      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("UAV2[%d] = %e\n", d, arg.UV.norm2());
       if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
         printfQuda("Y2[%d] (atomic) = %e\n", d, Y_atomic_.norm2(d%arg.Y_atomic.geometry, coarseGaugeAtomic::fixedPoint()));
 
@@ -1115,10 +1125,10 @@ namespace quda {
       }
 
       y.apply(device::get_default_stream());
-      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("CV2 = %e\n", arg.UV.norm2());
 
       y.setComputeType(COMPUTE_VUV); // compute X += VCV
       y.apply(device::get_default_stream());
+      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("CV2 = %e\n", arg.UV.norm2());
       if (getVerbosity() >= QUDA_VERBOSE)
         printfQuda("X2 (atomic) = %e\n", X_atomic_.norm2(0, coarseGaugeAtomic::fixedPoint()));
 
@@ -887,6 +887,73 @@ namespace quda {
     return fine;
   }
 
+  void copySlice(ColorSpinorField &out, const ColorSpinorField &in, int s)
+  {
+    // staggered fields are always 5-d with unit fifth dimension
+    const bool insert = out.Volume() > in.Volume();
+    const ColorSpinorField &mrhs = insert ? out : in;
+    const ColorSpinorField &field = insert ? in : out;
+
+    if (mrhs.Ndim() != 5 || (field.Ndim() == 5 && field.X(4) != 1))
+      errorQuda("Expected one multi-RHS and one 4-d field (out = %d-d, in = %d-d)", out.Ndim(), in.Ndim());
+    if (mrhs.PCType() != QUDA_4D_PC) errorQuda("Multi-RHS field must use 4-d preconditioning (pc_type = %d)", mrhs.PCType());
+    if (s < 0 || s >= mrhs.X(4)) errorQuda("Slice %d out of range [0, %d)", s, mrhs.X(4));
+    checkPrecision(out, in);
+    checkLocation(out, in);
+    checkOrder(out, in);
+    if (out.SiteSubset() != in.SiteSubset())
+      errorQuda("Site subsets %d %d do not match", out.SiteSubset(), in.SiteSubset());
+    if (mrhs.VolumeCB() != field.VolumeCB() * mrhs.X(4))
+      errorQuda("Multi-RHS volume %lu does not match %d x %lu", mrhs.VolumeCB(), mrhs.X(4), field.VolumeCB());
+
+    if (out.SiteSubset() == QUDA_FULL_SITE_SUBSET) {
+      copySlice(out.Even(), in.Even(), s);
+      copySlice(out.Odd(), in.Odd(), s);
+      return;
+    }
+
+    const size_t volume_4d_cb = field.VolumeCB();
+    const size_t site_length = 2 * out.Ncolor() * out.Nspin();
+
+    // native fields are stored as [site_length / N][stride][N], so each
+    // chunk of N reals is a separate row of the copy; site-ordered host
+    // fields are stored as [stride][site_length] and need only one row
+    size_t N = 0;
+    switch (out.FieldOrder()) {
+    case QUDA_FLOAT2_FIELD_ORDER:
+    case QUDA_FLOAT4_FIELD_ORDER:
+    case QUDA_FLOAT8_FIELD_ORDER: N = out.FieldOrder(); break;
+    case QUDA_SPACE_SPIN_COLOR_FIELD_ORDER:
+    case QUDA_SPACE_COLOR_SPIN_FIELD_ORDER: N = site_length; break;
+    default: errorQuda("Unsupported field order %d", out.FieldOrder());
+    }
+
+    const size_t width = volume_4d_cb * N * out.Precision();
+    const size_t height = site_length / N;
+    const size_t mrhs_pitch = mrhs.Stride() * N * out.Precision();
+    const size_t field_pitch = field.Stride() * N * out.Precision();
+    const size_t slice_offset = s * width;
+
+    if (insert) {
+      qudaMemcpy2DAsync(static_cast<char *>(out.V()) + slice_offset, mrhs_pitch, in.V(), field_pitch, width, height,
+                        qudaMemcpyDefault, device::get_default_stream());
+    } else {
+      qudaMemcpy2DAsync(out.V(), field_pitch, static_cast<const char *>(in.V()) + slice_offset, mrhs_pitch, width, height,
+                        qudaMemcpyDefault, device::get_default_stream());
+    }
+
+    if (out.Precision() == QUDA_HALF_PRECISION || out.Precision() == QUDA_QUARTER_PRECISION) {
+      const size_t norm_bytes = volume_4d_cb * sizeof(float);
+      if (insert) {
+        qudaMemcpyAsync(static_cast<char *>(out.Norm()) + s * norm_bytes, in.Norm(), norm_bytes, qudaMemcpyDefault,
+                        device::get_default_stream());
+      } else {
+        qudaMemcpyAsync(out.Norm(), static_cast<const char *>(in.Norm()) + s * norm_bytes, norm_bytes, qudaMemcpyDefault,
+                        device::get_default_stream());
+      }
+    }
+  }
+
   std::ostream& operator<<(std::ostream &out, const ColorSpinorField &a) {
     out << "typedid = " << typeid(a).name() << std::endl;
     out << "nColor = " << a.nColor << std::endl;
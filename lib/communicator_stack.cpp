@@ -51,6 +51,8 @@ void push_communicator(const quda::CommKey &split_key)
   current_key = split_key;
 }
 
+quda::CommKey get_current_comm_key() { return current_key; }
+
 int comm_neighbor_rank(int dir, int dim) { return get_current_communicator().comm_neighbor_rank(dir, dim); }
 
 int comm_dim(int dim) { return get_current_communicator().comm_dim(dim); }
@@ -60,11 +60,18 @@ namespace quda
     }
   };
 
+  // declaration for coarse-grid fields - defined in copy_field_offset_mg.cu
+  void copyFieldOffsetMG(ColorSpinorField &out, const ColorSpinorField &in, CommKey offset, QudaPCType pc_type);
+
   void copyFieldOffset(ColorSpinorField &out, const ColorSpinorField &in, CommKey offset, QudaPCType pc_type)
   {
     checkPrecision(out, in);
     checkLocation(out, in); // check all locations match
-    instantiate<CopyColorSpinorOffset>(out, in, offset, pc_type);
+    if (in.Ncolor() == 3) {
+      instantiate<CopyColorSpinorOffset>(out, in, offset, pc_type);
+    } else {
+      copyFieldOffsetMG(out, in, offset, pc_type);
+    }
   }
 
 } // namespace quda
@@ -0,0 +1,154 @@
+#include <color_spinor_field.h>
+#include <color_spinor_field_order.h>
+#include <gauge_field.h>
+#include <gauge_field_order.h>
+#include "copy_field_offset.hpp"
+
+namespace quda
+{
+
+#ifdef GPU_MULTIGRID
+
+  template <class Field, class Element, class F>
+  void copy_field_offset_mg(Field &out, const Field &in, CommKey offset, QudaPCType pc_type)
+  {
+    if (pc_type != QUDA_4D_PC) errorQuda("Coarse-grid fields must use 4d even-odd preconditioning");
+    F out_accessor(out);
+    F in_accessor(in);
+    CopyFieldOffsetArg<Field, Element, F> arg(out_accessor, out, in_accessor, in, offset);
+    CopyFieldOffset<decltype(arg)> copier(arg, in);
+  }
+
+  template <typename Float, int nColor>
+  void copyColorSpinorOffsetMG(ColorSpinorField &out, const ColorSpinorField &in, CommKey offset, QudaPCType pc_type)
+  {
+    constexpr int nSpin = 2;
+    using Field = ColorSpinorField;
+    using real = typename mapper<Float>::type;
+    using Element = ColorSpinor<real, nColor, nSpin>;
+
+    if (in.Location() == QUDA_CPU_FIELD_LOCATION) {
+      if (in.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER) errorQuda("Unsupported field order = %d", in.FieldOrder());
+      using F = typename colorspinor_order_mapper<Float, QUDA_SPACE_SPIN_COLOR_FIELD_ORDER, nSpin, nColor>::type;
+      copy_field_offset_mg<Field, Element, F>(out, in, offset, pc_type);
+    } else {
+      if (!in.isNative() || !out.isNative()) errorQuda("CUDA field has be in native order");
+      using F = typename colorspinor_mapper<Float, nSpin, nColor>::type;
+      copy_field_offset_mg<Field, Element, F>(out, in, offset, pc_type);
+    }
+  }
+
+  template <typename Float>
+  void copyColorSpinorOffsetMG(ColorSpinorField &out, const ColorSpinorField &in, CommKey offset, QudaPCType pc_type)
+  {
+    if (in.Nspin() != 2) errorQuda("Unsupported nSpin = %d", in.Nspin());
+
+    switch (in.Ncolor()) {
+    case 24: copyColorSpinorOffsetMG<Float, 24>(out, in, offset, pc_type); break;
+#ifdef NSPIN4
+    case 6: copyColorSpinorOffsetMG<Float, 6>(out, in, offset, pc_type); break;
+    case 32: copyColorSpinorOffsetMG<Float, 32>(out, in, offset, pc_type); break;
+#endif
+#ifdef NSPIN1
+    case 64: copyColorSpinorOffsetMG<Float, 64>(out, in, offset, pc_type); break;
+    case 96: copyColorSpinorOffsetMG<Float, 96>(out, in, offset, pc_type); break;
+#endif
+    default: errorQuda("Unsupported number of colors %d", in.Ncolor());
+    }
+  }
+
+  void copyFieldOffsetMG(ColorSpinorField &out, const ColorSpinorField &in, CommKey offset, QudaPCType pc_type)
+  {
+    switch (in.Precision()) {
+    case QUDA_DOUBLE_PRECISION:
+#ifdef GPU_MULTIGRID_DOUBLE
+      copyColorSpinorOffsetMG<double>(out, in, offset, pc_type);
+#else
+      errorQuda("Double precision multigrid has not been enabled");
+#endif
+      break;
+    case QUDA_SINGLE_PRECISION: copyColorSpinorOffsetMG<float>(out, in, offset, pc_type); break;
+    case QUDA_HALF_PRECISION:
+#if QUDA_PRECISION & 2
+      if (in.Location() == QUDA_CPU_FIELD_LOCATION) errorQuda("Half precision not supported on CPU");
+      copyColorSpinorOffsetMG<short>(out, in, offset, pc_type);
+#else
+      errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
+#endif
+      break;
+    default: errorQuda("Unsupported precision %d", in.Precision());
+    }
+  }
+
+  template <typename Float, int nColor>
+  void copyGaugeOffsetMG(GaugeField &out, const GaugeField &in, CommKey offset, QudaPCType pc_type)
+  {
+    using Field = GaugeField;
+    using Element = CoarseLinkElement<nColor>;
+    using real = typename mapper<Float>::type;
+
+    if (in.Order() == QUDA_FLOAT2_GAUGE_ORDER) {
+      using G = gauge::FieldOrder<real, nColor, 1, QUDA_FLOAT2_GAUGE_ORDER, true, Float>;
+      copy_field_offset_mg<Field, Element, G>(out, in, offset, pc_type);
+    } else if (in.Order() == QUDA_QDP_GAUGE_ORDER) {
+      using G = gauge::FieldOrder<real, nColor, 1, QUDA_QDP_GAUGE_ORDER, true, Float>;
+      copy_field_offset_mg<Field, Element, G>(out, in, offset, pc_type);
+    } else {
+      errorQuda("Unsupported field order %d", in.Order());
+    }
+  }
+
+  template <typename Float>
+  void copyGaugeOffsetMG(GaugeField &out, const GaugeField &in, CommKey offset, QudaPCType pc_type)
+  {
+    switch (in.Ncolor()) {
+    case 48: copyGaugeOffsetMG<Float, 48>(out, in, offset, pc_type); break;
+#ifdef NSPIN4
+    case 12: copyGaugeOffsetMG<Float, 12>(out, in, offset, pc_type); break;
+    case 64: copyGaugeOffsetMG<Float, 64>(out, in, offset, pc_type); break;
+#endif
+#ifdef NSPIN1
+    case 128: copyGaugeOffsetMG<Float, 128>(out, in, offset, pc_type); break;
+    case 192: copyGaugeOffsetMG<Float, 192>(out, in, offset, pc_type); break;
+#endif
+    default: errorQuda("Unsupported number of colors %d", in.Ncolor());
+    }
+  }
+
+  void copyFieldOffsetMG(GaugeField &out, const GaugeField &in, CommKey offset, QudaPCType pc_type)
+  {
+    switch (in.Precision()) {
+    case QUDA_DOUBLE_PRECISION:
+#ifdef GPU_MULTIGRID_DOUBLE
+      copyGaugeOffsetMG<double>(out, in, offset, pc_type);
+#else
+      errorQuda("Double precision multigrid has not been enabled");
+#endif
+      break;
+    case QUDA_SINGLE_PRECISION: copyGaugeOffsetMG<float>(out, in, offset, pc_type); break;
+    case QUDA_HALF_PRECISION:
+#if QUDA_PRECISION & 2
+      copyGaugeOffsetMG<short>(out, in, offset, pc_type);
+#else
+      errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
+#endif
+      break;
+    default: errorQuda("Unsupported precision %d", in.Precision());
+    }
+  }
+
+#else
+
+  void copyFieldOffsetMG(ColorSpinorField &, const ColorSpinorField &, CommKey, QudaPCType)
+  {
+    errorQuda("Multigrid has not been built");
+  }
+
+  void copyFieldOffsetMG(GaugeField &, const GaugeField &, CommKey, QudaPCType)
+  {
+    errorQuda("Multigrid has not been built");
+  }
+
+#endif // GPU_MULTIGRID
+
+} // namespace quda
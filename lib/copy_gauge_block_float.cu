@@ -0,0 +1,105 @@
+#include <gauge_field.h>
+#include <tunable_nd.h>
+#include <kernels/copy_gauge_block_float.cuh>
+
+namespace quda
+{
+
+#ifdef GPU_MULTIGRID
+
+  template <typename storeFloat, typename inFloat, int nColor> class CopyGaugeBlockFloatLaunch : public TunableKernel3D
+  {
+    using Arg = CopyGaugeBlockFloatArg<storeFloat, inFloat, nColor>;
+    GaugeField &out;
+    const GaugeField &in;
+
+    unsigned int minThreads() const { return in.Stride(); } // include the pad holding the ghost zone
+
+  public:
+    CopyGaugeBlockFloatLaunch(GaugeField &out, const GaugeField &in) :
+      TunableKernel3D(in, 2, in.Geometry()), out(out), in(in)
+    {
+      strcat(aux, ",");
+      strcat(aux, out.AuxString());
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      launch<CopyGaugeBlockFloat>(tp, stream, Arg(out, in));
+    }
+
+    long long flops() const { return 0; }
+    long long bytes() const { return 2 * in.Bytes() + out.Bytes() + out.BlockFloatBytes(); }
+  };
+
+  template <typename storeFloat, typename inFloat>
+  void copyGaugeBlockFloat(GaugeField &out, const GaugeField &in)
+  {
+    switch (in.Ncolor()) {
+    case 48: CopyGaugeBlockFloatLaunch<storeFloat, inFloat, 48>(out, in); break;
+#ifdef NSPIN4
+    case 12: CopyGaugeBlockFloatLaunch<storeFloat, inFloat, 12>(out, in); break;
+    case 64: CopyGaugeBlockFloatLaunch<storeFloat, inFloat, 64>(out, in); break;
+#endif
+#ifdef NSPIN1
+    case 128: CopyGaugeBlockFloatLaunch<storeFloat, inFloat, 128>(out, in); break;
+    case 192: CopyGaugeBlockFloatLaunch<storeFloat, inFloat, 192>(out, in); break;
+#endif
+    default: errorQuda("Unsupported number of colors %d", in.Ncolor());
+    }
+  }
+
+  template <typename storeFloat> void copyGaugeBlockFloat(GaugeField &out, const GaugeField &in)
+  {
+    switch (in.Precision()) {
+    case QUDA_SINGLE_PRECISION: copyGaugeBlockFloat<storeFloat, float>(out, in); break;
+    case QUDA_HALF_PRECISION:
+#if QUDA_PRECISION & 2
+      copyGaugeBlockFloat<storeFloat, short>(out, in);
+#else
+      errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
+#endif
+      break;
+    default: errorQuda("Unsupported input precision %d", in.Precision());
+    }
+  }
+
+  void copyGaugeBlockFloat(GaugeField &out, const GaugeField &in)
+  {
+    if (!out.BlockFloat()) errorQuda("Output field is not stored in block floating point");
+    if (in.BlockFloat()) errorQuda("Input field must not be stored in block floating point");
+    if (checkLocation(out, in) != QUDA_CUDA_FIELD_LOCATION) errorQuda("Block floating point is only supported on the device");
+    if (in.LinkType() != QUDA_COARSE_LINKS) errorQuda("Unsupported link type %d", in.LinkType());
+    if (in.Order() != QUDA_FLOAT2_GAUGE_ORDER || out.Order() != QUDA_FLOAT2_GAUGE_ORDER)
+      errorQuda("Unsupported field order out=%d in=%d", out.Order(), in.Order());
+    if (in.Geometry() != out.Geometry()) errorQuda("Geometry mismatch out=%d in=%d", out.Geometry(), in.Geometry());
+    if (in.Stride() != out.Stride()) errorQuda("Stride mismatch out=%lu in=%lu", out.Stride(), in.Stride());
+
+    switch (out.Precision()) {
+    case QUDA_HALF_PRECISION:
+#if QUDA_PRECISION & 2
+      copyGaugeBlockFloat<short>(out, in);
+#else
+      errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
+#endif
+      break;
+    case QUDA_QUARTER_PRECISION:
+#if QUDA_PRECISION & 1
+      copyGaugeBlockFloat<int8_t>(out, in);
+#else
+      errorQuda("QUDA_PRECISION=%d does not enable quarter precision", QUDA_PRECISION);
+#endif
+      break;
+    default: errorQuda("Unsupported block floating point precision %d", out.Precision());
+    }
+  }
+
+#else
+
+  void copyGaugeBlockFloat(GaugeField &, const GaugeField &) { errorQuda("Multigrid has not been built"); }
+
+#endif // GPU_MULTIGRID
+
+} // namespace quda
@@ -107,6 +107,9 @@ namespace quda
     }
   };
 
+  // declaration for coarse-grid fields - defined in copy_field_offset_mg.cu
+  void copyFieldOffsetMG(GaugeField &out, const GaugeField &in, CommKey offset, QudaPCType pc_type);
+
   void copyFieldOffset(GaugeField &out, const GaugeField &in, CommKey offset, QudaPCType pc_type)
   {
     checkPrecision(out, in);
@@ -119,7 +122,11 @@ namespace quda
       errorQuda("Field geometries %d %d do not match", out.Geometry(), in.Geometry());
     }
 
-    instantiate<CopyGaugeOffset>(out, in, offset);
+    if (in.LinkType() == QUDA_COARSE_LINKS) {
+      copyFieldOffsetMG(out, in, offset, pc_type);
+    } else {
+      instantiate<CopyGaugeOffset>(out, in, offset);
+    }
   }
 
 } // namespace quda
@@ -388,10 +388,10 @@ namespace quda {
 
     if (Order() == QUDA_QDP_GAUGE_ORDER || Order() == QUDA_QDPJIT_GAUGE_ORDER) {
       void *const *p = static_cast<void *const *>(Gauge_p());
-      int dbytes = Bytes() / 4;
+      int dbytes = Bytes() / geometry;
       static_assert(sizeof(char) == 1, "Assuming sizeof(char) == 1");
       char *dst_buffer = reinterpret_cast<char *>(buffer);
-      for (int d = 0; d < 4; d++) { std::memcpy(&dst_buffer[d * dbytes], p[d], dbytes); }
+      for (int d = 0; d < geometry; d++) { std::memcpy(&dst_buffer[d * dbytes], p[d], dbytes); }
     } else if (Order() == QUDA_CPS_WILSON_GAUGE_ORDER || Order() == QUDA_MILC_GAUGE_ORDER
                || Order() == QUDA_MILC_SITE_GAUGE_ORDER || Order() == QUDA_BQCD_GAUGE_ORDER
                || Order() == QUDA_TIFR_GAUGE_ORDER || Order() == QUDA_TIFR_PADDED_GAUGE_ORDER) {
@@ -408,10 +408,10 @@ namespace quda {
 
     if (Order() == QUDA_QDP_GAUGE_ORDER || Order() == QUDA_QDPJIT_GAUGE_ORDER) {
       void **p = static_cast<void **>(Gauge_p());
-      size_t dbytes = Bytes() / 4;
+      size_t dbytes = Bytes() / geometry;
       static_assert(sizeof(char) == 1, "Assuming sizeof(char) == 1");
       const char *dst_buffer = reinterpret_cast<const char *>(buffer);
-      for (int d = 0; d < 4; d++) { std::memcpy(p[d], &dst_buffer[d * dbytes], dbytes); }
+      for (int d = 0; d < geometry; d++) { std::memcpy(p[d], &dst_buffer[d * dbytes], dbytes); }
     } else if (Order() == QUDA_CPS_WILSON_GAUGE_ORDER || Order() == QUDA_MILC_GAUGE_ORDER
                || Order() == QUDA_MILC_SITE_GAUGE_ORDER || Order() == QUDA_BQCD_GAUGE_ORDER
                || Order() == QUDA_TIFR_GAUGE_ORDER || Order() == QUDA_TIFR_PADDED_GAUGE_ORDER) {
@@ -1,5 +1,6 @@
 #include <cstring>
 #include <typeinfo>
+#include <future>
 #include <gauge_field.h>
 #include <timer.h>
 #include <blas_quda.h>
@@ -8,7 +9,7 @@
 namespace quda {
 
   cudaGaugeField::cudaGaugeField(const GaugeFieldParam &param) :
-    GaugeField(param), gauge(0), even(0), odd(0)
+    GaugeField(param), gauge(0), even(0), odd(0), block_float_scale(nullptr)
   {
     if ((order == QUDA_QDP_GAUGE_ORDER || order == QUDA_QDPJIT_GAUGE_ORDER) &&
         create != QUDA_REFERENCE_FIELD_CREATE) {
@@ -41,6 +42,14 @@ namespace quda {
       errorQuda("ERROR: create type(%d) not supported yet\n", create);
     }
 
+    if (block_float) {
+      if (order != QUDA_FLOAT2_GAUGE_ORDER) errorQuda("Block floating point requires native order, not %d", order);
+      if (create == QUDA_REFERENCE_FIELD_CREATE) errorQuda("Block floating point not supported for reference fields");
+      if (mem_type != QUDA_MEMORY_DEVICE) errorQuda("Block floating point requires device memory");
+      block_float_scale = pool_device_malloc(block_float_bytes);
+      qudaMemset(block_float_scale, 0, block_float_bytes);
+    }
+
     if (create != QUDA_REFERENCE_FIELD_CREATE) {
       switch(mem_type) {
       case QUDA_MEMORY_DEVICE: gauge = bytes ? pool_device_malloc(bytes) : nullptr; break;
@@ -88,6 +97,8 @@ namespace quda {
   {
     destroyComms();
 
+    if (block_float_scale) pool_device_free(block_float_scale);
+
     if (create != QUDA_REFERENCE_FIELD_CREATE) {
       switch(mem_type) {
       case QUDA_MEMORY_DEVICE:
@@ -115,6 +126,7 @@ namespace quda {
   void cudaGaugeField::exchangeGhost(QudaLinkDirection link_direction) {
 
     if (ghostExchange != QUDA_GHOST_EXCHANGE_PAD) errorQuda("Cannot call exchangeGhost with ghostExchange=%d", ghostExchange);
+    if (block_float) errorQuda("The ghost zone of a block floating point field is populated by copy()");
     if (geometry != QUDA_VECTOR_GEOMETRY && geometry != QUDA_COARSE_GEOMETRY) errorQuda("Invalid geometry=%d", geometry);
     if ( (link_direction == QUDA_LINK_BIDIRECTIONAL || link_direction == QUDA_LINK_FORWARDS) && geometry != QUDA_COARSE_GEOMETRY)
       errorQuda("Cannot request exchange of forward links on non-coarse geometry");
@@ -205,6 +217,7 @@ namespace quda {
   void cudaGaugeField::injectGhost(QudaLinkDirection link_direction)
   {
     if (ghostExchange != QUDA_GHOST_EXCHANGE_PAD) errorQuda("Cannot call exchangeGhost with ghostExchange=%d", ghostExchange);
+    if (block_float) errorQuda("Cannot inject the ghost zone of a block floating point field");
     if (geometry != QUDA_VECTOR_GEOMETRY && geometry != QUDA_COARSE_GEOMETRY) errorQuda("Invalid geometry=%d", geometry);
     if (link_direction != QUDA_LINK_BACKWARDS) errorQuda("Invalid link_direction = %d", link_direction);
     if (nFace == 0) errorQuda("nFace = 0");
@@ -545,6 +558,13 @@ namespace quda {
 
     checkField(src);
 
+    if (block_float) {
+      // compress the body and the ghost zone held in the pad
+      copyGaugeBlockFloat(*this, src);
+      return;
+    }
+    if (src.BlockFloat()) errorQuda("Copying from a block floating point field is not supported");
+
     if (link_type == QUDA_ASQTAD_FAT_LINKS) {
       fat_link_max = src.LinkMax();
       if (fat_link_max == 0.0 && precision < QUDA_SINGLE_PRECISION) fat_link_max = src.abs_max();
@@ -655,6 +675,116 @@ namespace quda {
     profile.TPSTOP(QUDA_PROFILE_H2D);
   }
 
+  void cudaGaugeField::loadCPUFieldStream(const GaugeFieldParam &cpu_param,
+                                          const std::function<void(cpuGaugeField &, int, int)> &reader, int slab)
+  {
+    if (!isNative()) errorQuda("Streaming load not supported for order %d", order);
+    if (phase_bytes) errorQuda("Streaming load not supported for reconstruct %d", reconstruct);
+    if (geometry != QUDA_VECTOR_GEOMETRY) errorQuda("Streaming load not supported for geometry %d", geometry);
+    if (ghostExchange == QUDA_GHOST_EXCHANGE_EXTENDED) errorQuda("Streaming load not supported for extended fields");
+
+    const int T = x[3];
+    if (slab == 0) { // default to roughly eight slabs
+      slab = std::max(2, (T / 8) & ~1);
+      while (slab < T && T % slab != 0) slab += 2;
+    }
+    if (slab % 2 != 0 || slab > T || T % slab != 0)
+      errorQuda("Slab size %d must be even and divide the local temporal extent %d", slab, T);
+    const int n_slab = T / slab;
+
+    // host fields in the application order covering a single slab
+    GaugeFieldParam host_param(cpu_param);
+    host_param.x[3] = slab;
+    host_param.create = QUDA_NULL_FIELD_CREATE;
+    host_param.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+    host_param.pad = 0;
+    host_param.gauge = nullptr;
+    host_param.compute_fat_link_max = false;
+
+    // pinned staging fields in the native order covering a single slab
+    GaugeFieldParam native_param(*this);
+    native_param.x[3] = slab;
+    native_param.create = QUDA_REFERENCE_FIELD_CREATE;
+    native_param.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+    native_param.pad = 0;
+
+    native_param.gauge = nullptr;
+    const size_t slab_bytes = cudaGaugeField(native_param).Bytes();
+
+    cpuGaugeField *host[2];
+    cudaGaugeField *native[2];
+    void *staging[2];
+    qudaEvent_t event[2];
+    for (int i = 0; i < 2; i++) {
+      host[i] = new cpuGaugeField(host_param);
+      staging[i] = pool_pinned_malloc(slab_bytes);
+      native_param.gauge = staging[i];
+      native[i] = new cudaGaugeField(native_param);
+      event[i] = qudaEventCreate();
+    }
+
+    // each slab is a contiguous range of checkerboard sites in every
+    // row of the native order, given the slab starts on an even time slice
+    const size_t slab_volume_cb = native[0]->VolumeCB();
+    const size_t site_bytes = order * precision;
+    const size_t rows = (geometry * nInternal) / order;
+    const auto stream = device::get_default_stream();
+
+    // fat links are scaled by their global max, so the max is reduced
+    // over all slabs: for fixed-point fields this needs a first pass
+    // over the slabs, since it must be known before any conversion
+    const bool fat = link_type == QUDA_ASQTAD_FAT_LINKS;
+    double link_max = 0.0;
+    if (fat && precision < QUDA_SINGLE_PRECISION) {
+      for (int k = 0; k < n_slab; k++) {
+        reader(*host[0], k * slab, (k + 1) * slab);
+        link_max = std::max(link_max, host[0]->abs_max());
+      }
+      for (int i = 0; i < 2; i++) native[i]->fat_link_max = link_max;
+    }
+
+    reader(*host[0], 0, slab);
+    for (int k = 0; k < n_slab; k++) {
+      const int b = k % 2;
+
+      // wait until the transfer from this staging buffer has completed
+      if (k >= 2) qudaEventSynchronize(event[b]);
+
+      // reorder this slab on a host thread while reading the next
+      auto reorder = std::async(std::launch::async, [&]() {
+        copyGenericGauge(*native[b], *host[b], QUDA_CPU_FIELD_LOCATION, staging[b], host[b]->Gauge_p());
+      });
+      if (k + 1 < n_slab) reader(*host[1 - b], (k + 1) * slab, (k + 2) * slab);
+      reorder.get();
+      if (fat && precision >= QUDA_SINGLE_PRECISION) link_max = std::max(link_max, host[b]->abs_max());
+
+      const size_t offset_cb = k * slab_volume_cb;
+      for (int parity = 0; parity < 2; parity++) {
+        char *dst = static_cast<char *>(gauge) + parity * (bytes / 2);
+        char *src = static_cast<char *>(staging[b]) + parity * (slab_bytes / 2);
+        for (size_t row = 0; row < rows; row++) {
+          qudaMemcpyAsync(dst + (row * stride + offset_cb) * site_bytes, src + row * slab_volume_cb * site_bytes,
+                          slab_volume_cb * site_bytes, qudaMemcpyHostToDevice, stream);
+        }
+      }
+      qudaEventRecord(event[b], stream);
+    }
+    qudaStreamSynchronize(stream);
+
+    fat_link_max = fat ? link_max : 1.0;
+    staggeredPhaseApplied = host[0]->StaggeredPhaseApplied();
+    staggeredPhaseType = host[0]->StaggeredPhase();
+
+    for (int i = 0; i < 2; i++) {
+      qudaEventDestroy(event[i]);
+      delete native[i];
+      pool_pinned_free(staging[i]);
+      delete host[i];
+    }
+
+    if (ghostExchange == QUDA_GHOST_EXCHANGE_PAD) exchangeGhost();
+  }
+
   void cudaGaugeField::saveCPUField(cpuGaugeField &cpu) const
   {
     static_cast<LatticeField&>(cpu).checkField(*this);
@@ -310,4 +310,46 @@ namespace quda {
     if (tmp2) tmp2->prefetch(mem_space, stream);
   }
 
+  void DiracMatrix::operator()(std::vector<ColorSpinorField *> &out, const std::vector<ColorSpinorField *> &in,
+                               ColorSpinorField &Tmp1, ColorSpinorField &Tmp2) const
+  {
+    if (out.size() != in.size()) errorQuda("Mismatched set sizes out=%lu in=%lu", out.size(), in.size());
+    if (in.size() == 0) return;
+
+    if (in.size() == 1 || !hasMultiRHS() || in[0]->Location() != QUDA_CUDA_FIELD_LOCATION
+        || (in[0]->Ndim() == 5 && in[0]->X(4) != 1)) {
+      for (auto i = 0u; i < in.size(); i++) (*this)(*out[i], *in[i], Tmp1, Tmp2);
+      return;
+    }
+
+    // pack the right-hand sides into the fifth dimension, reusing the
+    // multi-RHS fields of the previous application if they match
+    auto matches = [&](const ColorSpinorField &mrhs) {
+      const ColorSpinorField &rhs = *in[0];
+      if (mrhs.X(4) != static_cast<int>(in.size()) || mrhs.Precision() != rhs.Precision()
+          || mrhs.Nspin() != rhs.Nspin() || mrhs.Ncolor() != rhs.Ncolor() || mrhs.SiteSubset() != rhs.SiteSubset()
+          || mrhs.FieldOrder() != rhs.FieldOrder() || mrhs.GammaBasis() != rhs.GammaBasis())
+        return false;
+      for (int d = 0; d < 4; d++)
+        if (mrhs.X(d) != rhs.X(d)) return false;
+      return true;
+    };
+
+    if (!in_mrhs || !matches(*in_mrhs)) {
+      if (in_mrhs) delete in_mrhs;
+      if (out_mrhs) delete out_mrhs;
+      ColorSpinorParam param(*in[0]);
+      param.create = QUDA_NULL_FIELD_CREATE;
+      param.nDim = 5;
+      param.x[4] = in.size();
+      param.pc_type = QUDA_4D_PC;
+      in_mrhs = new cudaColorSpinorField(param);
+      out_mrhs = new cudaColorSpinorField(param);
+    }
+
+    for (auto i = 0u; i < in.size(); i++) copySlice(*in_mrhs, *in[i], i);
+    (*this)(*out_mrhs, *in_mrhs);
+    for (auto i = 0u; i < out.size(); i++) copySlice(*out[i], *out_mrhs, i);
+  }
+
 } // namespace quda
@@ -24,8 +24,10 @@ namespace quda {
   {
     Dirac::checkParitySpinor(out, in);
 
-    if (out.Volume() != clover->VolumeCB()) {
-      errorQuda("Parity spinor volume %lu doesn't match clover checkboard volume %lu", out.Volume(), clover->VolumeCB());
+    // multi-RHS fields share the clover term across the fifth dimension, so compare 4-d volumes
+    auto volume = out.Ndim() == 5 ? out.Volume() / out.X(4) : out.Volume();
+    if (volume != clover->VolumeCB()) {
+      errorQuda("Parity spinor volume %lu doesn't match clover checkboard volume %lu", volume, clover->VolumeCB());
     }
   }
 
@@ -1,11 +1,12 @@
 #include <string.h>
 #include <multigrid.h>
 #include <tune_quda.h>
+#include <split_grid.h>
 #include <algorithm>
 
 namespace quda {
 
-  DiracCoarse::DiracCoarse(const DiracParam &param, bool gpu_setup, bool mapped) :
+  DiracCoarse::DiracCoarse(const DiracParam &param, bool gpu_setup, bool mapped, bool compute) :
     Dirac(param),
     mass(param.mass),
     mu(param.mu),
@@ -22,6 +23,13 @@ namespace quda {
     X_d(nullptr),
     Xinv_d(nullptr),
     Yhat_d(nullptr),
+    block_float_precision(param.block_float_precision),
+    Y_bf(nullptr),
+    X_bf(nullptr),
+    Xinv_bf(nullptr),
+    Yhat_bf(nullptr),
+    bf_owner(this),
+    use_block_float(true),
     enable_gpu(false),
     enable_cpu(false),
     gpu_setup(gpu_setup),
@@ -29,7 +37,15 @@ namespace quda {
     init_cpu(!gpu_setup),
     mapped(mapped)
   {
-    initializeCoarse();
+    if (compute) {
+      initializeCoarse();
+    } else {
+      // allocate only, the links will be populated by load()
+      createY(gpu_setup, mapped);
+      createYhat(gpu_setup);
+      if (gpu_setup) enable_gpu = true;
+      else enable_cpu = true;
+    }
   }
 
   DiracCoarse::DiracCoarse(const DiracParam &param, cpuGaugeField *Y_h, cpuGaugeField *X_h, cpuGaugeField *Xinv_h,
@@ -53,6 +69,13 @@ namespace quda {
     X_d(X_d),
     Xinv_d(Xinv_d),
     Yhat_d(Yhat_d),
+    block_float_precision(param.block_float_precision),
+    Y_bf(nullptr),
+    X_bf(nullptr),
+    Xinv_bf(nullptr),
+    Yhat_bf(nullptr),
+    bf_owner(this),
+    use_block_float(true),
     enable_gpu(Y_d ? true : false),
     enable_cpu(Y_h ? true : false),
     gpu_setup(true),
@@ -80,6 +103,17 @@ namespace quda {
     X_d(dirac.X_d),
     Xinv_d(dirac.Xinv_d),
     Yhat_d(dirac.Yhat_d),
+    block_float_precision(param.block_float_precision),
+    Y_bf(nullptr),
+    X_bf(nullptr),
+    Xinv_bf(nullptr),
+    Yhat_bf(nullptr),
+    // share the block floating point links with the parent if their precisions match
+    bf_owner(dirac.enable_gpu && block_float_precision != QUDA_INVALID_PRECISION
+                 && block_float_precision == dirac.block_float_precision ?
+               dirac.bf_owner :
+               this),
+    use_block_float(true),
     enable_gpu(dirac.enable_gpu),
     enable_cpu(dirac.enable_cpu),
     gpu_setup(dirac.gpu_setup),
@@ -89,6 +123,88 @@ namespace quda {
   {
   }
 
+  /**
+     @brief Gather a coarse link field onto the agglomerated processor
+     grid.  The gathered field is allocated with the agglomerated
+     communicator active, such that its ghost zones match that grid.
+  */
+  static GaugeField *agglomerateLinks(const GaugeField &in, const CommKey &parent_key, const CommKey &split_key)
+  {
+    GaugeFieldParam param(in);
+    for (int d = 0; d < CommKey::n_dim; d++) param.x[d] *= split_key[d];
+    if (param.pad > 0) {
+      const int *x = param.x;
+      int pad = std::max({(x[0] * x[1] * x[2]) / 2, (x[1] * x[2] * x[3]) / 2, (x[0] * x[2] * x[3]) / 2,
+                          (x[0] * x[1] * x[3]) / 2});
+      param.pad = param.nFace * pad * 2; // factor of 2 since we have to store bi-directional ghost zone
+    }
+    param.create = QUDA_NULL_FIELD_CREATE;
+
+    push_communicator(parent_key * split_key);
+    GaugeField *out = GaugeField::Create(param);
+    push_communicator(parent_key);
+
+    std::vector<GaugeField *> v_in(1, const_cast<GaugeField *>(&in));
+    split_field(*out, v_in, split_key);
+    return out;
+  }
+
+  DiracCoarse::DiracCoarse(const DiracCoarse &dirac, const DiracParam &param, const CommKey &split_key,
+                           QudaFieldLocation location) :
+    Dirac(param),
+    mass(param.mass),
+    mu(param.mu),
+    mu_factor(param.mu_factor),
+    transfer(nullptr),
+    dirac(nullptr),
+    need_bidirectional(dirac.need_bidirectional),
+    use_mma(dirac.use_mma),
+    Y_h(nullptr),
+    X_h(nullptr),
+    Xinv_h(nullptr),
+    Yhat_h(nullptr),
+    Y_d(nullptr),
+    X_d(nullptr),
+    Xinv_d(nullptr),
+    Yhat_d(nullptr),
+    block_float_precision(param.block_float_precision),
+    Y_bf(nullptr),
+    X_bf(nullptr),
+    Xinv_bf(nullptr),
+    Yhat_bf(nullptr),
+    bf_owner(this),
+    use_block_float(true),
+    enable_gpu(location == QUDA_CUDA_FIELD_LOCATION),
+    enable_cpu(location == QUDA_CPU_FIELD_LOCATION),
+    gpu_setup(location == QUDA_CUDA_FIELD_LOCATION),
+    init_gpu(enable_gpu),
+    init_cpu(enable_cpu),
+    mapped(dirac.mapped)
+  {
+    dirac.initializeLazy(location);
+    const CommKey parent_key = get_current_comm_key();
+
+    if (location == QUDA_CUDA_FIELD_LOCATION) {
+      Y_d = static_cast<cudaGaugeField *>(agglomerateLinks(*dirac.Y_d, parent_key, split_key));
+      X_d = static_cast<cudaGaugeField *>(agglomerateLinks(*dirac.X_d, parent_key, split_key));
+      Xinv_d = static_cast<cudaGaugeField *>(agglomerateLinks(*dirac.Xinv_d, parent_key, split_key));
+      Yhat_d = static_cast<cudaGaugeField *>(agglomerateLinks(*dirac.Yhat_d, parent_key, split_key));
+      push_communicator(parent_key * split_key);
+      Y_d->exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+      Yhat_d->exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+      push_communicator(parent_key);
+    } else {
+      Y_h = static_cast<cpuGaugeField *>(agglomerateLinks(*dirac.Y_h, parent_key, split_key));
+      X_h = static_cast<cpuGaugeField *>(agglomerateLinks(*dirac.X_h, parent_key, split_key));
+      Xinv_h = static_cast<cpuGaugeField *>(agglomerateLinks(*dirac.Xinv_h, parent_key, split_key));
+      Yhat_h = static_cast<cpuGaugeField *>(agglomerateLinks(*dirac.Yhat_h, parent_key, split_key));
+      push_communicator(parent_key * split_key);
+      Y_h->exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+      Yhat_h->exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+      push_communicator(parent_key);
+    }
+  }
+
   DiracCoarse::~DiracCoarse()
   {
     if (init_cpu) {
@@ -103,6 +219,11 @@ namespace quda {
       if (Xinv_d) delete Xinv_d;
       if (Yhat_d) delete Yhat_d;
     }
+    // block floating point copies are only ever created by their owner
+    if (Y_bf) delete Y_bf;
+    if (X_bf) delete X_bf;
+    if (Xinv_bf) delete Xinv_bf;
+    if (Yhat_bf) delete Yhat_bf;
   }
 
   void DiracCoarse::createY(bool gpu, bool mapped) const
@@ -284,6 +405,41 @@ namespace quda {
     }
   }
 
+  void DiracCoarse::save(CheckpointIO &io) const
+  {
+    initializeLazy(gpu_setup ? QUDA_CUDA_FIELD_LOCATION : QUDA_CPU_FIELD_LOCATION);
+    if (gpu_setup) {
+      io.save(*Y_d);
+      io.save(*X_d);
+      io.save(*Yhat_d);
+      io.save(*Xinv_d);
+    } else {
+      io.save(*Y_h);
+      io.save(*X_h);
+      io.save(*Yhat_h);
+      io.save(*Xinv_h);
+    }
+  }
+
+  void DiracCoarse::load(CheckpointIO &io)
+  {
+    if (gpu_setup) {
+      io.load(*Y_d);
+      io.load(*X_d);
+      io.load(*Yhat_d);
+      io.load(*Xinv_d);
+      Y_d->exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+      Yhat_d->exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+    } else {
+      io.load(*Y_h);
+      io.load(*X_h);
+      io.load(*Yhat_h);
+      io.load(*Xinv_h);
+      Y_h->exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+      Yhat_h->exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+    }
+  }
+
   // we only copy to host or device lazily on demand
   void DiracCoarse::initializeLazy(QudaFieldLocation location) const
   {
@@ -316,6 +472,47 @@ namespace quda {
     }
   }
 
+  cudaGaugeField *&DiracCoarse::blockFloatField(const cudaGaugeField *field) const
+  {
+    if (field == Y_d) return Y_bf;
+    if (field == X_d) return X_bf;
+    if (field == Xinv_d) return Xinv_bf;
+    if (field == Yhat_d) return Yhat_bf;
+    errorQuda("Field %p is not a GPU link field of this operator", field);
+    return Y_bf;
+  }
+
+  const GaugeField &DiracCoarse::dslashField(const cudaGaugeField *field) const
+  {
+    if (block_float_precision == QUDA_INVALID_PRECISION || !use_block_float) return *field;
+    if (!field) errorQuda("GPU coarse fields not initialized");
+
+    // if shared, the owner holds the copies, since it shares its GPU links with us
+    cudaGaugeField *&field_bf = bf_owner->blockFloatField(field);
+    if (!field_bf) {
+      GaugeFieldParam param(*field);
+      param.block_float = true;
+      param.mem_type = QUDA_MEMORY_DEVICE;
+      param.create = QUDA_NULL_FIELD_CREATE;
+      param.setPrecision(block_float_precision);
+      field_bf = new cudaGaugeField(param);
+      field_bf->copy(*field); // includes the ghost zone held in the pad
+
+      if (getVerbosity() >= QUDA_VERBOSE)
+        printfQuda("Created block floating point coarse link copy with precision %d (%lu bytes vs %lu bytes)\n",
+                   block_float_precision, field_bf->Bytes() + field_bf->BlockFloatBytes(), field->Bytes());
+    }
+    return *field_bf;
+  }
+
+  void DiracCoarse::prefetchBlockFloat(const cudaGaugeField *field, QudaFieldLocation mem_space,
+                                       qudaStream_t stream) const
+  {
+    if (!field) return;
+    auto field_bf = bf_owner->blockFloatField(field);
+    if (field_bf) field_bf->prefetch(mem_space, stream);
+  }
+
   void DiracCoarse::createPreconditionedCoarseOp(GaugeField &Yhat, GaugeField &Xinv, const GaugeField &Y, const GaugeField &X) {
     calculateYhat(Yhat, Xinv, Y, X, use_mma);
   }
@@ -326,7 +523,8 @@ namespace quda {
     QudaFieldLocation location = checkLocation(out,in);
     initializeLazy(location);
     if (location == QUDA_CUDA_FIELD_LOCATION) {
-      ApplyCoarse(out, in, in, *Y_d, *X_d, kappa, parity, false, true, dagger, commDim);
+      ApplyCoarse(out, in, in, dslashField(Y_d), dslashField(X_d), kappa, parity, false, true, dagger,
+                  commDim);
     } else if (location == QUDA_CPU_FIELD_LOCATION) {
       ApplyCoarse(out, in, in, *Y_h, *X_h, kappa, parity, false, true, dagger, commDim);
     }
@@ -340,7 +538,8 @@ namespace quda {
     QudaFieldLocation location = checkLocation(out,in);
     initializeLazy(location);
     if ( location  == QUDA_CUDA_FIELD_LOCATION ) {
-      ApplyCoarse(out, in, in, *Y_d, *Xinv_d, kappa, parity, false, true, dagger, commDim);
+      ApplyCoarse(out, in, in, dslashField(Y_d), dslashField(Xinv_d), kappa, parity, false, true, dagger,
+                  commDim);
     } else if ( location == QUDA_CPU_FIELD_LOCATION ) {
       ApplyCoarse(out, in, in, *Y_h, *Xinv_h, kappa, parity, false, true, dagger, commDim);
     }
@@ -354,7 +553,8 @@ namespace quda {
     QudaFieldLocation location = checkLocation(out,in);
     initializeLazy(location);
     if ( location == QUDA_CUDA_FIELD_LOCATION ) {
-      ApplyCoarse(out, in, in, *Y_d, *X_d, kappa, parity, true, false, dagger, commDim, halo_precision);
+      ApplyCoarse(out, in, in, dslashField(Y_d), dslashField(X_d), kappa, parity, true, false, dagger,
+                  commDim, halo_precision);
     } else if ( location == QUDA_CPU_FIELD_LOCATION ) {
       ApplyCoarse(out, in, in, *Y_h, *X_h, kappa, parity, true, false, dagger, commDim, halo_precision);
     }
@@ -371,7 +571,8 @@ namespace quda {
     QudaFieldLocation location = checkLocation(out,in);
     initializeLazy(location);
     if ( location == QUDA_CUDA_FIELD_LOCATION ) {
-      ApplyCoarse(out, in, x, *Y_d, *X_d, kappa, parity, true, true, dagger, commDim, halo_precision);
+      ApplyCoarse(out, in, x, dslashField(Y_d), dslashField(X_d), kappa, parity, true, true, dagger, commDim,
+                  halo_precision);
     } else if ( location == QUDA_CPU_FIELD_LOCATION ) {
       ApplyCoarse(out, in, x, *Y_h, *X_h, kappa, parity, true, true, dagger, commDim, halo_precision);
     }
@@ -384,7 +585,8 @@ namespace quda {
     QudaFieldLocation location = checkLocation(out,in);
     initializeLazy(location);
     if ( location == QUDA_CUDA_FIELD_LOCATION ) {
-      ApplyCoarse(out, in, in, *Y_d, *X_d, kappa, QUDA_INVALID_PARITY, true, true, dagger, commDim, halo_precision);
+      ApplyCoarse(out, in, in, dslashField(Y_d), dslashField(X_d), kappa, QUDA_INVALID_PARITY, true, true,
+                  dagger, commDim, halo_precision);
     } else if ( location == QUDA_CPU_FIELD_LOCATION ) {
       ApplyCoarse(out, in, in, *Y_h, *X_h, kappa, QUDA_INVALID_PARITY, true, true, dagger, commDim, halo_precision);
     }
@@ -403,6 +605,20 @@ namespace quda {
     deleteTmp(&tmp1, reset1);
   }
 
+  void DiracCoarse::BlockMR(ColorSpinorField &x, const ColorSpinorField &b, int block_size, int n_iter,
+                            double omega) const
+  {
+    if (getDiracType() != QUDA_COARSE_DIRAC) errorQuda("Block-Jacobi MR requires the unpreconditioned coarse operator");
+    if (dagger == QUDA_DAG_YES) errorQuda("Block-Jacobi MR not supported for the daggered operator");
+    if (&x == &b) errorQuda("Fields cannot alias");
+    QudaFieldLocation location = checkLocation(x, b);
+    if (location != QUDA_CPU_FIELD_LOCATION) errorQuda("Block-Jacobi MR requires a CPU-located level");
+    initializeLazy(location);
+    ApplyCoarseBlockMR(x, b, *Y_h, *X_h, kappa, block_size, n_iter, omega);
+    int n = b.Nspin() * b.Ncolor();
+    flops += n_iter * (9 * (8 * n * n) + 20 * n) * (long long)b.Volume();
+  }
+
   void DiracCoarse::prepare(ColorSpinorField* &src, ColorSpinorField* &sol,
 			    ColorSpinorField &x, ColorSpinorField &b,
 			    const QudaSolutionType solType) const
@@ -444,6 +660,8 @@ namespace quda {
     Dirac::prefetch(mem_space, stream);
     if (Y_d) Y_d->prefetch(mem_space, stream);
     if (X_d) X_d->prefetch(mem_space, stream);
+    prefetchBlockFloat(Y_d, mem_space, stream);
+    prefetchBlockFloat(X_d, mem_space, stream);
   }
 
   DiracCoarsePC::DiracCoarsePC(const DiracParam &param, bool gpu_setup) : DiracCoarse(param, gpu_setup)
@@ -456,6 +674,13 @@ namespace quda {
     /* do nothing */
   }
 
+  DiracCoarsePC::DiracCoarsePC(const DiracCoarse &dirac, const DiracParam &param, const CommKey &split_key,
+                               QudaFieldLocation location) :
+    DiracCoarse(dirac, param, split_key, location)
+  {
+    /* do nothing */
+  }
+
   DiracCoarsePC::~DiracCoarsePC() { }
 
   void DiracCoarsePC::Dslash(ColorSpinorField &out, const ColorSpinorField &in, const QudaParity parity) const
@@ -463,7 +688,8 @@ namespace quda {
     QudaFieldLocation location = checkLocation(out,in);
     initializeLazy(location);
     if ( location == QUDA_CUDA_FIELD_LOCATION) {
-      ApplyCoarse(out, in, in, *Yhat_d, *X_d, kappa, parity, true, false, dagger, commDim, halo_precision);
+      ApplyCoarse(out, in, in, dslashField(Yhat_d), dslashField(X_d), kappa, parity, true, false, dagger,
+                  commDim, halo_precision);
     } else if ( location == QUDA_CPU_FIELD_LOCATION ) {
       ApplyCoarse(out, in, in, *Yhat_h, *X_h, kappa, parity, true, false, dagger, commDim, halo_precision);
     }
@@ -667,5 +893,7 @@ namespace quda {
     Dirac::prefetch(mem_space, stream);
     if (Xinv_d) Xinv_d->prefetch(mem_space, stream);
     if (Yhat_d) Yhat_d->prefetch(mem_space, stream);
+    prefetchBlockFloat(Xinv_d, mem_space, stream);
+    prefetchBlockFloat(Yhat_d, mem_space, stream);
   }
 }
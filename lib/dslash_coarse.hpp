@@ -9,7 +9,7 @@
 namespace quda {
 
   template <typename Float, typename yFloat, typename ghostFloat, int Ns, int Nc, bool dslash, bool clover, bool dagger,
-            DslashType type>
+            DslashType type, bool block_float = false>
   class DslashCoarse : public TunableKernel3D
   {
 
@@ -36,7 +36,8 @@ namespace quda {
     long long bytes() const
     {
      return (dslash||clover) * out.Bytes() + dslash*8*inA.Bytes() + clover*inB.Bytes() +
-       nSrc*nParity*(dslash*Y.Bytes()*Y.VolumeCB()/(2*Y.Stride()) + clover*X.Bytes()/2);
+       nSrc*nParity*(dslash*(Y.Bytes()+Y.BlockFloatBytes())*Y.VolumeCB()/(2*Y.Stride()) +
+                     clover*(X.Bytes()+X.BlockFloatBytes())/2);
     }
 
     unsigned int sharedBytesPerThread() const { return (sizeof(complex<Float>) * colors_per_thread(Nc, dim_threads)); }
@@ -181,7 +182,21 @@ namespace quda {
     template <int color_stride, int dim_stride, QudaFieldOrder csOrder = QUDA_FLOAT2_FIELD_ORDER,
               QudaGaugeFieldOrder gOrder = QUDA_FLOAT2_GAUGE_ORDER>
     using Arg = DslashCoarseArg<dslash, clover, dagger, type, color_stride, dim_stride, Float, yFloat, ghostFloat, Ns,
-                                Nc, csOrder, gOrder>;
+                                Nc, csOrder, gOrder, block_float>;
+
+    template <bool block = block_float>
+    std::enable_if_t<!block, void> apply_host(const TuneParam &tp, const qudaStream_t &stream)
+    {
+      launch_host<CoarseDslash>(
+        tp, stream,
+        Arg<1, 1, QUDA_SPACE_SPIN_COLOR_FIELD_ORDER, QUDA_QDP_GAUGE_ORDER>(out, inA, inB, Y, X, (Float)kappa, parity));
+    }
+
+    template <bool block = block_float>
+    std::enable_if_t<block, void> apply_host(const TuneParam &, const qudaStream_t &)
+    {
+      errorQuda("Block floating point links are only supported on the device");
+    }
 
     void apply(const qudaStream_t &stream)
     {
@@ -195,9 +210,7 @@ namespace quda {
         if (out.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER || Y.FieldOrder() != QUDA_QDP_GAUGE_ORDER)
           errorQuda("Unsupported field order colorspinor=%d gauge=%d combination\n", inA.FieldOrder(), Y.FieldOrder());
 
-        launch_host<CoarseDslash>(
-          tp, stream,
-          Arg<1, 1, QUDA_SPACE_SPIN_COLOR_FIELD_ORDER, QUDA_QDP_GAUGE_ORDER>(out, inA, inB, Y, X, (Float)kappa, parity));
+        apply_host(tp, stream);
       } else {
         if (out.FieldOrder() != QUDA_FLOAT2_FIELD_ORDER || Y.FieldOrder() != QUDA_FLOAT2_GAUGE_ORDER)
           errorQuda("Unsupported field order colorspinor=%d gauge=%d combination\n", inA.FieldOrder(), Y.FieldOrder());
@@ -243,7 +256,8 @@ namespace quda {
     void postTune() { out.restore(); }
   };
 
-  template <typename Float, typename yFloat, typename ghostFloat, bool dagger, int coarseColor, int coarseSpin>
+  template <typename Float, typename yFloat, typename ghostFloat, bool dagger, int coarseColor, int coarseSpin,
+            bool block_float>
   inline void ApplyCoarse(ColorSpinorField &out, const ColorSpinorField &inA, const ColorSpinorField &inB,
 			  const GaugeField &Y, const GaugeField &X, double kappa, int parity, bool dslash,
 			  bool clover, DslashType type, MemoryLocation *halo_location)
@@ -253,14 +267,14 @@ namespace quda {
       if (clover) {
 
         if (type == DSLASH_FULL) {
-          DslashCoarse<Float, yFloat, ghostFloat, coarseSpin, coarseColor, true, true, dagger, DSLASH_FULL> dslash(
+          DslashCoarse<Float, yFloat, ghostFloat, coarseSpin, coarseColor, true, true, dagger, DSLASH_FULL, block_float> dslash(
             out, inA, inB, Y, X, kappa, parity, halo_location);
         } else { errorQuda("Dslash type %d not instantiated", type); }
 
       } else { // plain dslash
 
         if (type == DSLASH_FULL) {
-          DslashCoarse<Float, yFloat, ghostFloat, coarseSpin, coarseColor, true, false, dagger, DSLASH_FULL> dslash(
+          DslashCoarse<Float, yFloat, ghostFloat, coarseSpin, coarseColor, true, false, dagger, DSLASH_FULL, block_float> dslash(
             out, inA, inB, Y, X, kappa, parity, halo_location);
         } else { errorQuda("Dslash type %d not instantiated", type); }
 
@@ -269,7 +283,7 @@ namespace quda {
 
       if (type == DSLASH_EXTERIOR) errorQuda("Cannot call halo on pure clover kernel");
       if (clover) {
-        DslashCoarse<Float, yFloat, ghostFloat, coarseSpin, coarseColor, false, true, dagger, DSLASH_FULL> dslash(
+        DslashCoarse<Float, yFloat, ghostFloat, coarseSpin, coarseColor, false, true, dagger, DSLASH_FULL, block_float> dslash(
           out, inA, inB, Y, X, kappa, parity, halo_location);
       } else {
         errorQuda("Unsupported dslash=false clover=false");
@@ -279,7 +293,7 @@ namespace quda {
   }
 
   // template on the number of coarse colors
-  template <typename Float, typename yFloat, typename ghostFloat, bool dagger>
+  template <typename Float, typename yFloat, typename ghostFloat, bool dagger, bool block_float = false>
   inline void ApplyCoarse(ColorSpinorField &out, const ColorSpinorField &inA, const ColorSpinorField &inB,
 			  const GaugeField &Y, const GaugeField &X, double kappa, int parity, bool dslash,
 			  bool clover, DslashType type, MemoryLocation *halo_location)
@@ -295,20 +309,20 @@ namespace quda {
 
 #ifdef NSPIN4
     if (inA.Ncolor() == 6) { // free field Wilson
-      ApplyCoarse<Float,yFloat,ghostFloat,dagger,6,2>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
+      ApplyCoarse<Float,yFloat,ghostFloat,dagger,6,2,block_float>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
     } else
 #endif // NSPIN4
     if (inA.Ncolor() == 24) {
-      ApplyCoarse<Float,yFloat,ghostFloat,dagger,24,2>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
+      ApplyCoarse<Float,yFloat,ghostFloat,dagger,24,2,block_float>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
 #ifdef NSPIN4
     } else if (inA.Ncolor() == 32) {
-      ApplyCoarse<Float,yFloat,ghostFloat,dagger,32,2>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
+      ApplyCoarse<Float,yFloat,ghostFloat,dagger,32,2,block_float>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
 #endif // NSPIN4
 #ifdef NSPIN1
     } else if (inA.Ncolor() == 64) {
-      ApplyCoarse<Float,yFloat,ghostFloat,dagger,64,2>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
+      ApplyCoarse<Float,yFloat,ghostFloat,dagger,64,2,block_float>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
     } else if (inA.Ncolor() == 96) {
-      ApplyCoarse<Float,yFloat,ghostFloat,dagger,96,2>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
+      ApplyCoarse<Float,yFloat,ghostFloat,dagger,96,2,block_float>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type, halo_location);
 #endif // NSPIN1
     } else {
       errorQuda("Unsupported number of coarse dof %d\n", Y.Ncolor());
@@ -356,6 +370,58 @@ namespace quda {
 	dslash(dslash), clover(clover), commDim(commDim),
         halo_precision(halo_precision == QUDA_INVALID_PRECISION ? Y.Precision() : halo_precision) { }
 
+    /**
+       @brief Apply the coarse dslash with block floating point links,
+       where each link matrix carries its own scale factor, with 16-bit
+       (half) or 8-bit (quarter) elements
+     */
+    inline void applyBlockFloat(MemoryLocation *halo_location, bool comms)
+    {
+      constexpr bool block_float = true;
+      const DslashType type = comms ? DSLASH_FULL : DSLASH_INTERIOR;
+      if (Y.Precision() == QUDA_HALF_PRECISION) {
+#if QUDA_PRECISION & 2
+        if (halo_precision == QUDA_HALF_PRECISION) {
+          ApplyCoarse<float, short, short, dagger, block_float>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type,
+                                                                 halo_location);
+        } else if (halo_precision == QUDA_QUARTER_PRECISION) {
+#if QUDA_PRECISION & 1
+          ApplyCoarse<float, short, int8_t, dagger, block_float>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type,
+                                                                  halo_location);
+#else
+          errorQuda("QUDA_PRECISION=%d does not enable quarter precision", QUDA_PRECISION);
+#endif
+        } else {
+          errorQuda("Halo precision %d not supported with block floating point link precision %d", halo_precision,
+                    Y.Precision());
+        }
+#else
+        errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
+#endif
+      } else if (Y.Precision() == QUDA_QUARTER_PRECISION) {
+#if QUDA_PRECISION & 1
+        if (halo_precision == QUDA_HALF_PRECISION) {
+#if QUDA_PRECISION & 2
+          ApplyCoarse<float, int8_t, short, dagger, block_float>(out, inA, inB, Y, X, kappa, parity, dslash, clover, type,
+                                                                  halo_location);
+#else
+          errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
+#endif
+        } else if (halo_precision == QUDA_QUARTER_PRECISION) {
+          ApplyCoarse<float, int8_t, int8_t, dagger, block_float>(out, inA, inB, Y, X, kappa, parity, dslash, clover,
+                                                                   type, halo_location);
+        } else {
+          errorQuda("Halo precision %d not supported with block floating point link precision %d", halo_precision,
+                    Y.Precision());
+        }
+#else
+        errorQuda("QUDA_PRECISION=%d does not enable quarter precision", QUDA_PRECISION);
+#endif
+      } else {
+        errorQuda("Unsupported block floating point link precision %d", Y.Precision());
+      }
+    }
+
     /**
        @brief Execute the coarse dslash using the given policy
      */
@@ -366,6 +432,8 @@ namespace quda {
       // check all precisions match
       QudaPrecision precision = checkPrecision(out, inA, inB);
       checkPrecision(Y, X);
+      if (Y.BlockFloat() != X.BlockFloat())
+        errorQuda("Block floating point mismatch Y = %d, X = %d", Y.BlockFloat(), X.BlockFloat());
 
       // check all locations match
       checkLocation(out, inA, inB, Y, X);
@@ -405,7 +473,7 @@ namespace quda {
 
       if (precision == QUDA_DOUBLE_PRECISION) {
 #ifdef GPU_MULTIGRID_DOUBLE
-	if (Y.Precision() != QUDA_DOUBLE_PRECISION)
+	if (Y.Precision() != QUDA_DOUBLE_PRECISION || Y.BlockFloat())
           errorQuda("Y Precision %d not supported", Y.Precision());
 	if (halo_precision != QUDA_DOUBLE_PRECISION)
           errorQuda("Halo precision %d not supported with field precision %d and link precision %d", halo_precision, precision, Y.Precision());
@@ -414,6 +482,8 @@ namespace quda {
 #else
 	errorQuda("Double precision multigrid has not been enabled");
 #endif
+      } else if (precision == QUDA_SINGLE_PRECISION && Y.BlockFloat()) {
+        applyBlockFloat(halo_location, comms);
       } else if (precision == QUDA_SINGLE_PRECISION) {
         if (Y.Precision() == QUDA_SINGLE_PRECISION) {
           if (halo_precision == QUDA_SINGLE_PRECISION) {
@@ -537,6 +607,7 @@ namespace quda {
       char prec_str[8];
       i32toa(prec_str, dslash.Y.Precision());
       strcat(aux, prec_str);
+      if (dslash.Y.BlockFloat()) strcat(aux, ",block_float");
       strcat(aux, ",halo_prec=");
       i32toa(prec_str, dslash.halo_precision);
       strcat(aux, prec_str);
@@ -618,8 +689,8 @@ namespace quda {
      int nParity = dslash.inA.SiteSubset();
      return (dslash.dslash||dslash.clover) * dslash.out.Bytes() +
        dslash.dslash*8*dslash.inA.Bytes() + dslash.clover*dslash.inB.Bytes() +
-       nParity*(dslash.dslash*dslash.Y.Bytes()*dslash.Y.VolumeCB()/(2*dslash.Y.Stride())
-		+ dslash.clover*dslash.X.Bytes()/2);
+       nParity*(dslash.dslash*(dslash.Y.Bytes()+dslash.Y.BlockFloatBytes())*dslash.Y.VolumeCB()/(2*dslash.Y.Stride())
+		+ dslash.clover*(dslash.X.Bytes()+dslash.X.BlockFloatBytes())/2);
      // multiply Y by volume / stride to correct for pad
    }
   };
@@ -53,7 +53,7 @@ namespace quda
     {
       if (U.StaggeredPhase() == QUDA_STAGGERED_PHASE_MILC) {
 #ifdef BUILD_MILC_INTERFACE
-        constexpr int nDim = 4; // MWTODO: this probably should be 5 for mrhs Dslash
+        constexpr int nDim = 4; // multi-RHS fields are handled by the fifth-dimension thread index
         constexpr bool improved = false;
 
         StaggeredArg<Float, nColor, nDim, recon_u, QUDA_RECONSTRUCT_NO, improved, QUDA_STAGGERED_PHASE_MILC> arg(
@@ -61,14 +61,14 @@ namespace quda
         Staggered<decltype(arg)> staggered(arg, out, in);
 
         dslash::DslashPolicyTune<decltype(staggered)> policy(
-          staggered, const_cast<cudaColorSpinorField *>(static_cast<const cudaColorSpinorField *>(&in)), in.VolumeCB(),
-          in.GhostFaceCB(), profile);
+          staggered, const_cast<cudaColorSpinorField *>(static_cast<const cudaColorSpinorField *>(&in)),
+          in.getDslashConstant().volume_4d_cb, in.getDslashConstant().ghostFaceCB, profile);
 #else
         errorQuda("MILC interface has not been built so MILC phase staggered fermions not enabled");
 #endif
       } else if (U.StaggeredPhase() == QUDA_STAGGERED_PHASE_TIFR) {
 #ifdef BUILD_TIFR_INTERFACE
-        constexpr int nDim = 4; // MWTODO: this probably should be 5 for mrhs Dslash
+        constexpr int nDim = 4; // multi-RHS fields are handled by the fifth-dimension thread index
         constexpr bool improved = false;
 
         StaggeredArg<Float, nColor, nDim, recon_u, QUDA_RECONSTRUCT_NO, improved, QUDA_STAGGERED_PHASE_TIFR> arg(
@@ -76,8 +76,8 @@ namespace quda
         Staggered<decltype(arg)> staggered(arg, out, in);
 
         dslash::DslashPolicyTune<decltype(staggered)> policy(
-          staggered, const_cast<cudaColorSpinorField *>(static_cast<const cudaColorSpinorField *>(&in)), in.VolumeCB(),
-          in.GhostFaceCB(), profile);
+          staggered, const_cast<cudaColorSpinorField *>(static_cast<const cudaColorSpinorField *>(&in)),
+          in.getDslashConstant().volume_4d_cb, in.getDslashConstant().ghostFaceCB, profile);
 #else
         errorQuda("TIFR interface has not been built so TIFR phase taggered fermions not enabled");
 #endif
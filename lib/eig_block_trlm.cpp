@@ -232,8 +232,9 @@ namespace quda
     int arrow_offset = j * block_size;
     int idx = 0, idx_conj = 0;
 
-    // r = A * v_j
-    for (int b = 0; b < block_size; b++) chebyOp(mat, *r[b], *v[j + b]);
+    // r = A * v_j, applied to the whole block at once
+    std::vector<ColorSpinorField *> vecs_ptr(v.begin() + j, v.begin() + j + block_size);
+    chebyOp(mat, r, vecs_ptr);
 
     // r = r - b_{j-1} * v_{j-1}
     int start = (j > num_keep) ? j - block_size : 0;
@@ -269,9 +270,6 @@ namespace quda
     }
 
     // a_j = v_j^dag * r
-    std::vector<ColorSpinorField *> vecs_ptr;
-    vecs_ptr.reserve(block_size);
-    for (int b = 0; b < block_size; b++) { vecs_ptr.push_back(v[j + b]); }
     // Block dot products stored in alpha_block.
     blas::cDotProduct(block_alpha + arrow_offset, vecs_ptr, r);
 
@@ -305,6 +303,7 @@ namespace quda
     // Column major order
     bool orthed = false;
     int k = 0, kmax = 3;
+    std::vector<Complex> cnorm(block_size);
     while (!orthed && k < kmax) {
       // Compute R_{k}
       if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printfQuda("Orthing k = %d\n", k);
@@ -312,17 +311,23 @@ namespace quda
         double norm = sqrt(blas::norm2(*r[b]));
         blas::ax(1.0 / norm, *r[b]);
         jth_block[b * (block_size + 1)] = norm;
-        for (int c = b + 1; c < block_size; c++) {
+        if (b == block_size - 1) break;
 
-          Complex cnorm = blas::cDotProduct(*r[b], *r[c]);
-          blas::caxpy(-cnorm, *r[b], *r[c]);
+        // Project r[b] out of the remaining columns with one block
+        // dot product and one block caxpy
+        std::vector<ColorSpinorField *> r_b = {r[b]};
+        std::vector<ColorSpinorField *> r_rest(r.begin() + b + 1, r.begin() + block_size);
+        blas::cDotProduct(cnorm.data(), r_b, r_rest);
 
+        for (int c = b + 1; c < block_size; c++) {
           idx = c * block_size + b;
           idx_conj = b * block_size + c;
 
-          jth_block[idx] = cnorm;
+          jth_block[idx] = cnorm[c - b - 1];
           jth_block[idx_conj] = 0.0;
+          cnorm[c - b - 1] = -cnorm[c - b - 1];
         }
+        blas::caxpy(cnorm.data(), r_b, r_rest);
       }
       // Accumulate R_{k} products
       updateBlockBeta(k, arrow_offset);
@@ -74,6 +74,14 @@ namespace quda
     double mat_norm = 0.0;
     double epsilon = setEpsilon(kSpace[0]->Precision());
 
+    // Locked eigenvectors are only projected out of the Lanczos
+    // vectors once their overlap could affect the convergence test
+    locked_overlap.assign(n_kr + 1, 0.0);
+    locked_overlap_tol = std::min(sqrt(epsilon), 0.1 * tol);
+    project_locked_next = false;
+    n_locked_step = 0;
+    n_locked_projection = 0;
+
     // Print Eigensolver params
     printEigensolverSetup();
     //---------------------------------------------------------------------------
@@ -177,6 +185,9 @@ namespace quda
       if (getVerbosity() >= QUDA_SUMMARIZE) {
         printfQuda("TRLM computed the requested %d vectors in %d restart steps and %d OP*x operations.\n", n_conv,
                    restart_iter, iter);
+        if (n_locked_step > 0)
+          printfQuda("TRLM projected %d of %d Lanczos vectors against the locked space (%d skipped).\n",
+                     n_locked_projection, n_locked_step, n_locked_step - n_locked_projection);
 
         // Dump all Ritz values and residua if using Chebyshev
         for (int i = 0; i < n_conv && eig_param->use_poly_acc; i++) {
@@ -232,12 +243,39 @@ namespace quda
       blas::axpy(beta_.data(), v_, r_);
     }
 
-    // Orthogonalise r against the Krylov space
-    for (int k = 0; k < 1; k++) blockOrthogonalize(v, r, j + 1);
+    // Orthogonalise r against the active part of the Krylov space
+    std::vector<ColorSpinorField *> v_active(v.begin() + num_locked, v.begin() + j + 1);
+    blockOrthogonalize(v_active, r, j + 1 - num_locked);
 
     // b_j = ||r||
     beta[j] = sqrt(blas::norm2(*r[0]));
 
+    // Hard locking: the locked eigenvectors are excluded from the
+    // per-step orthogonalisation, and are projected out in a single
+    // block operation only when the estimated overlap of r with them
+    // exceeds the tolerance.  As with partial reorthogonalization, the
+    // following vector is then projected too, since the overlap of the
+    // next vector depends on that of the current one.
+    // Only the recurrence part of the estimate is carried to the next
+    // step, the residual part is checked at this step alone.
+    if (num_locked > 0) {
+      double resid_overlap;
+      double overlap = lockedOverlap(j, resid_overlap);
+      n_locked_step++;
+      if (overlap + resid_overlap > locked_overlap_tol || project_locked_next) {
+        if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+          printfQuda("Projecting Lanczos vector %d against %d locked vectors, overlap estimate %e\n", j + 1,
+                     num_locked, overlap + resid_overlap);
+        std::vector<ColorSpinorField *> v_locked(v.begin(), v.begin() + num_locked);
+        blockOrthogonalize(v_locked, r, num_locked);
+        beta[j] = sqrt(blas::norm2(*r[0]));
+        overlap = setEpsilon(r[0]->Precision());
+        project_locked_next = !project_locked_next;
+        n_locked_projection++;
+      }
+      locked_overlap[j + 1] = overlap;
+    }
+
     // Prepare next step.
     // v_{j+1} = r / b_j
     blas::zero(*v[j + 1]);
@@ -247,6 +285,30 @@ namespace quda
     saveTuneCache();
   }
 
+  double TRLM::lockedOverlap(int j, double &resid_overlap)
+  {
+    double gap = 0.0;
+    double theta_max = 0.0;
+    double resid_max = 0.0;
+    for (int i = 0; i < num_locked; i++) {
+      gap = std::max(gap, fabs(alpha[i] - alpha[j]));
+      theta_max = std::max(theta_max, fabs(alpha[i]));
+      resid_max = std::max(resid_max, residua[i]);
+    }
+
+    // The residual of the locked vectors bounds the component they
+    // gain from the operator at this step
+    resid_overlap = resid_max / beta[j];
+
+    // The remaining terms are the Lanczos recurrence (the arrow at the
+    // start of a restart) and rounding
+    double overlap = gap * locked_overlap[j] + setEpsilon(r[0]->Precision()) * (theta_max + fabs(alpha[j]));
+    int start = (j > num_keep) ? j - 1 : num_locked;
+    for (int i = start; i < j; i++) overlap += fabs(beta[i]) * locked_overlap[i];
+
+    return overlap / beta[j];
+  }
+
   void TRLM::reorder(std::vector<ColorSpinorField *> &kSpace)
   {
     int i = 0;
@@ -280,11 +342,6 @@ namespace quda
     int dim = n_kr - num_locked;
     int arrow_pos = num_keep - num_locked;
 
-    // Eigen objects
-    MatrixXd A = MatrixXd::Zero(dim, dim);
-    ritz_mat.resize(dim * dim);
-    for (int i = 0; i < dim * dim; i++) ritz_mat[i] = 0.0;
-
     // Invert the spectrum due to chebyshev
     if (reverse) {
       for (int i = num_locked; i < n_kr - 1; i++) {
@@ -294,39 +351,16 @@ namespace quda
       alpha[n_kr - 1] *= -1.0;
     }
 
-    // Construct arrow mat A_{dim,dim}
-    for (int i = 0; i < dim; i++) {
-
-      // alpha populates the diagonal
-      A(i, i) = alpha[i + num_locked];
-    }
-
-    for (int i = 0; i < arrow_pos; i++) {
-
-      // beta populates the arrow
-      A(i, arrow_pos) = beta[i + num_locked];
-      A(arrow_pos, i) = beta[i + num_locked];
-    }
-
-    for (int i = arrow_pos; i < dim - 1; i++) {
-
-      // beta populates the sub-diagonal
-      A(i, i + 1) = beta[i + num_locked];
-      A(i + 1, i) = beta[i + num_locked];
-    }
-
-    // Eigensolve the arrow matrix
-    SelfAdjointEigenSolver<MatrixXd> eigensolver;
-    eigensolver.compute(A);
-
-    // repopulate ritz matrix
-    for (int i = 0; i < dim; i++)
-      for (int j = 0; j < dim; j++) ritz_mat[dim * i + j] = eigensolver.eigenvectors().col(i)[j];
+    // Eigensolve the arrow matrix, with alpha populating the diagonal
+    // and beta the arrow and sub-diagonal.  Only the eigenvalues and
+    // last row of the eigenvectors are formed here, the kept Ritz
+    // vectors are formed in computeKeptRitz.
+    arrow_eigensolver.compute(alpha + num_locked, beta + num_locked, dim, arrow_pos);
 
     for (int i = 0; i < dim; i++) {
-      residua[i + num_locked] = fabs(beta[n_kr - 1] * eigensolver.eigenvectors().col(i)[dim - 1]);
+      residua[i + num_locked] = fabs(beta[n_kr - 1] * arrow_eigensolver.lastRow()[i]);
       // Update the alpha array
-      alpha[i + num_locked] = eigensolver.eigenvalues()[i];
+      alpha[i + num_locked] = arrow_eigensolver.eigenvalues()[i];
     }
 
     // Put spectrum back in order
@@ -342,6 +376,10 @@ namespace quda
     int offset = n_kr + 1;
     int dim = n_kr - num_locked;
 
+    // Form the kept Ritz vectors
+    ritz_mat.resize(dim * iter_keep);
+    arrow_eigensolver.eigenvectors(ritz_mat.data(), iter_keep);
+
     // Multi-BLAS friendly array to store part of Ritz matrix we want
     double *ritz_mat_keep = (double *)safe_malloc((dim * iter_keep) * sizeof(double));
     for (int j = 0; j < dim; j++) {
@@ -353,6 +391,12 @@ namespace quda
     // Update residual vector
     std::swap(kSpace[num_locked + iter_keep], kSpace[n_kr]);
 
+    // The kept Ritz vectors are combinations of the active window, so
+    // inherit its largest overlap with the locked space
+    double overlap = *std::max_element(locked_overlap.begin() + num_locked, locked_overlap.begin() + n_kr);
+    std::fill(locked_overlap.begin() + num_locked, locked_overlap.begin() + num_locked + iter_keep, overlap);
+    locked_overlap[num_locked + iter_keep] = locked_overlap[n_kr];
+
     // Update sub arrow matrix
     for (int i = 0; i < iter_keep; i++) beta[i + num_locked] = beta[n_kr - 1] * ritz_mat[dim * (i + 1) - 1];
 
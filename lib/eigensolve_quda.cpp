@@ -5,6 +5,7 @@
 #include <vector>
 #include <algorithm>
 #include <cfloat>
+#include <limits>
 
 #include <quda_internal.h>
 #include <eigensolve_quda.h>
@@ -16,10 +17,88 @@
 #include <tune_quda.h>
 #include <vector_io.h>
 #include <eigen_helper.h>
+#include <device.h>
+#include <unistd.h>
 
 namespace quda
 {
 
+  namespace
+  {
+    /** Number of Lanczos steps used to estimate the spectrum for the Chebyshev parameters */
+    constexpr int cheby_lanczos_steps = 40;
+
+    /** Largest polynomial degree considered when choosing it automatically */
+    constexpr int cheby_max_deg = 1000;
+
+    /** Number of Chebyshev parameter sets that are cached */
+    constexpr unsigned int cheby_cache_size = 16;
+
+    /**
+       Chebyshev parameters chosen for an operator.  The operator is
+       identified by |A v_0|^2 and v_0^dag A v_0 for a fixed random
+       vector v_0, which changes with the gauge field as well as the
+       operator parameters, together with the solver parameters the
+       choice depends on.
+    */
+    struct ChebyParam {
+      double fingerprint[2];
+      QudaPrecision precision;
+      int n_conv;
+      int n_kr;
+      double tol;
+      int poly_deg_in;
+      double a_min_in;
+      double a_max_in;
+      int poly_deg;
+      double a_min;
+      double a_max;
+    };
+
+    std::vector<ChebyParam> cheby_cache;
+
+    /**
+       @return log(cosh(a) - cosh(b)) for a > b >= 0, without overflow
+    */
+    double logCoshDiff(double a, double b)
+    {
+      if (a < 20.0) return std::log(std::cosh(a) - std::cosh(b));
+      return a - std::log(2.0) + std::log1p(-std::exp(b - a) * (1.0 + std::exp(-2.0 * b)));
+    }
+
+    /**
+       @return log(cosh(a) + 1) without overflow
+    */
+    double logCoshPlusOne(double a) { return a < 20.0 ? std::log(std::cosh(a) + 1.0) : a - std::log(2.0); }
+
+    /**
+       @brief Model of the eigenvalue counting function from the Ritz
+       values and weights of a short Lanczos run: linear between the
+       Ritz values, and a power law between the lower spectral bound
+       and the first Ritz value, with the exponent fitted to the first
+       two Ritz values.
+    */
+    struct SpectrumModel {
+      std::vector<double> lambda; /** Ritz values in ascending order */
+      std::vector<double> count;  /** Estimated number of eigenvalues below each Ritz value */
+      double lo;                  /** Lower bound of the spectrum */
+      double p = 2.0;             /** Exponent of the power law below the first Ritz value */
+
+      /**
+         @param[in] n Eigenvalue count
+         @return The estimated n-th eigenvalue
+      */
+      double operator()(double n) const
+      {
+        if (n <= count[0]) return lo + (lambda[0] - lo) * std::pow(n / count[0], 1.0 / p);
+        for (auto k = 1u; k < count.size(); k++)
+          if (n <= count[k])
+            return lambda[k - 1] + (lambda[k] - lambda[k - 1]) * (n - count[k - 1]) / (count[k] - count[k - 1]);
+        return lambda.back();
+      }
+    };
+  } // namespace
+
   // Eigensolver class
   //-----------------------------------------------------------------------------
   EigenSolver::EigenSolver(const DiracMatrix &mat, QudaEigParam *eig_param, TimeProfile &profile) :
@@ -49,6 +128,9 @@ namespace quda
     check_interval = eig_param->check_interval;
     batched_rotate = eig_param->batched_rotate;
     block_size = eig_param->block_size;
+    poly_deg_in = eig_param->poly_deg;
+    a_min_in = eig_param->a_min;
+    a_max_in = eig_param->a_max;
     iter = 0;
     iter_converged = 0;
     iter_locked = 0;
@@ -170,11 +252,75 @@ namespace quda
 
   void EigenSolver::checkChebyOpMax(const DiracMatrix &mat, std::vector<ColorSpinorField *> &kSpace)
   {
-    if (eig_param->use_poly_acc && eig_param->a_max <= 0.0) {
-      // Use part of the kSpace as temps
-      eig_param->a_max = estimateChebyOpMax(mat, *kSpace[block_size + 2], *kSpace[block_size + 1]);
-      if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Chebyshev maximum estimate: %e.\n", eig_param->a_max);
+    if (!eig_param->use_poly_acc) return;
+    if (eig_param->poly_deg > 0 && eig_param->a_min > 0.0 && eig_param->a_max > 0.0) return;
+    if ((eig_param->poly_deg <= 0 || eig_param->a_min <= 0.0) && eig_param->spectrum != QUDA_SPECTRUM_SR_EIG)
+      errorQuda("Automatic Chebyshev parameters are only supported for the SR spectrum");
+
+    // Use part of the kSpace as temps
+    std::vector<ColorSpinorField *> v {kSpace[block_size + 1], kSpace[block_size + 2], kSpace[block_size + 3]};
+
+    // Fixed starting vector, whose image identifies the operator.  The
+    // noise is always drawn from a seeded RNG on the device, since the
+    // host random source is unseeded and would never match the cache.
+    if (v[0]->Location() == QUDA_CPU_FIELD_LOCATION) {
+      ColorSpinorParam csParam(*v[0]);
+      csParam.setPrecision(v[0]->Precision(), v[0]->Precision(), true); // ensure native ordering
+      csParam.location = QUDA_CUDA_FIELD_LOCATION;
+      csParam.create = QUDA_NULL_FIELD_CREATE;
+      ColorSpinorField *noise = ColorSpinorField::Create(csParam);
+      RNG *rng = new RNG(*noise, 1234);
+      spinorNoise(*noise, *rng, QUDA_NOISE_UNIFORM);
+      delete rng;
+      *v[0] = *noise;
+      delete noise;
+    } else {
+      RNG *rng = new RNG(*v[0], 1234);
+      spinorNoise(*v[0], *rng, QUDA_NOISE_UNIFORM);
+      delete rng;
     }
+    blas::ax(1.0 / sqrt(blas::norm2(*v[0])), *v[0]);
+    matVec(mat, *v[1], *v[0]);
+    double fingerprint[2] = {blas::norm2(*v[1]), blas::reDotProduct(*v[0], *v[1])};
+
+    // Matching tolerates differences in reduction order
+    double fingerprint_tol = 1e3 * setEpsilon(v[0]->Precision());
+    auto match = [&](const ChebyParam &c) {
+      return fabs(c.fingerprint[0] - fingerprint[0]) <= fingerprint_tol * fabs(fingerprint[0])
+        && fabs(c.fingerprint[1] - fingerprint[1]) <= fingerprint_tol * fabs(fingerprint[1])
+        && c.precision == v[0]->Precision() && c.n_conv == n_conv && c.n_kr == n_kr && c.tol == tol
+        && c.poly_deg_in == eig_param->poly_deg && c.a_min_in == eig_param->a_min && c.a_max_in == eig_param->a_max;
+    };
+    auto cached = std::find_if(cheby_cache.begin(), cheby_cache.end(), match);
+
+    if (cached != cheby_cache.end()) {
+      eig_param->poly_deg = cached->poly_deg;
+      eig_param->a_min = cached->a_min;
+      eig_param->a_max = cached->a_max;
+      if (getVerbosity() >= QUDA_SUMMARIZE)
+        printfQuda("Chebyshev parameters (cached): poly_deg %d, a_min %e, a_max %e\n", eig_param->poly_deg,
+                   eig_param->a_min, eig_param->a_max);
+      return;
+    }
+
+    ChebyParam param;
+    param.fingerprint[0] = fingerprint[0];
+    param.fingerprint[1] = fingerprint[1];
+    param.precision = v[0]->Precision();
+    param.n_conv = n_conv;
+    param.n_kr = n_kr;
+    param.tol = tol;
+    param.poly_deg_in = eig_param->poly_deg;
+    param.a_min_in = eig_param->a_min;
+    param.a_max_in = eig_param->a_max;
+
+    estimateChebyParams(mat, v);
+
+    param.poly_deg = eig_param->poly_deg;
+    param.a_min = eig_param->a_min;
+    param.a_max = eig_param->a_max;
+    if (cheby_cache.size() == cheby_cache_size) cheby_cache.erase(cheby_cache.begin());
+    cheby_cache.push_back(param);
   }
 
   void EigenSolver::prepareKrylovSpace(std::vector<ColorSpinorField *> &kSpace, std::vector<Complex> &evals)
@@ -239,6 +385,12 @@ namespace quda
 
   void EigenSolver::cleanUpEigensolver(std::vector<ColorSpinorField *> &kSpace, std::vector<Complex> &evals)
   {
+    // Restore the Chebyshev parameters, such that automatically chosen
+    // ones are chosen afresh for the next operator
+    eig_param->poly_deg = poly_deg_in;
+    eig_param->a_min = a_min_in;
+    eig_param->a_max = a_max_in;
+
     for (int b = 0; b < block_size; b++) delete r[b];
     r.resize(0);
 
@@ -307,6 +459,28 @@ namespace quda
   }
 
   void EigenSolver::chebyOp(const DiracMatrix &mat, ColorSpinorField &out, const ColorSpinorField &in)
+  {
+    std::vector<ColorSpinorField *> out_set {&out};
+    std::vector<ColorSpinorField *> in_set {const_cast<ColorSpinorField *>(&in)};
+    chebyOp(mat, out_set, in_set);
+  }
+
+  void EigenSolver::matVec(const DiracMatrix &mat, std::vector<ColorSpinorField *> &out,
+                           const std::vector<ColorSpinorField *> &in)
+  {
+    if (!tmp1 || !tmp2) {
+      ColorSpinorParam param(*in[0]);
+      if (!tmp1) tmp1 = ColorSpinorField::Create(param);
+      if (!tmp2) tmp2 = ColorSpinorField::Create(param);
+    }
+    mat(out, in, *tmp1, *tmp2);
+
+    // Save matrix * vector tuning
+    saveTuneCache();
+  }
+
+  void EigenSolver::chebyOp(const DiracMatrix &mat, std::vector<ColorSpinorField *> &out,
+                            const std::vector<ColorSpinorField *> &in)
   {
     // Just do a simple matVec if no poly acc is requested
     if (!eig_param->use_poly_acc) {
@@ -316,7 +490,8 @@ namespace quda
 
     if (eig_param->poly_deg == 0) { errorQuda("Polynomial acceleration requested with zero polynomial degree"); }
 
-    // Compute the polynomial accelerated operator.
+    // Compute the polynomial accelerated operator, with each matVec
+    // applied to the whole set
     double a = eig_param->a_min;
     double b = eig_param->a_max;
     double delta = (b - a) / 2.0;
@@ -327,89 +502,212 @@ namespace quda
     double d2 = 1.0;
     double d3;
 
+    const int n = in.size();
+
     // out = d2 * in + d1 * out
     // C_1(x) = x
     matVec(mat, out, in);
-    blas::caxpby(d2, const_cast<ColorSpinorField &>(in), d1, out);
+    for (int i = 0; i < n; i++) blas::caxpby(d2, *in[i], d1, *out[i]);
     if (eig_param->poly_deg == 1) return;
 
-    // C_0 is the current 'in'  vector.
-    // C_1 is the current 'out' vector.
-
-    // Clone 'in' to two temporary vectors.
-    ColorSpinorField *tmp1 = ColorSpinorField::Create(in);
-    ColorSpinorField *tmp2 = ColorSpinorField::Create(in);
-
-    blas::copy(*tmp1, in);
-    blas::copy(*tmp2, out);
-
     // Using Chebyshev polynomial recursion relation,
     // C_{m+1}(x) = 2*x*C_{m} - C_{m-1}
+    // C_{m-1} and C_{m}
+    std::vector<ColorSpinorField *> c_prev, c_curr;
+    c_prev.reserve(n);
+    c_curr.reserve(n);
+    for (int i = 0; i < n; i++) {
+      c_prev.push_back(ColorSpinorField::Create(*in[i]));
+      c_curr.push_back(ColorSpinorField::Create(*in[i]));
+      blas::copy(*c_prev[i], *in[i]);
+      blas::copy(*c_curr[i], *out[i]);
+    }
 
     double sigma_old = sigma1;
 
     // construct C_{m+1}(x)
-    for (int i = 2; i < eig_param->poly_deg; i++) {
+    for (int m = 2; m < eig_param->poly_deg; m++) {
       sigma = 1.0 / (2.0 / sigma1 - sigma_old);
 
       d1 = 2.0 * sigma / delta;
       d2 = -d1 * theta;
       d3 = -sigma * sigma_old;
 
-      // FIXME - we could introduce a fused matVec + blas kernel here, eliminating one temporary
       // mat*C_{m}(x)
-      matVec(mat, out, *tmp2);
+      matVec(mat, out, c_curr);
 
       Complex d1c(d1, 0.0);
       Complex d2c(d2, 0.0);
       Complex d3c(d3, 0.0);
-      blas::caxpbypczw(d3c, *tmp1, d2c, *tmp2, d1c, out, *tmp1);
-      std::swap(tmp1, tmp2);
+      for (int i = 0; i < n; i++) blas::caxpbypczw(d3c, *c_prev[i], d2c, *c_curr[i], d1c, *out[i], *c_prev[i]);
+      std::swap(c_prev, c_curr);
 
       sigma_old = sigma;
     }
-    blas::copy(out, *tmp2);
 
-    delete tmp1;
-    delete tmp2;
+    for (int i = 0; i < n; i++) {
+      blas::copy(*out[i], *c_curr[i]);
+      delete c_prev[i];
+      delete c_curr[i];
+    }
 
     // Save Chebyshev tuning
     saveTuneCache();
   }
 
-  double EigenSolver::estimateChebyOpMax(const DiracMatrix &mat, ColorSpinorField &out, ColorSpinorField &in)
+  void EigenSolver::estimateChebyParams(const DiracMatrix &mat, std::vector<ColorSpinorField *> &v)
   {
+    // Lanczos without reorthogonalization: spurious copies of
+    // converged Ritz values only split their weight
+    const double n_tot = static_cast<double>(v[0]->Volume()) * v[0]->Nspin() * v[0]->Ncolor() * comm_size();
+    const int max_steps = static_cast<int>(std::min<double>(cheby_lanczos_steps, n_tot));
+    std::vector<double> alpha;
+    std::vector<double> beta;
+
+    ColorSpinorField *v_prev = v[2];
+    ColorSpinorField *v_curr = v[0];
+    ColorSpinorField *w = v[1];
+    blas::zero(*v_prev);
+
+    host_timer_t step_timer;
+    step_timer.start();
+    for (int j = 0; j < max_steps; j++) {
+      matVec(mat, *w, *v_curr);
+      alpha.push_back(blas::reDotProduct(*v_curr, *w));
+      blas::axpy(-alpha[j], *v_curr, *w);
+      if (j > 0) blas::axpy(-beta[j - 1], *v_prev, *w);
+      beta.push_back(sqrt(blas::norm2(*w)));
+      if (beta[j] <= setEpsilon(w->Precision()) * fabs(alpha[j])) break;
+
+      blas::ax(1.0 / beta[j], *w);
+      std::swap(v_prev, v_curr);
+      std::swap(v_curr, w);
+    }
+    step_timer.stop();
+    const int m = alpha.size();
+    const double t_step = step_timer.last() / m;
+
+    // Cost of orthogonalizing against one vector
+    constexpr int n_orth = 4;
+    host_timer_t orth_timer;
+    orth_timer.start();
+    for (int i = 0; i < n_orth; i++) blas::axpy(-blas::reDotProduct(*v_prev, *v_curr), *v_prev, *v_curr);
+    orth_timer.stop();
+    const double t_vec = orth_timer.last() / n_orth;
+
+    // Ritz values, weights in the starting vector and error bounds
+    profile.TPSTART(QUDA_PROFILE_EIGEN);
+    VectorXd diag = Map<VectorXd>(alpha.data(), m);
+    VectorXd sub_diag = Map<VectorXd>(beta.data(), m).head(m - 1);
+    SelfAdjointEigenSolver<MatrixXd> tridiag;
+    tridiag.computeFromTridiagonal(diag, sub_diag, ComputeEigenvectors);
+    const VectorXd &theta = tridiag.eigenvalues();
+    const MatrixXd &s = tridiag.eigenvectors();
+    profile.TPSTOP(QUDA_PROFILE_EIGEN);
+
+    const double lo_bound = theta[0] - beta[m - 1] * fabs(s(m - 1, 0));
+    const double hi_bound = theta[m - 1] + beta[m - 1] * fabs(s(m - 1, m - 1));
+
+    // The largest eigenvalue must lie in the damped interval
+    if (eig_param->a_max <= 0.0) eig_param->a_max = 1.01 * hi_bound;
+    const double a_max = eig_param->a_max;
+
+    SpectrumModel spectrum;
+    spectrum.lo = eig_param->use_norm_op ? std::max(lo_bound, 0.0) : lo_bound;
+    double cumulative = 0.0;
+    for (int k = 0; k < m; k++) {
+      double weight = s(0, k) * s(0, k);
+      spectrum.lambda.push_back(theta[k]);
+      spectrum.count.push_back(n_tot * (cumulative + 0.5 * weight));
+      cumulative += weight;
+    }
+    if (m > 1 && theta[0] > spectrum.lo && theta[1] > theta[0]) {
+      double p = std::log(spectrum.count[1] / spectrum.count[0]) / std::log((theta[1] - spectrum.lo) / (theta[0] - spectrum.lo));
+      if (std::isfinite(p)) spectrum.p = std::min(std::max(p, 0.5), 4.0);
+    }
+
+    // The n_conv-th eigenvalue must be resolved from the first
+    // eigenvalue that does not fit in the Krylov space
+    const double lambda_conv = spectrum(n_conv);
+    const double lambda_out = spectrum(n_kr + 1);
+    const double log_tol = std::log(2.0 / tol) + 0.5 * std::log(n_tot);
 
-    if (in.Location() == QUDA_CPU_FIELD_LOCATION) {
-      in.Source(QUDA_RANDOM_SOURCE);
+    std::vector<double> a_min_candidates;
+    if (eig_param->a_min > 0.0) {
+      a_min_candidates.push_back(eig_param->a_min);
     } else {
-      RNG *rng = new RNG(in, 1234);
-      spinorNoise(in, *rng, QUDA_NOISE_UNIFORM);
-      delete rng;
+      // a_min placed above between n_conv + 1 and 4 n_kr eigenvalues
+      constexpr int n_candidate = 16;
+      for (int i = 0; i < n_candidate; i++)
+        a_min_candidates.push_back(spectrum((n_conv + 1) * std::pow(4.0 * n_kr / (n_conv + 1), i / (n_candidate - 1.0))));
     }
 
-    ColorSpinorField *in_ptr = &in;
-    ColorSpinorField *out_ptr = &out;
+    std::vector<int> deg_candidates;
+    if (eig_param->poly_deg > 0) {
+      deg_candidates.push_back(eig_param->poly_deg);
+    } else {
+      for (int deg = 1; deg <= cheby_max_deg; deg = std::max(deg + 1, static_cast<int>(1.1 * deg)))
+        deg_candidates.push_back(deg);
+    }
 
-    // Power iteration
-    double norm = 0.0;
-    for (int i = 0; i < 100; i++) {
-      if ((i + 1) % 10 == 0) {
-        norm = sqrt(blas::norm2(*in_ptr));
-        blas::ax(1.0 / norm, *in_ptr);
+    double cost_best = std::numeric_limits<double>::max();
+    int deg_best = deg_candidates[0];
+    double a_min_best = a_min_candidates[0];
+    for (auto a_min : a_min_candidates) {
+      if (a_min <= lambda_conv || a_min >= a_max) continue;
+
+      // Chebyshev argument of an eigenvalue below a_min, its image is cosh(deg * acosh(y))
+      auto acosh_y = [&](double lambda) {
+        return lambda < a_min ? std::acosh(fabs((2.0 * lambda - a_max - a_min) / (a_max - a_min))) : 0.0;
+      };
+      double acosh_conv = acosh_y(lambda_conv);
+      double acosh_out = acosh_y(lambda_out);
+      std::vector<double> acosh_below(n_conv - 1);
+      for (int j = 1; j < n_conv; j++) acosh_below[j - 1] = acosh_y(spectrum(j));
+
+      for (auto deg : deg_candidates) {
+        // Kaniel-Paige-Saad: gap ratio to the first unresolved
+        // eigenvalue, and the penalty from the eigenvalues below
+        double x_conv = deg * acosh_conv;
+        double x_out = deg * acosh_out;
+        if (x_conv <= x_out) continue;
+        double rate = std::acosh(1.0 + 2.0 * std::exp(logCoshDiff(x_conv, x_out) - logCoshPlusOne(x_out)));
+        if (!(rate > 0.0)) continue;
+        double penalty = 0.0;
+        for (auto a : acosh_below) {
+          if (deg * a <= x_conv) {
+            penalty = std::numeric_limits<double>::infinity();
+            break;
+          }
+          penalty += logCoshPlusOne(deg * a) - logCoshDiff(deg * a, x_conv);
+        }
+
+        double steps = std::max<double>(n_kr, n_conv + (log_tol + penalty) / rate);
+        double cost = steps * (deg * t_step + 0.5 * n_kr * t_vec);
+        if (cost < cost_best) {
+          cost_best = cost;
+          deg_best = deg;
+          a_min_best = a_min;
+        }
       }
-      matVec(mat, *out_ptr, *in_ptr);
-      std::swap(out_ptr, in_ptr);
     }
 
-    // Compute spectral radius estimate
-    double result = blas::reDotProduct(*out_ptr, *in_ptr);
+    if (cost_best == std::numeric_limits<double>::max()) {
+      if (eig_param->a_min <= 0.0) errorQuda("Unable to choose a_min below a_max = %e", a_max);
+      if (eig_param->poly_deg <= 0) errorQuda("Unable to choose a polynomial degree for a_min = %e", eig_param->a_min);
+    }
+    eig_param->a_min = a_min_best;
+    eig_param->poly_deg = deg_best;
 
-    // Save Chebyshev Max tuning
-    saveTuneCache();
+    if (getVerbosity() >= QUDA_SUMMARIZE) {
+      printfQuda("Chebyshev parameters (estimated from %d Lanczos steps): poly_deg %d, a_min %e, a_max %e\n", m,
+                 eig_param->poly_deg, eig_param->a_min, eig_param->a_max);
+      printfQuda("Spectrum estimate [%e, %e], eigenvalue %d ~ %e, eigenvalue %d ~ %e, model cost %.0f matvecs\n",
+                 spectrum.lo, hi_bound, n_conv, lambda_conv, n_kr + 1, lambda_out, cost_best / t_step);
+    }
 
-    // Increase final result by 10% for safety
-    return result * 1.10;
+    // Save Chebyshev estimate tuning
+    saveTuneCache();
   }
 
   bool EigenSolver::orthoCheck(std::vector<ColorSpinorField *> vecs, int size)
@@ -454,13 +752,21 @@ namespace quda
     vecs_ptr.reserve(size);
     for (int i = 0; i < size; i++) vecs_ptr.push_back(vecs[i]);
 
+    // Right-looking form: once vector i is normalised, it is projected
+    // out of all later vectors with a single block dot product and
+    // block caxpy.  Each later vector sees the same sequence of
+    // projections as in the left-looking form.
+    std::vector<Complex> cnorm(size);
     for (int i = 0; i < size; i++) {
-      for (int j = 0; j < i; j++) {
-        Complex cnorm = blas::cDotProduct(*vecs_ptr[j], *vecs_ptr[i]); // <j|i> with i normalised.
-        blas::caxpy(-cnorm, *vecs_ptr[j], *vecs_ptr[i]);               // i = i - proj_{j}(i) = i - <j|i> * i
-      }
       double norm = sqrt(blas::norm2(*vecs_ptr[i]));
       blas::ax(1.0 / norm, *vecs_ptr[i]); // i/<i|i>
+      if (i == size - 1) break;
+
+      std::vector<ColorSpinorField *> vec_i = {vecs_ptr[i]};
+      std::vector<ColorSpinorField *> vec_rest(vecs_ptr.begin() + i + 1, vecs_ptr.end());
+      blas::cDotProduct(cnorm.data(), vec_i, vec_rest); // <i|j> for j > i
+      for (int j = 0; j < size - i - 1; j++) cnorm[j] = -cnorm[j];
+      blas::caxpy(cnorm.data(), vec_i, vec_rest); // j = j - <i|j> * i
     }
   }
 
@@ -524,7 +830,7 @@ namespace quda
   }
 
   void EigenSolver::blockRotate(std::vector<ColorSpinorField *> &kSpace, double *array, int rank, const range &i_range,
-                                const range &j_range, blockType b_type)
+                                const range &j_range, blockType b_type, int offset)
   {
     int block_i_rank = i_range.second - i_range.first;
     int block_j_rank = j_range.second - j_range.first;
@@ -542,7 +848,7 @@ namespace quda
     // Alias the extra space vectors
     kSpace_ptr.reserve(block_j_rank);
     for (int j = j_range.first; j < j_range.second; j++) {
-      int k = n_kr + 1 + j - j_range.first;
+      int k = offset + j - j_range.first;
       kSpace_ptr.push_back(kSpace[k]);
     }
 
@@ -914,31 +1220,75 @@ namespace quda
     }
   }
 
+  /**
+     @brief Return the host memory available to allocate the rotation
+     workspace.  Where the platform does not report this (e.g.,
+     _SC_AVPHYS_PAGES is a glibc extension), we return zero, such
+     that the rotation only uses the minimum workspace.
+     @return The available host memory in bytes
+  */
+  static size_t host_free_memory()
+  {
+#if defined(_SC_AVPHYS_PAGES) && defined(_SC_PAGESIZE)
+    long pages = sysconf(_SC_AVPHYS_PAGES);
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (pages > 0 && page_size > 0) return static_cast<size_t>(pages) * static_cast<size_t>(page_size);
+#endif
+    return 0;
+  }
+
+  int EigenSolver::rotateBatchSize(const std::vector<ColorSpinorField *> &kSpace, int offset, int keep)
+  {
+    // a user-specified batch size takes precedence
+    if (batched_rotate > 0) return std::min(batched_rotate, keep);
+
+    // workspace vectors allocated by a previous rotation come for free
+    int n_alloc = std::max(static_cast<int>(kSpace.size()) - offset, 0);
+    if (n_alloc >= keep) return keep;
+
+    size_t free_bytes
+      = kSpace[0]->Location() == QUDA_CUDA_FIELD_LOCATION ? device::free_memory() : host_free_memory();
+
+    // leave some headroom for the rest of the solver, and ensure all
+    // processes agree on the path taken
+    double n_free = rotate_memory_fraction * free_bytes / kSpace[0]->TotalBytes();
+    comm_allreduce_min(&n_free);
+
+    int batch_size = std::max(1, static_cast<int>(std::min(static_cast<double>(keep), n_alloc + n_free)));
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("Ritz rotation of %d vectors using %d workspace vectors\n", keep, batch_size);
+    return batch_size;
+  }
+
   void EigenSolver::rotateVecsComplex(std::vector<ColorSpinorField *> &kSpace, const Complex *rot_array, const int offset,
                                       const int dim, const int keep, const int locked, TimeProfile &profile)
   {
-    // If we have memory availible, do the entire rotation
-    if (batched_rotate <= 0 || batched_rotate >= keep) {
-      if ((int)kSpace.size() < offset + keep) {
-        ColorSpinorParam csParamClone(*kSpace[0]);
-        csParamClone.create = QUDA_ZERO_FIELD_CREATE;
-        if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Resizing kSpace to %d vectors\n", n_kr + keep);
-        kSpace.reserve(offset + keep);
-        for (int i = kSpace.size(); i < offset + keep; i++) {
-          kSpace.push_back(ColorSpinorField::Create(csParamClone));
-        }
+    int batch_size = rotateBatchSize(kSpace, offset, keep);
+
+    if ((int)kSpace.size() < offset + batch_size) {
+      ColorSpinorParam csParamClone(*kSpace[0]);
+      csParamClone.create = QUDA_ZERO_FIELD_CREATE;
+      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Resizing kSpace to %d vectors\n", offset + batch_size);
+      kSpace.reserve(offset + batch_size);
+      for (int i = kSpace.size(); i < offset + batch_size; i++) {
+        kSpace.push_back(ColorSpinorField::Create(csParamClone));
       }
+    }
 
-      // Pointers to the relevant vectors
-      std::vector<ColorSpinorField *> vecs_ptr;
-      std::vector<ColorSpinorField *> kSpace_ptr;
+    // Pointers to the relevant vectors
+    std::vector<ColorSpinorField *> kSpace_ptr;
 
-      // Alias the extra space vectors, zero the workspace
-      kSpace_ptr.reserve(keep);
-      for (int i = 0; i < keep; i++) {
-        kSpace_ptr.push_back(kSpace[offset + i]);
-        blas::zero(*kSpace_ptr[i]);
-      }
+    // Alias the extra space vectors, zero the workspace
+    kSpace_ptr.reserve(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+      kSpace_ptr.push_back(kSpace[offset + i]);
+      blas::zero(*kSpace_ptr[i]);
+    }
+
+    // If we have memory available, do the entire rotation as a single
+    // tiled multiBLAS, which reads each vector once per output tile
+    if (batch_size >= keep) {
+      std::vector<ColorSpinorField *> vecs_ptr;
 
       // Alias the vectors we wish to compress.
       vecs_ptr.reserve(dim);
@@ -955,21 +1305,6 @@ namespace quda
     } else {
 
       // Do batched rotation to save on memory
-      int batch_size = batched_rotate;
-      int full_batches = keep / batch_size;
-      int batch_size_r = keep % batch_size;
-      bool do_batch_remainder = (batch_size_r != 0 ? true : false);
-
-      if ((int)kSpace.size() < offset + batch_size) {
-        ColorSpinorParam csParamClone(*kSpace[0]);
-        csParamClone.create = QUDA_ZERO_FIELD_CREATE;
-        if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Resizing kSpace to %d vectors\n", offset + batch_size);
-        kSpace.reserve(offset + batch_size);
-        for (int i = kSpace.size(); i < offset + batch_size; i++) {
-          kSpace.push_back(ColorSpinorField::Create(csParamClone));
-        }
-      }
-
       profile.TPSTART(QUDA_PROFILE_EIGENLU);
       MatrixXcd mat = MatrixXcd::Zero(dim, keep);
       for (int j = 0; j < keep; j++)
@@ -1003,52 +1338,22 @@ namespace quda
 
       // Do L Multiply
       //---------------------------------------------------------------------------
-      // Loop over full batches
-      for (int b = 0; b < full_batches; b++) {
-
-        // batch triangle
-        blockRotateComplex(kSpace, matLower.data(), dim, {b * batch_size, (b + 1) * batch_size},
-                           {b * batch_size, (b + 1) * batch_size}, LOWER_TRI, offset);
-        // batch pencil
-        blockRotateComplex(kSpace, matLower.data(), dim, {(b + 1) * batch_size, dim},
-                           {b * batch_size, (b + 1) * batch_size}, PENCIL, offset);
-        blockReset(kSpace, b * batch_size, (b + 1) * batch_size, offset);
-      }
-      if (do_batch_remainder) {
-        // remainder triangle
-        blockRotateComplex(kSpace, matLower.data(), dim, {full_batches * batch_size, keep},
-                           {full_batches * batch_size, keep}, LOWER_TRI, offset);
-        // remainder pencil
-        if (keep < dim) {
-          blockRotateComplex(kSpace, matLower.data(), dim, {keep, dim}, {full_batches * batch_size, keep}, PENCIL,
-                             offset);
-        }
-        blockReset(kSpace, full_batches * batch_size, keep, offset);
+      // Each batch of outputs depends only on the vectors at and below
+      // it, so is formed by a single multiBLAS over the trapezoid
+      for (int b_start = 0; b_start < keep; b_start += batch_size) {
+        int b_end = std::min(b_start + batch_size, keep);
+        blockRotateComplex(kSpace, matLower.data(), dim, {b_start, dim}, {b_start, b_end}, PENCIL, offset);
+        blockReset(kSpace, b_start, b_end, offset);
       }
 
       // Do U Multiply
       //---------------------------------------------------------------------------
-      if (do_batch_remainder) {
-        // remainder triangle
-        blockRotateComplex(kSpace, matUpper.data(), keep, {full_batches * batch_size, keep},
-                           {full_batches * batch_size, keep}, UPPER_TRI, offset);
-        // remainder pencil
-        blockRotateComplex(kSpace, matUpper.data(), keep, {0, full_batches * batch_size},
-                           {full_batches * batch_size, keep}, PENCIL, offset);
-        blockReset(kSpace, full_batches * batch_size, keep, offset);
-      }
-
-      // Loop over full batches
-      for (int b = full_batches - 1; b >= 0; b--) {
-        // batch triangle
-        blockRotateComplex(kSpace, matUpper.data(), keep, {b * batch_size, (b + 1) * batch_size},
-                           {b * batch_size, (b + 1) * batch_size}, UPPER_TRI, offset);
-        if (b > 0) {
-          // batch pencil
-          blockRotateComplex(kSpace, matUpper.data(), keep, {0, b * batch_size}, {b * batch_size, (b + 1) * batch_size},
-                             PENCIL, offset);
-        }
-        blockReset(kSpace, b * batch_size, (b + 1) * batch_size, offset);
+      // Each batch of outputs depends only on the vectors at and above
+      // it, so we proceed from the last batch to the first
+      for (int b_start = ((keep - 1) / batch_size) * batch_size; b_start >= 0; b_start -= batch_size) {
+        int b_end = std::min(b_start + batch_size, keep);
+        blockRotateComplex(kSpace, matUpper.data(), keep, {0, b_end}, {b_start, b_end}, PENCIL, offset);
+        blockReset(kSpace, b_start, b_end, offset);
       }
 
       // Do Q Permute
@@ -1061,28 +1366,32 @@ namespace quda
   void EigenSolver::rotateVecs(std::vector<ColorSpinorField *> &kSpace, const double *rot_array, const int offset,
                                const int dim, const int keep, const int locked, TimeProfile &profile)
   {
-    // If we have memory availible, do the entire rotation
-    if (batched_rotate <= 0 || batched_rotate >= keep) {
-      if ((int)kSpace.size() < offset + keep) {
-        ColorSpinorParam csParamClone(*kSpace[0]);
-        csParamClone.create = QUDA_ZERO_FIELD_CREATE;
-        if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Resizing kSpace to %d vectors\n", offset + keep);
-        kSpace.reserve(offset + keep);
-        for (int i = kSpace.size(); i < offset + keep; i++) {
-          kSpace.push_back(ColorSpinorField::Create(csParamClone));
-        }
+    int batch_size = rotateBatchSize(kSpace, offset, keep);
+
+    if ((int)kSpace.size() < offset + batch_size) {
+      ColorSpinorParam csParamClone(*kSpace[0]);
+      csParamClone.create = QUDA_ZERO_FIELD_CREATE;
+      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Resizing kSpace to %d vectors\n", offset + batch_size);
+      kSpace.reserve(offset + batch_size);
+      for (int i = kSpace.size(); i < offset + batch_size; i++) {
+        kSpace.push_back(ColorSpinorField::Create(csParamClone));
       }
+    }
 
-      // Pointers to the relevant vectors
-      std::vector<ColorSpinorField *> vecs_ptr;
-      std::vector<ColorSpinorField *> kSpace_ptr;
+    // Pointers to the relevant vectors
+    std::vector<ColorSpinorField *> kSpace_ptr;
 
-      // Alias the extra space vectors, zero the workspace
-      kSpace_ptr.reserve(keep);
-      for (int i = 0; i < keep; i++) {
-        kSpace_ptr.push_back(kSpace[offset + i]);
-        blas::zero(*kSpace_ptr[i]);
-      }
+    // Alias the extra space vectors, zero the workspace
+    kSpace_ptr.reserve(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+      kSpace_ptr.push_back(kSpace[offset + i]);
+      blas::zero(*kSpace_ptr[i]);
+    }
+
+    // If we have memory available, do the entire rotation as a single
+    // tiled multiBLAS, which reads each vector once per output tile
+    if (batch_size >= keep) {
+      std::vector<ColorSpinorField *> vecs_ptr;
 
       // Alias the vectors we wish to keep.
       vecs_ptr.reserve(dim);
@@ -1098,21 +1407,6 @@ namespace quda
 
     } else {
 
-      int batch_size = batched_rotate;
-      int full_batches = keep / batch_size;
-      int batch_size_r = keep % batch_size;
-      bool do_batch_remainder = (batch_size_r != 0 ? true : false);
-
-      if ((int)kSpace.size() < offset + batch_size) {
-        ColorSpinorParam csParamClone(*kSpace[0]);
-        csParamClone.create = QUDA_ZERO_FIELD_CREATE;
-        if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Resizing kSpace to %d vectors\n", offset + batch_size);
-        kSpace.reserve(offset + batch_size);
-        for (int i = kSpace.size(); i < offset + batch_size; i++) {
-          kSpace.push_back(ColorSpinorField::Create(csParamClone));
-        }
-      }
-
       profile.TPSTART(QUDA_PROFILE_EIGEN);
       MatrixXd mat = MatrixXd::Zero(dim, keep);
       for (int j = 0; j < keep; j++)
@@ -1146,50 +1440,22 @@ namespace quda
 
       // Do L Multiply
       //---------------------------------------------------------------------------
-      // Loop over full batches
-      for (int b = 0; b < full_batches; b++) {
-
-        // batch triangle
-        blockRotate(kSpace, matLower.data(), dim, {b * batch_size, (b + 1) * batch_size},
-                    {b * batch_size, (b + 1) * batch_size}, LOWER_TRI);
-        // batch pencil
-        blockRotate(kSpace, matLower.data(), dim, {(b + 1) * batch_size, dim}, {b * batch_size, (b + 1) * batch_size},
-                    PENCIL);
-        blockReset(kSpace, b * batch_size, (b + 1) * batch_size, offset);
-      }
-      if (do_batch_remainder) {
-        // remainder triangle
-        blockRotate(kSpace, matLower.data(), dim, {full_batches * batch_size, keep}, {full_batches * batch_size, keep},
-                    LOWER_TRI);
-        // remainder pencil
-        if (keep < dim) {
-          blockRotate(kSpace, matLower.data(), dim, {keep, dim}, {full_batches * batch_size, keep}, PENCIL);
-        }
-        blockReset(kSpace, full_batches * batch_size, keep, offset);
+      // Each batch of outputs depends only on the vectors at and below
+      // it, so is formed by a single multiBLAS over the trapezoid
+      for (int b_start = 0; b_start < keep; b_start += batch_size) {
+        int b_end = std::min(b_start + batch_size, keep);
+        blockRotate(kSpace, matLower.data(), dim, {b_start, dim}, {b_start, b_end}, PENCIL, offset);
+        blockReset(kSpace, b_start, b_end, offset);
       }
 
       // Do U Multiply
       //---------------------------------------------------------------------------
-      if (do_batch_remainder) {
-        // remainder triangle
-        blockRotate(kSpace, matUpper.data(), keep, {full_batches * batch_size, keep}, {full_batches * batch_size, keep},
-                    UPPER_TRI);
-        // remainder pencil
-        blockRotate(kSpace, matUpper.data(), keep, {0, full_batches * batch_size}, {full_batches * batch_size, keep},
-                    PENCIL);
-        blockReset(kSpace, full_batches * batch_size, keep, offset);
-      }
-
-      // Loop over full batches
-      for (int b = full_batches - 1; b >= 0; b--) {
-        // batch triangle
-        blockRotate(kSpace, matUpper.data(), keep, {b * batch_size, (b + 1) * batch_size},
-                    {b * batch_size, (b + 1) * batch_size}, UPPER_TRI);
-        if (b > 0) {
-          // batch pencil
-          blockRotate(kSpace, matUpper.data(), keep, {0, b * batch_size}, {b * batch_size, (b + 1) * batch_size}, PENCIL);
-        }
-        blockReset(kSpace, b * batch_size, (b + 1) * batch_size, offset);
+      // Each batch of outputs depends only on the vectors at and above
+      // it, so we proceed from the last batch to the first
+      for (int b_start = ((keep - 1) / batch_size) * batch_size; b_start >= 0; b_start -= batch_size) {
+        int b_end = std::min(b_start + batch_size, keep);
+        blockRotate(kSpace, matUpper.data(), keep, {0, b_end}, {b_start, b_end}, PENCIL, offset);
+        blockReset(kSpace, b_start, b_end, offset);
       }
 
       // Do Q Permute
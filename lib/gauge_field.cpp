@@ -25,7 +25,8 @@ namespace quda {
     staggeredPhaseApplied(u.StaggeredPhaseApplied()),
     i_mu(u.iMu()),
     site_offset(u.SiteOffset()),
-    site_size(u.SiteSize())
+    site_size(u.SiteSize()),
+    block_float(u.BlockFloat())
   { }
 
   GaugeField::GaugeField(const GaugeFieldParam &param) :
@@ -50,7 +51,9 @@ namespace quda {
     staggeredPhaseApplied(param.staggeredPhaseApplied),
     i_mu(param.i_mu),
     site_offset(param.site_offset),
-    site_size(param.site_size)
+    site_size(param.site_size),
+    block_float(param.block_float),
+    block_float_bytes(0)
   {
     if (order == QUDA_NATIVE_GAUGE_ORDER) errorQuda("Invalid gauge order %d", order);
     if (ghost_precision != precision) ghost_precision = precision; // gauge fields require matching precision
@@ -63,6 +66,11 @@ namespace quda {
       errorQuda("Anisotropy only supported for Wilson links");
     if (link_type != QUDA_WILSON_LINKS && fixed == QUDA_GAUGE_FIXED_YES)
       errorQuda("Temporal gauge fixing only supported for Wilson links");
+    if (block_float) {
+      if (link_type != QUDA_COARSE_LINKS) errorQuda("Block floating point only supported for coarse links");
+      if (precision != QUDA_HALF_PRECISION && precision != QUDA_QUARTER_PRECISION)
+        errorQuda("Block floating point requires half or quarter precision, not %d", precision);
+    }
     if (geometry == QUDA_SCALAR_GEOMETRY) {
       real_length = volume*nInternal;
       length = 2*stride*nInternal; // two comes from being full lattice
@@ -100,6 +108,9 @@ namespace quda {
     }
     total_bytes = bytes;
 
+    // one scale factor per parity, direction and padded site
+    if (block_float) block_float_bytes = 2 * geometry * stride * sizeof(float);
+
     setTuningString();
   }
 
@@ -116,6 +127,7 @@ namespace quda {
       snprintf(aux_string, aux_string_n, "vol=%lu,stride=%lu,precision=%d,geometry=%d,Nc=%d", volume, stride, precision,
                geometry, nColor);
     if (check < 0 || check >= aux_string_n) errorQuda("Error writing aux string");
+    if (block_float) strcat(aux_string, ",block_float");
   }
 
   void GaugeField::createGhostZone(const int *R, bool no_comms_fill, bool bidir) const
@@ -290,6 +302,7 @@ namespace quda {
     output << "geometry = " << param.geometry << std::endl;
     output << "staggeredPhaseType = " << param.staggeredPhaseType << std::endl;
     output << "staggeredPhaseApplied = " << param.staggeredPhaseApplied << std::endl;
+    output << "block_float = " << param.block_float << std::endl;
 
     return output;  // for multiple << operators.
   }
@@ -329,6 +342,19 @@ namespace quda {
     return nrm2;
   }
 
+  // Return the L2 norm squared of a - b, overwriting b with the difference
+  double xmyNorm(const GaugeField &a, GaugeField &b) {
+    checkPrecision(a, b);
+    if (a.FieldOrder() != b.FieldOrder() || a.Reconstruct() != b.Reconstruct() || a.Pad() != b.Pad())
+      errorQuda("Mismatched gauge field layouts");
+    ColorSpinorField *x = ColorSpinorField::Create(colorSpinorParam(a));
+    ColorSpinorField *y = ColorSpinorField::Create(colorSpinorParam(b));
+    double nrm2 = blas::xmyNorm(*x, *y);
+    delete y;
+    delete x;
+    return nrm2;
+  }
+
   // Return the L1 norm of the gauge field
   double norm1(const GaugeField &a) {
     ColorSpinorField *b = ColorSpinorField::Create(colorSpinorParam(a));
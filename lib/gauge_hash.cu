@@ -0,0 +1,46 @@
+#include <gauge_field.h>
+#include <host_hash.h>
+#include <instantiate.h>
+#include <tunable_reduction.h>
+#include <kernels/gauge_hash.cuh>
+
+namespace quda {
+
+  template<typename Float, int nColor, QudaReconstructType recon>
+  class GaugeHash : public TunableReduction2D<> {
+    const GaugeField &u;
+    hash_t &hash;
+
+  public:
+    GaugeHash(const GaugeField &u, hash_t &hash) :
+      TunableReduction2D(u),
+      u(u),
+      hash(hash)
+    {
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      GaugeHashArg<Float, nColor, recon> arg(u);
+      launch<LinkHash>(hash, tp, stream, arg);
+    }
+
+    long long flops() const { return 0; }
+    long long bytes() const { return u.Bytes(); }
+  };
+
+  uint64_t gaugeHash(const GaugeField &u)
+  {
+    if (u.Location() != QUDA_CUDA_FIELD_LOCATION) errorQuda("Gauge hash only supported for device fields");
+
+    hash_t words{0, 0, 0, 0};
+    instantiate<GaugeHash>(u, words);
+
+    uint64_t hash = 0;
+    for (int i = 0; i < n_hash_word; i++) hash = hashMix(hash, static_cast<uint64_t>(words[i]));
+    return hash;
+  }
+
+} // namespace quda
@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <comm_quda.h>
+#include <host_hash.h>
+
+namespace quda
+{
+
+  constexpr uint64_t hash_seed = 0xcbf29ce484222325ull;
+
+  /**
+     @brief Sequentially hash a contiguous range of bytes into a
+     running hash, word by word, with any trailing bytes that do not
+     fill a word zero padded.
+  */
+  static uint64_t hashRange(uint64_t hash, const char *data, size_t bytes)
+  {
+    const size_t n_words = bytes / sizeof(uint64_t);
+    for (size_t i = 0; i < n_words; i++) {
+      uint64_t word;
+      memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+      hash = hashMix(hash, word);
+    }
+
+    if (bytes % sizeof(uint64_t)) {
+      uint64_t tail = 0;
+      memcpy(&tail, data + n_words * sizeof(uint64_t), bytes % sizeof(uint64_t));
+      hash = hashMix(hash, tail);
+    }
+    return hash;
+  }
+
+  uint64_t hashHostArray(const void *data, size_t block_bytes, size_t n_block, size_t stride)
+  {
+    if (block_bytes == 0 || n_block == 0) return hashMix(hash_seed, 0);
+
+    // group the blocks into chunks of roughly 512 KiB that are hashed independently
+    const size_t chunk_blocks = std::max<size_t>(1, (static_cast<size_t>(1) << 19) / block_bytes);
+    const long n_chunk = (n_block + chunk_blocks - 1) / chunk_blocks;
+    std::vector<uint64_t> chunk_hash(n_chunk);
+    const char *base = static_cast<const char *>(data);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (long c = 0; c < n_chunk; c++) {
+      uint64_t hash = hash_seed ^ c;
+      const size_t end = std::min(n_block, (c + 1) * chunk_blocks);
+      for (size_t b = c * chunk_blocks; b < end; b++) hash = hashRange(hash, base + b * stride, block_bytes);
+      chunk_hash[c] = hash;
+    }
+
+    uint64_t hash = hashMix(hashMix(hash_seed, block_bytes), n_block);
+    for (auto h : chunk_hash) hash = hashMix(hash, h);
+    return hash;
+  }
+
+  uint64_t hashHostArray(const void *data, size_t bytes)
+  {
+    // treat the array as a sequence of word-aligned blocks plus a remainder
+    constexpr size_t block_bytes = 1 << 12;
+    const size_t n_block = bytes / block_bytes;
+    uint64_t hash = hashHostArray(data, block_bytes, n_block, block_bytes);
+    hash = hashRange(hashMix(hash, bytes), static_cast<const char *>(data) + n_block * block_bytes, bytes % block_bytes);
+    return hash;
+  }
+
+  bool HostCacheKey::hit(uint64_t hash, bool valid) const
+  {
+    int miss = (valid && key != 0 && (hash ? hash : 1) == key) ? 0 : 1;
+    comm_allreduce_int(&miss);
+    return miss == 0;
+  }
+
+} // namespace quda
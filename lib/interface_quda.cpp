@@ -38,6 +38,7 @@
 
 #include <gauge_force_quda.h>
 #include <gauge_update_quda.h>
+#include <host_hash.h>
 
 #define MAX(a,b) ((a)>(b)? (a):(b))
 #define TDIFF(a,b) (b.tv_sec - a.tv_sec + 0.000001*(b.tv_usec - a.tv_usec))
@@ -129,12 +130,26 @@ CloverField *cloverEigensolver = nullptr;
 cudaGaugeField *momResident = nullptr;
 cudaGaugeField *extendedGaugeResident = nullptr;
 
+// device copy of the last gauge field exchanged through a MILC site struct
+static cudaGaugeField *siteGaugeCache = nullptr;
+static HostCacheKey siteGaugeCacheKey;
+
+/**
+   @brief Free the device copy of the last site-struct gauge field
+*/
+static void freeSiteGaugeCache()
+{
+  if (siteGaugeCache) delete siteGaugeCache;
+  siteGaugeCache = nullptr;
+  siteGaugeCacheKey.reset();
+}
+
 std::vector<cudaColorSpinorField*> solutionResident;
 
 // vector of spinors used for forecasting solutions in HMC
 #define QUDA_MAX_CHRONO 12
 // each entry is one p
-std::vector< std::vector<ColorSpinorField*> > chronoResident(QUDA_MAX_CHRONO);
+std::vector<ChronoBasis> chronoResident(QUDA_MAX_CHRONO);
 
 // Mapped memory buffer used to hold unitarization failures
 static int *num_failures_h = nullptr;
@@ -485,7 +500,8 @@ void initQudaDevice(int dev)
       warningQuda("Data reordering done on GPU (set with QUDA_REORDER_LOCATION=GPU/CPU)");
       reorder_location_set(QUDA_CUDA_FIELD_LOCATION);
     } else {
-      warningQuda("Data reordering done on CPU (set with QUDA_REORDER_LOCATION=GPU/CPU)");
+      warningQuda("Data reordering done on CPU using %d host threads (set with QUDA_REORDER_LOCATION=GPU/CPU)",
+                  host_kernel_threads());
       reorder_location_set(QUDA_CPU_FIELD_LOCATION);
     }
   }
@@ -549,7 +565,17 @@ void initQuda(int dev)
 // possible flag to indicate we need to recompute the clover field
 static bool invalidate_clover = true;
 
-void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
+/**
+   @brief Load the gauge field either from a resident host (or
+   device) array, or if a reader is given, streamed from the host in
+   slabs of local time slices.
+   @param[in] h_gauge Base pointer to the gauge field (ignored if streaming)
+   @param[in] reader Optional callback for streaming the host field
+   @param[in] context Auxiliary data passed to the reader
+   @param[in] slab Number of local time slices per streamed slab
+   @param[in] param Contains all metadata regarding host and device storage
+ */
+static void loadGauge(void *h_gauge, QudaGaugeReader reader, void *context, int slab, QudaGaugeParam *param)
 {
   profileGauge.TPSTART(QUDA_PROFILE_TOTAL);
 
@@ -563,11 +589,18 @@ void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
   GaugeFieldParam gauge_param(*param, h_gauge);
 
   if (gauge_param.order <= 4) gauge_param.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
-  GaugeField *in = (param->location == QUDA_CPU_FIELD_LOCATION) ?
-    static_cast<GaugeField*>(new cpuGaugeField(gauge_param)) :
-    static_cast<GaugeField*>(new cudaGaugeField(gauge_param));
+  GaugeField *in = nullptr;
+  if (reader) {
+    if (param->location != QUDA_CPU_FIELD_LOCATION) errorQuda("Streaming gauge load requires a host field");
+    if (param->use_resident_gauge) errorQuda("Streaming gauge load incompatible with use_resident_gauge");
+  } else {
+    in = (param->location == QUDA_CPU_FIELD_LOCATION) ? static_cast<GaugeField *>(new cpuGaugeField(gauge_param)) :
+                                                        static_cast<GaugeField *>(new cudaGaugeField(gauge_param));
+  }
+  // parameters of the host field, used when streaming
+  GaugeFieldParam host_param(gauge_param);
 
-  if (in->Order() == QUDA_BQCD_GAUGE_ORDER) {
+  if (in && in->Order() == QUDA_BQCD_GAUGE_ORDER) {
     static size_t checksum = SIZE_MAX;
     size_t in_checksum = in->checksum(true);
     if (in_checksum == checksum) {
@@ -667,7 +700,15 @@ void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
   } else {
     profileGauge.TPSTOP(QUDA_PROFILE_INIT);
     profileGauge.TPSTART(QUDA_PROFILE_H2D);
-    precise->copy(*in);
+    if (reader) {
+      auto read_slab = [&](cpuGaugeField &slab_field, int t_begin, int t_end) {
+        if (reader(slab_field.Gauge_p(), t_begin, t_end, context) != 0)
+          errorQuda("Gauge reader failed on time slices [%d, %d)", t_begin, t_end);
+      };
+      precise->loadCPUFieldStream(host_param, read_slab, slab);
+    } else {
+      precise->copy(*in);
+    }
     profileGauge.TPSTOP(QUDA_PROFILE_H2D);
   }
 
@@ -804,6 +845,14 @@ void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
   profileGauge.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
+void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param) { loadGauge(h_gauge, nullptr, nullptr, 0, param); }
+
+void loadGaugeStreamQuda(QudaGaugeReader reader, void *context, int slab, QudaGaugeParam *param)
+{
+  if (!reader) errorQuda("No gauge reader given");
+  loadGauge(nullptr, reader, context, slab, param);
+}
+
 void saveGaugeQuda(void *h_gauge, QudaGaugeParam *param)
 {
   profileGauge.TPSTART(QUDA_PROFILE_TOTAL);
@@ -1152,6 +1201,8 @@ void freeGaugeQuda(void)
     delete extendedGaugeResident;
     extendedGaugeResident = nullptr;
   }
+
+  freeSiteGaugeCache();
 }
 
 void loadSloppyGaugeQuda(const QudaPrecision *prec, const QudaReconstructType *recon)
@@ -1397,12 +1448,7 @@ void flushChronoQuda(int i)
   if (i >= QUDA_MAX_CHRONO)
     errorQuda("Requested chrono index %d is outside of max %d\n", i, QUDA_MAX_CHRONO);
 
-  auto &basis = chronoResident[i];
-
-  for (auto v : basis) {
-    if (v)  delete v;
-  }
-  basis.clear();
+  chronoResident[i].clear();
 }
 
 void endQuda(void)
@@ -1867,13 +1913,15 @@ namespace quda {
   }
 }
 
-void dslashQuda(void *h_out, void *h_in, QudaInvertParam *inv_param, QudaParity parity)
+/**
+   @brief Shared preamble of dslashQuda and dslashMultiRHSQuda: check
+   the resident fields the operator needs are allocated and push the
+   verbosity of the solve.  Must be paired with popVerbosity().
+   @param[in] inv_param Parameters of the dslash
+   @return The resident gauge field that sets the lattice geometry
+*/
+static const GaugeField &dslashSetup(QudaInvertParam *inv_param)
 {
-  profileDslash.TPSTART(QUDA_PROFILE_TOTAL);
-  profileDslash.TPSTART(QUDA_PROFILE_INIT);
-
-  const auto &gauge = (inv_param->dslash_type != QUDA_ASQTAD_DSLASH) ? *gaugePrecise : *gaugeFatPrecise;
-
   if ((!gaugePrecise && inv_param->dslash_type != QUDA_ASQTAD_DSLASH)
       || ((!gaugeFatPrecise || !gaugeLongPrecise) && inv_param->dslash_type == QUDA_ASQTAD_DSLASH))
     errorQuda("Gauge field not allocated");
@@ -1883,6 +1931,42 @@ void dslashQuda(void *h_out, void *h_in, QudaInvertParam *inv_param, QudaParity
   pushVerbosity(inv_param->verbosity);
   if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printQudaInvertParam(inv_param);
 
+  return (inv_param->dslash_type != QUDA_ASQTAD_DSLASH) ? *gaugePrecise : *gaugeFatPrecise;
+}
+
+/**
+   @brief Apply the normalization and parity conventions of the
+   interface to the device source of a dslash.
+   @param[in,out] in Device source field
+   @param[in,out] parity Parity the dslash is applied to
+   @param[in] gauge Resident gauge field
+   @param[in] inv_param Parameters of the dslash
+*/
+static void dslashPrepareSource(ColorSpinorField &in, QudaParity &parity, const GaugeField &gauge,
+                                const QudaInvertParam *inv_param)
+{
+  if (inv_param->mass_normalization == QUDA_KAPPA_NORMALIZATION &&
+      (inv_param->dslash_type == QUDA_STAGGERED_DSLASH ||
+       inv_param->dslash_type == QUDA_ASQTAD_DSLASH) )
+    blas::ax(1.0/(2.0*inv_param->mass), in);
+
+  if (inv_param->dirac_order == QUDA_CPS_WILSON_DIRAC_ORDER) {
+    if (parity == QUDA_EVEN_PARITY) {
+      parity = QUDA_ODD_PARITY;
+    } else {
+      parity = QUDA_EVEN_PARITY;
+    }
+    blas::ax(gauge.Anisotropy(), in);
+  }
+}
+
+void dslashQuda(void *h_out, void *h_in, QudaInvertParam *inv_param, QudaParity parity)
+{
+  profileDslash.TPSTART(QUDA_PROFILE_TOTAL);
+  profileDslash.TPSTART(QUDA_PROFILE_INIT);
+
+  const auto &gauge = dslashSetup(inv_param);
+
   ColorSpinorParam cpuParam(h_in, *inv_param, gauge.X(), true, inv_param->input_location);
   ColorSpinorField *in_h = ColorSpinorField::Create(cpuParam);
   ColorSpinorParam cudaParam(cpuParam, *inv_param);
@@ -1913,19 +1997,7 @@ void dslashQuda(void *h_out, void *h_in, QudaInvertParam *inv_param, QudaParity
     printfQuda("In CPU %e CUDA %e\n", cpu, gpu);
   }
 
-  if (inv_param->mass_normalization == QUDA_KAPPA_NORMALIZATION &&
-      (inv_param->dslash_type == QUDA_STAGGERED_DSLASH ||
-       inv_param->dslash_type == QUDA_ASQTAD_DSLASH) )
-    blas::ax(1.0/(2.0*inv_param->mass), in);
-
-  if (inv_param->dirac_order == QUDA_CPS_WILSON_DIRAC_ORDER) {
-    if (parity == QUDA_EVEN_PARITY) {
-      parity = QUDA_ODD_PARITY;
-    } else {
-      parity = QUDA_EVEN_PARITY;
-    }
-    blas::ax(gauge.Anisotropy(), in);
-  }
+  dslashPrepareSource(in, parity, gauge, inv_param);
 
   Dirac *dirac = Dirac::create(diracParam); // create the Dirac operator
   if (inv_param->dslash_type == QUDA_TWISTED_CLOVER_DSLASH && inv_param->dagger) {
@@ -2450,6 +2522,48 @@ void eigensolveQuda(void **host_evecs, double _Complex *host_evals, QudaEigParam
   profileEigensolve.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
+/**
+   @brief Compute a checksum identifying the state a multigrid
+   hierarchy is built from: the fine-grid gauge field together with
+   the operator and hierarchy parameters.  This is used to validate
+   hierarchy checkpoints.
+   @param[in] mg_param The multigrid parameters
+   @param[in] gauge The fine-grid gauge field
+   @return The checksum
+ */
+static uint64_t multigridChecksum(const QudaMultigridParam &mg_param, const cudaGaugeField &gauge)
+{
+  // hash the gauge field in place on the device
+  uint64_t checksum = gaugeHash(gauge);
+
+  auto combine = [&checksum](uint64_t value) {
+    checksum ^= value + 0x9e3779b97f4a7c15ull + (checksum << 6) + (checksum >> 2);
+  };
+  auto combine_double = [&combine](double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    combine(bits);
+  };
+
+  const QudaInvertParam &param = *mg_param.invert_param;
+  combine(param.dslash_type);
+  combine_double(param.kappa);
+  combine_double(param.mass);
+  combine_double(param.mu);
+  combine_double(param.clover_coeff);
+  combine_double(param.clover_csw);
+  combine(mg_param.n_level);
+  for (int i = 0; i < mg_param.n_level; i++) {
+    combine(mg_param.n_vec[i]);
+    combine(mg_param.transfer_type[i]);
+    combine(mg_param.precision_null[i]);
+    combine(mg_param.setup_location[i]);
+    for (int d = 0; d < QUDA_MAX_DIM; d++) combine(mg_param.geo_block_size[i][d]);
+  }
+
+  return checksum;
+}
+
 multigrid_solver::multigrid_solver(QudaMultigridParam &mg_param, TimeProfile &profile)
   : profile(profile) {
   profile.TPSTART(QUDA_PROFILE_INIT);
@@ -2529,14 +2643,48 @@ multigrid_solver::multigrid_solver(QudaMultigridParam &mg_param, TimeProfile &pr
   // fill out the MG parameters for the fine level
   mgParam = new MGParam(mg_param, B, m, mSmooth, mSmoothSloppy);
 
+  // restore the hierarchy from a checkpoint if we have a valid one for this gauge field
+  if (mg_param.hierarchy_load == QUDA_BOOLEAN_TRUE) {
+    if (MG::checkHierarchy(mg_param, multigridChecksum(mg_param, *cudaGauge))) {
+      mgParam->restore_hierarchy = true;
+    } else {
+      warningQuda("No valid multigrid hierarchy checkpoint found at %s, running setup", mg_param.hierarchy_infile);
+    }
+  }
+
   mg = new MG(*mgParam, profile);
   mgParam->updateInvertParam(*param);
 
+  // keep the gauge field we set up with as the reference for incremental refresh
+  if (mg_param.incremental_refresh == QUDA_BOOLEAN_TRUE) gaugeChange(*cudaGauge);
+
   // cache is written out even if a long benchmarking job gets interrupted
   saveTuneCache();
   profile.TPSTOP(QUDA_PROFILE_INIT);
 }
 
+double multigrid_solver::gaugeChange(const GaugeField &gauge)
+{
+  // single precision without compression suffices for measuring the change
+  GaugeFieldParam gParam(gauge);
+  gParam.create = QUDA_NULL_FIELD_CREATE;
+  gParam.location = QUDA_CUDA_FIELD_LOCATION;
+  gParam.reconstruct = QUDA_RECONSTRUCT_NO;
+  gParam.setPrecision(QUDA_SINGLE_PRECISION, true);
+  GaugeField *current = GaugeField::Create(gParam);
+  current->copy(gauge);
+
+  double change = -1.0;
+  if (gauge_ref) {
+    double ref2 = norm2(*gauge_ref);
+    change = sqrt(xmyNorm(*current, *gauge_ref) / ref2);
+    delete gauge_ref;
+  }
+  gauge_ref = current;
+
+  return change;
+}
+
 void* newMultigridQuda(QudaMultigridParam *mg_param) {
   profilerStart(__func__);
 
@@ -2647,7 +2795,15 @@ void updateMultigridQuda(void *mg_, QudaMultigridParam *mg_param)
     if (mg->mgParam->mg_global.invert_param != param) mg->mgParam->mg_global.invert_param = param;
 
     bool refresh = true;
-    mg->mg->reset(refresh);
+    double gauge_change = -1.0; // a negative change requests a full refresh
+    if (mg_param->incremental_refresh == QUDA_BOOLEAN_TRUE) {
+      gauge_change = mg->gaugeChange(*gaugePrecise);
+      if (getVerbosity() >= QUDA_SUMMARIZE) {
+        if (gauge_change >= 0.0) printfQuda("Relative gauge-field change since last update = %e\n", gauge_change);
+        else printfQuda("No reference gauge field for incremental refresh, doing full refresh\n");
+      }
+    }
+    mg->mg->reset(refresh, gauge_change);
   }
 
   setOutputPrefix("");
@@ -2671,9 +2827,14 @@ void dumpMultigridQuda(void *mg_, QudaMultigridParam *mg_param)
 
   auto *mg = static_cast<multigrid_solver*>(mg_);
   checkMultigridParam(mg_param);
-  checkGauge(mg_param->invert_param);
+  cudaGaugeField *cudaGauge = checkGauge(mg_param->invert_param);
 
-  mg->mg->dumpNullVectors();
+  if (mg_param->hierarchy_store == QUDA_BOOLEAN_TRUE) {
+    if (strcmp(mg_param->hierarchy_outfile, "") == 0) errorQuda("No hierarchy output file defined");
+    mg->mg->dumpHierarchy(multigridChecksum(*mg_param, *cudaGauge));
+  } else {
+    mg->mg->dumpNullVectors();
+  }
 
   profileInvert.TPSTOP(QUDA_PROFILE_TOTAL);
   popVerbosity();
@@ -2767,6 +2928,63 @@ void destroyDeflationQuda(void *df) {
   delete static_cast<deflated_solver*>(df);
 }
 
+/**
+   @brief Compute the chronological forecast for the solution of A x =
+   b from the resident chronology, using minimum residual
+   extrapolation in its orthonormal basis.
+   @param[out] x The forecast
+   @param[in] b The source
+   @param[in] m The operator at the outer precision
+   @param[in] mSloppy The operator at the sloppy precision
+   @param[in] hermitian Whether A is Hermitian (Galerkin projection)
+   or not (residual minimization)
+   @param[in] param The invert parameters
+*/
+static void chronoForecast(ColorSpinorField &x, ColorSpinorField &b, const DiracMatrix &m, const DiracMatrix &mSloppy,
+                           bool hermitian, const QudaInvertParam &param)
+{
+  profileInvert.TPSTART(QUDA_PROFILE_CHRONO);
+
+  auto &basis = chronoResident[param.chrono_index].basis();
+
+  ColorSpinorParam cs_param(*basis[0]);
+  ColorSpinorField *tmp = ColorSpinorField::Create(cs_param);
+  ColorSpinorField *tmp2 = (param.chrono_precision == x.Precision()) ? &x : ColorSpinorField::Create(cs_param);
+  std::vector<ColorSpinorField *> Ap;
+  for (unsigned int k = 0; k < basis.size(); k++) Ap.emplace_back((ColorSpinorField::Create(cs_param)));
+
+  // the operator has changed since the chronology was built, so it
+  // must be reapplied; this is done one vector at a time directly
+  // from the basis, since packing the basis for a multi-RHS apply
+  // would hold a second copy of the chronology and its image
+  const DiracMatrix *mChrono = nullptr;
+  if (param.chrono_precision == param.cuda_prec) {
+    mChrono = &m;
+  } else if (param.chrono_precision == param.cuda_prec_sloppy) {
+    mChrono = &mSloppy;
+  } else {
+    errorQuda("Unexpected precision %d for chrono vectors (doesn't match outer %d or sloppy precision %d)",
+              param.chrono_precision, param.cuda_prec, param.cuda_prec_sloppy);
+  }
+  for (unsigned int k = 0; k < basis.size(); k++) (*mChrono)(*Ap[k], *basis[k], *tmp, *tmp2);
+
+  // the basis is kept orthonormal, so no orthogonalization is needed
+  bool orthogonal = false;
+  bool apply_mat = false;
+  MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
+
+  blas::copy(*tmp, b);
+  mre(x, *tmp, basis, Ap);
+
+  for (auto ap : Ap) {
+    if (ap) delete (ap);
+  }
+  delete tmp;
+  if (tmp2 != &x) delete tmp2;
+
+  profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
+}
+
 void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
 {
   profilerStart(__func__);
@@ -2955,10 +3173,6 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     errorQuda("Multigrid preconditioning only supported for direct solves");
   }
 
-  if (param->chrono_use_resident && ( norm_error_solve) ){
-    errorQuda("Chronological forcasting only presently supported for M^dagger M solver");
-  }
-
   profileInvert.TPSTOP(QUDA_PROFILE_PREAMBLE);
 
   if (mat_solution && !direct_solve && !norm_error_solve) { // prepare source: b' = A^dag b
@@ -2978,92 +3192,24 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     DiracM m(dirac), mSloppy(diracSloppy), mPre(diracPre), mEig(diracEig);
     SolverParam solverParam(*param);
     // chronological forecasting
-    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0) {
-      profileInvert.TPSTART(QUDA_PROFILE_CHRONO);
-
-      auto &basis = chronoResident[param->chrono_index];
-
-      ColorSpinorParam cs_param(*basis[0]);
-      ColorSpinorField *tmp = ColorSpinorField::Create(cs_param);
-      ColorSpinorField *tmp2 = (param->chrono_precision == out->Precision()) ? out : ColorSpinorField::Create(cs_param);
-      std::vector<ColorSpinorField*> Ap;
-      for (unsigned int k=0; k < basis.size(); k++) {
-        Ap.emplace_back((ColorSpinorField::Create(cs_param)));
-      }
-
-      if (param->chrono_precision == param->cuda_prec) {
-        for (unsigned int j=0; j<basis.size(); j++) m(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else if (param->chrono_precision == param->cuda_prec_sloppy) {
-        for (unsigned int j=0; j<basis.size(); j++) mSloppy(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else {
-        errorQuda("Unexpected precision %d for chrono vectors (doesn't match outer %d or sloppy precision %d)",
-                  param->chrono_precision, param->cuda_prec, param->cuda_prec_sloppy);
-      }
-
-      bool orthogonal = true;
-      bool apply_mat = false;
-      bool hermitian = false;
-      MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
-
-      blas::copy(*tmp, *in);
-      mre(*out, *tmp, basis, Ap);
-
-      for (auto ap: Ap) {
-        if (ap) delete (ap);
-      }
-      delete tmp;
-      if (tmp2 != out) delete tmp2;
-
-      profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
-    }
+    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0)
+      chronoForecast(*out, *in, m, mSloppy, false, *param);
 
     Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig, profileInvert);
     (*solve)(*out, *in);
     delete solve;
     solverParam.updateInvertParam(*param);
+
+    // retune any K-cycle levels from the work done in this solve
+    if (param->inv_type_precondition == QUDA_MG_INVERTER)
+      static_cast<multigrid_solver *>(param->preconditioner)->mg->adaptCycle();
   } else if (!norm_error_solve) {
     DiracMdagM m(dirac), mSloppy(diracSloppy), mPre(diracPre), mEig(diracEig);
     SolverParam solverParam(*param);
 
     // chronological forecasting
-    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0) {
-      profileInvert.TPSTART(QUDA_PROFILE_CHRONO);
-
-      auto &basis = chronoResident[param->chrono_index];
-
-      ColorSpinorParam cs_param(*basis[0]);
-      std::vector<ColorSpinorField*> Ap;
-      ColorSpinorField *tmp = ColorSpinorField::Create(cs_param);
-      ColorSpinorField *tmp2 = (param->chrono_precision == out->Precision()) ? out : ColorSpinorField::Create(cs_param);
-      for (unsigned int k=0; k < basis.size(); k++) {
-        Ap.emplace_back((ColorSpinorField::Create(cs_param)));
-      }
-
-      if (param->chrono_precision == param->cuda_prec) {
-        for (unsigned int j=0; j<basis.size(); j++) m(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else if (param->chrono_precision == param->cuda_prec_sloppy) {
-        for (unsigned int j=0; j<basis.size(); j++) mSloppy(*Ap[j], *basis[j], *tmp, *tmp2);
-      } else {
-        errorQuda("Unexpected precision %d for chrono vectors (doesn't match outer %d or sloppy precision %d)",
-                  param->chrono_precision, param->cuda_prec, param->cuda_prec_sloppy);
-      }
-
-      bool orthogonal = true;
-      bool apply_mat = false;
-      bool hermitian = true;
-      MinResExt mre(m, orthogonal, apply_mat, hermitian, profileInvert);
-
-      blas::copy(*tmp, *in);
-      mre(*out, *tmp, basis, Ap);
-
-      for (auto ap: Ap) {
-        if (ap) delete(ap);
-      }
-      delete tmp;
-      if (tmp2 != out) delete tmp2;
-
-      profileInvert.TPSTOP(QUDA_PROFILE_CHRONO);
-    }
+    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0)
+      chronoForecast(*out, *in, m, mSloppy, true, *param);
 
     // if using a Schwarz preconditioner with a normal operator then we must use the DiracMdagMLocal operator
     if (param->inv_type_precondition != QUDA_INVALID_INVERTER && param->schwarz_type != QUDA_INVALID_SCHWARZ) {
@@ -3082,11 +3228,47 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
     DiracMMdag m(dirac), mSloppy(diracSloppy), mPre(diracPre), mEig(diracEig);
     cudaColorSpinorField tmp(*out);
     SolverParam solverParam(*param);
-    Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig, profileInvert);
-    (*solve)(tmp, *in); // y = (M M^\dag) b
-    dirac.Mdag(*out, tmp);  // x = M^dag y
-    delete solve;
-    solverParam.updateInvertParam(*param);
+
+    if (param->chrono_use_resident && chronoResident[param->chrono_index].size() > 0) {
+      // forecast x from the chronology of solutions of M x = b, then
+      // solve for the correction: (M M^dag) y = b - M x, x += M^dag y
+      DiracM mM(dirac), mMSloppy(diracSloppy);
+      chronoForecast(*out, *in, mM, mMSloppy, false, *param);
+
+      cudaColorSpinorField r(*in);
+      dirac.M(r, *out);
+      blas::xpay(*in, -1.0, r);
+
+      double r2 = blas::norm2(r);
+      if (r2 == 0.0) {
+        // the forecast is exact, so there is no correction to solve for
+        solverParam.true_res = 0.0;
+        solverParam.true_res_hq = 0.0;
+        solverParam.iter = 0;
+        solverParam.secs = 0.0;
+        solverParam.gflops = 0.0;
+      } else {
+        // the tolerance is relative to the original source
+        double b2 = blas::norm2(*in);
+        double scale = (param->residual_type & QUDA_L2_RELATIVE_RESIDUAL) ? sqrt(b2 / r2) : 1.0;
+        solverParam.tol *= scale;
+        solverParam.use_init_guess = QUDA_USE_INIT_GUESS_NO;
+
+        Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig, profileInvert);
+        (*solve)(tmp, r);
+        dirac.Mdag(r, tmp);
+        blas::xpy(r, *out);
+        delete solve;
+        solverParam.true_res /= scale;
+      }
+      solverParam.updateInvertParam(*param);
+    } else {
+      Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig, profileInvert);
+      (*solve)(tmp, *in); // y = (M M^\dag) b
+      dirac.Mdag(*out, tmp);  // x = M^dag y
+      delete solve;
+      solverParam.updateInvertParam(*param);
+    }
   }
 
   if (getVerbosity() >= QUDA_VERBOSE){
@@ -3106,24 +3288,13 @@ void invertQuda(void *hp_x, void *hp_b, QudaInvertParam *param)
 
     auto &basis = chronoResident[i];
 
-    if(param->chrono_max_dim < (int)basis.size()){
-      errorQuda("Requested chrono_max_dim %i is smaller than already existing chroology %i",param->chrono_max_dim,(int)basis.size());
+    if(param->chrono_max_dim < basis.size()){
+      errorQuda("Requested chrono_max_dim %i is smaller than already existing chroology %i",param->chrono_max_dim,basis.size());
     }
 
-    if(not param->chrono_replace_last){
-      // if we have not filled the space yet just augment
-      if ((int)basis.size() < param->chrono_max_dim) {
-        ColorSpinorParam cs_param(*out);
-        cs_param.setPrecision(param->chrono_precision);
-        basis.emplace_back(ColorSpinorField::Create(cs_param));
-      }
-
-      // shuffle every entry down one and bring the last to the front
-      ColorSpinorField *tmp = basis[basis.size()-1];
-      for (unsigned int j=basis.size()-1; j>0; j--) basis[j] = basis[j-1];
-        basis[0] = tmp;
-    }
-    *(basis[0]) = *out; // set first entry to new solution
+    // replacing the last entry evicts the newest solution before appending
+    if (param->chrono_replace_last && basis.size() > 0) basis.evict(basis.size() - 1);
+    basis.push(*out, param->chrono_max_dim, param->chrono_precision);
   }
   dirac.reconstruct(*x, *b, param->solution_type);
 
@@ -3529,8 +3700,183 @@ void callMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, // col
   profilerStop(__func__);
 }
 
+/**
+   @brief Whether a multi-source solve should be done with a block
+   solver on the full grid, rather than source by source or with a
+   split grid.
+*/
+static bool useBlockSolver(const QudaInvertParam *param)
+{
+  CommKey split_key = {param->split_grid[0], param->split_grid[1], param->split_grid[2], param->split_grid[3]};
+  return quda::product(split_key) == 1 && param->num_src > 1 && param->inv_type == QUDA_BLOCK_CG_INVERTER;
+}
+
+/**
+   @brief Solve for num_src sources at once with a block solver.  This
+   follows invertQuda, except that chronological forecasting,
+   resident solutions and two-pass solves are not supported.
+*/
+static void invertBlockQuda(void **hp_x, void **hp_b, QudaInvertParam *param)
+{
+  profilerStart(__func__);
+
+  profileInvert.TPSTART(QUDA_PROFILE_TOTAL);
+
+  if (!initialized) errorQuda("QUDA not initialized");
+
+  pushVerbosity(param->verbosity);
+  if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printQudaInvertParam(param);
+
+  checkInvertParam(param, hp_x[0], hp_b[0]);
+
+  // check the gauge fields have been created
+  cudaGaugeField *cudaGauge = checkGauge(param);
+
+  bool pc_solution = (param->solution_type == QUDA_MATPC_SOLUTION) ||
+    (param->solution_type == QUDA_MATPCDAG_MATPC_SOLUTION);
+  bool pc_solve = (param->solve_type == QUDA_DIRECT_PC_SOLVE) ||
+    (param->solve_type == QUDA_NORMOP_PC_SOLVE) || (param->solve_type == QUDA_NORMERR_PC_SOLVE);
+  bool mat_solution = (param->solution_type == QUDA_MAT_SOLUTION) ||
+    (param->solution_type ==  QUDA_MATPC_SOLUTION);
+  bool direct_solve = (param->solve_type == QUDA_DIRECT_SOLVE) ||
+    (param->solve_type == QUDA_DIRECT_PC_SOLVE);
+  bool norm_error_solve = (param->solve_type == QUDA_NORMERR_SOLVE) ||
+    (param->solve_type == QUDA_NORMERR_PC_SOLVE);
+
+  if (pc_solution && !pc_solve) errorQuda("Preconditioned (PC) solution_type requires a PC solve_type");
+  if (!mat_solution && !pc_solution && pc_solve)
+    errorQuda("Unpreconditioned MATDAG_MAT solution_type requires an unpreconditioned solve_type");
+  if (!mat_solution && direct_solve) errorQuda("Two-pass solves not supported by block solvers");
+  if (norm_error_solve) errorQuda("Normal-error solves not supported by block solvers");
+  if (param->chrono_use_resident || param->chrono_make_resident)
+    errorQuda("Chronological forecasting not supported by block solvers");
+  if (param->use_resident_solution || param->make_resident_solution)
+    errorQuda("Resident solutions not supported by block solvers");
+
+  param->secs = 0;
+  param->gflops = 0;
+  param->iter = 0;
+
+  Dirac *d = nullptr;
+  Dirac *dSloppy = nullptr;
+  Dirac *dPre = nullptr;
+  Dirac *dEig = nullptr;
+  createDiracWithEig(d, dSloppy, dPre, dEig, *param, pc_solve);
+
+  profileInvert.TPSTART(QUDA_PROFILE_H2D);
+
+  const int n_src = param->num_src;
+  const int *X = cudaGauge->X();
+  std::vector<ColorSpinorField *> h_b(n_src), h_x(n_src), b(n_src), x(n_src), in(n_src), out(n_src);
+  std::vector<double> nb(n_src);
+
+  ColorSpinorParam cpuParam(hp_b[0], *param, X, pc_solution, param->input_location);
+  for (int i = 0; i < n_src; i++) {
+    cpuParam.v = hp_b[i];
+    cpuParam.location = param->input_location;
+    h_b[i] = ColorSpinorField::Create(cpuParam);
+    cpuParam.v = hp_x[i];
+    cpuParam.location = param->output_location;
+    h_x[i] = ColorSpinorField::Create(cpuParam);
+  }
+
+  ColorSpinorParam cudaParam(cpuParam, *param);
+  for (int i = 0; i < n_src; i++) {
+    cudaParam.create = QUDA_COPY_FIELD_CREATE;
+    b[i] = new cudaColorSpinorField(*h_b[i], cudaParam);
+    cudaParam.create = QUDA_NULL_FIELD_CREATE;
+    x[i] = new cudaColorSpinorField(cudaParam);
+    if (param->use_init_guess == QUDA_USE_INIT_GUESS_YES) {
+      *x[i] = *h_x[i];
+    } else {
+      blas::zero(*x[i]);
+    }
+  }
+
+  profileInvert.TPSTOP(QUDA_PROFILE_H2D);
+  profileInvert.TPSTART(QUDA_PROFILE_PREAMBLE);
+
+  for (int i = 0; i < n_src; i++) {
+    nb[i] = blas::norm2(*b[i]);
+    if (nb[i] == 0.0) errorQuda("Source %d has zero norm", i);
+
+    // rescale the source and solution vectors to help prevent the onset of underflow
+    if (param->solver_normalization == QUDA_SOURCE_NORMALIZATION) {
+      blas::ax(1.0 / sqrt(nb[i]), *b[i]);
+      blas::ax(1.0 / sqrt(nb[i]), *x[i]);
+    }
+
+    massRescale(*static_cast<cudaColorSpinorField *>(b[i]), *param, false);
+
+    d->prepare(in[i], out[i], *x[i], *b[i], param->solution_type);
+
+    if (mat_solution && !direct_solve) { // prepare source: b' = A^dag b
+      cudaColorSpinorField tmp(*in[i]);
+      d->Mdag(*in[i], tmp);
+    }
+  }
+
+  profileInvert.TPSTOP(QUDA_PROFILE_PREAMBLE);
+
+  SolverParam solverParam(*param);
+  if (direct_solve) {
+    DiracM m(*d), mSloppy(*dSloppy), mPre(*dPre), mEig(*dEig);
+    Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig, profileInvert);
+    solve->blocksolve(out, in);
+    delete solve;
+  } else {
+    DiracMdagM m(*d), mSloppy(*dSloppy), mPre(*dPre), mEig(*dEig);
+    Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig, profileInvert);
+    solve->blocksolve(out, in);
+    delete solve;
+  }
+  solverParam.updateInvertParam(*param);
+  for (int i = 0; i < n_src; i++) {
+    param->true_res_offset[i] = solverParam.true_res_offset[i];
+    param->true_res_hq_offset[i] = solverParam.true_res_hq_offset[i];
+  }
+
+  profileInvert.TPSTART(QUDA_PROFILE_EPILOGUE);
+  for (int i = 0; i < n_src; i++) {
+    d->reconstruct(*x[i], *b[i], param->solution_type);
+    if (param->solver_normalization == QUDA_SOURCE_NORMALIZATION) blas::ax(sqrt(nb[i]), *x[i]);
+  }
+  profileInvert.TPSTOP(QUDA_PROFILE_EPILOGUE);
+
+  profileInvert.TPSTART(QUDA_PROFILE_D2H);
+  for (int i = 0; i < n_src; i++) *h_x[i] = *x[i];
+  profileInvert.TPSTOP(QUDA_PROFILE_D2H);
+
+  profileInvert.TPSTART(QUDA_PROFILE_FREE);
+  for (int i = 0; i < n_src; i++) {
+    delete h_b[i];
+    delete h_x[i];
+    delete b[i];
+    delete x[i];
+  }
+
+  delete d;
+  delete dSloppy;
+  delete dPre;
+  delete dEig;
+  profileInvert.TPSTOP(QUDA_PROFILE_FREE);
+
+  popVerbosity();
+
+  // cache is written out even if a long benchmarking job gets interrupted
+  saveTuneCache();
+
+  profileInvert.TPSTOP(QUDA_PROFILE_TOTAL);
+
+  profilerStop(__func__);
+}
+
 void invertMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, void *h_gauge, QudaGaugeParam *gauge_param)
 {
+  if (useBlockSolver(param)) {
+    invertBlockQuda(_hp_x, _hp_b, param);
+    return;
+  }
   auto op = [](void *_x, void *_b, QudaInvertParam *param) { invertQuda(_x, _b, param); };
   callMultiSrcQuda(_hp_x, _hp_b, param, h_gauge, nullptr, nullptr, gauge_param, nullptr, nullptr, op);
 }
@@ -3538,6 +3884,10 @@ void invertMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, void
 void invertMultiSrcStaggeredQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, void *milc_fatlinks,
                                  void *milc_longlinks, QudaGaugeParam *gauge_param)
 {
+  if (useBlockSolver(param)) {
+    invertBlockQuda(_hp_x, _hp_b, param);
+    return;
+  }
   auto op = [](void *_x, void *_b, QudaInvertParam *param) { invertQuda(_x, _b, param); };
   callMultiSrcQuda(_hp_x, _hp_b, param, nullptr, milc_fatlinks, milc_longlinks, gauge_param, nullptr, nullptr, op);
 }
@@ -3545,13 +3895,116 @@ void invertMultiSrcStaggeredQuda(void **_hp_x, void **_hp_b, QudaInvertParam *pa
 void invertMultiSrcCloverQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, void *h_gauge,
                               QudaGaugeParam *gauge_param, void *h_clover, void *h_clovinv)
 {
+  if (useBlockSolver(param)) {
+    invertBlockQuda(_hp_x, _hp_b, param);
+    return;
+  }
   auto op = [](void *_x, void *_b, QudaInvertParam *param) { invertQuda(_x, _b, param); };
   callMultiSrcQuda(_hp_x, _hp_b, param, h_gauge, nullptr, nullptr, gauge_param, h_clover, h_clovinv, op);
 }
 
+/**
+   @brief Whether a multi-source dslash can be applied locally as a
+   single multi-RHS dslash, with the sources packed into the fifth
+   dimension, rather than one source at a time.
+*/
+static bool useMultiRHSDslash(const QudaInvertParam *param)
+{
+  CommKey split_key = {param->split_grid[0], param->split_grid[1], param->split_grid[2], param->split_grid[3]};
+  if (quda::product(split_key) != 1 || param->num_src <= 1) return false;
+
+  switch (param->dslash_type) {
+  case QUDA_WILSON_DSLASH:
+  case QUDA_CLOVER_WILSON_DSLASH: return true;
+  case QUDA_TWISTED_MASS_DSLASH: return param->twist_flavor == QUDA_TWIST_SINGLET;
+  case QUDA_STAGGERED_DSLASH:
+  case QUDA_ASQTAD_DSLASH: return param->Ls == 1;
+  default: return false;
+  }
+}
+
+/**
+   @brief Apply the dslash to num_src sources at once: the sources
+   are packed into the fifth dimension of a multi-RHS field, such
+   that the links (and clover term) are loaded once per site for all
+   sources.  The normalization conventions are those of dslashQuda.
+*/
+static void dslashMultiRHSQuda(void **h_out, void **h_in, QudaInvertParam *inv_param, QudaParity parity)
+{
+  profileDslash.TPSTART(QUDA_PROFILE_TOTAL);
+  profileDslash.TPSTART(QUDA_PROFILE_INIT);
+
+  const auto &gauge = dslashSetup(inv_param);
+
+  const int n_src = inv_param->num_src;
+  std::vector<ColorSpinorField *> in_h(n_src), out_h(n_src);
+  ColorSpinorParam cpuParam(h_in[0], *inv_param, gauge.X(), true, inv_param->input_location);
+  for (int i = 0; i < n_src; i++) {
+    cpuParam.v = h_in[i];
+    cpuParam.location = inv_param->input_location;
+    in_h[i] = ColorSpinorField::Create(cpuParam);
+    cpuParam.v = h_out[i];
+    cpuParam.location = inv_param->output_location;
+    out_h[i] = ColorSpinorField::Create(cpuParam);
+  }
+
+  ColorSpinorParam cudaParam(cpuParam, *inv_param);
+  cudaParam.create = QUDA_NULL_FIELD_CREATE;
+  cudaColorSpinorField tmp(cudaParam);
+
+  ColorSpinorParam mrhsParam(cudaParam);
+  mrhsParam.nDim = 5;
+  mrhsParam.x[4] = n_src;
+  mrhsParam.pc_type = QUDA_4D_PC;
+  cudaColorSpinorField in(mrhsParam);
+  cudaColorSpinorField out(mrhsParam);
+
+  bool pc = true;
+  DiracParam diracParam;
+  setDiracParam(diracParam, inv_param, pc);
+
+  profileDslash.TPSTOP(QUDA_PROFILE_INIT);
+
+  profileDslash.TPSTART(QUDA_PROFILE_H2D);
+  for (int i = 0; i < n_src; i++) {
+    tmp = *in_h[i];
+    copySlice(in, tmp, i);
+  }
+  profileDslash.TPSTOP(QUDA_PROFILE_H2D);
+
+  profileDslash.TPSTART(QUDA_PROFILE_COMPUTE);
+
+  dslashPrepareSource(in, parity, gauge, inv_param);
+
+  Dirac *dirac = Dirac::create(diracParam); // create the Dirac operator
+  dirac->Dslash(out, in, parity);           // apply the operator to all sources at once
+  profileDslash.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+  profileDslash.TPSTART(QUDA_PROFILE_D2H);
+  for (int i = 0; i < n_src; i++) {
+    copySlice(tmp, out, i);
+    *out_h[i] = tmp;
+  }
+  profileDslash.TPSTOP(QUDA_PROFILE_D2H);
+
+  profileDslash.TPSTART(QUDA_PROFILE_FREE);
+  delete dirac; // clean up
+
+  for (auto p : out_h) delete p;
+  for (auto p : in_h) delete p;
+  profileDslash.TPSTOP(QUDA_PROFILE_FREE);
+
+  popVerbosity();
+  profileDslash.TPSTOP(QUDA_PROFILE_TOTAL);
+}
+
 void dslashMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, QudaParity parity, void *h_gauge,
                         QudaGaugeParam *gauge_param)
 {
+  if (useMultiRHSDslash(param)) {
+    dslashMultiRHSQuda(_hp_x, _hp_b, param, parity);
+    return;
+  }
   auto op = [](void *_x, void *_b, QudaInvertParam *param, QudaParity parity) { dslashQuda(_x, _b, param, parity); };
   callMultiSrcQuda(_hp_x, _hp_b, param, h_gauge, nullptr, nullptr, gauge_param, nullptr, nullptr, op, parity);
 }
@@ -3559,6 +4012,10 @@ void dslashMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, Quda
 void dslashMultiSrcStaggeredQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, QudaParity parity,
                                  void *milc_fatlinks, void *milc_longlinks, QudaGaugeParam *gauge_param)
 {
+  if (useMultiRHSDslash(param)) {
+    dslashMultiRHSQuda(_hp_x, _hp_b, param, parity);
+    return;
+  }
   auto op = [](void *_x, void *_b, QudaInvertParam *param, QudaParity parity) { dslashQuda(_x, _b, param, parity); };
   callMultiSrcQuda(_hp_x, _hp_b, param, nullptr, milc_fatlinks, milc_longlinks, gauge_param, nullptr, nullptr, op,
                    parity);
@@ -3567,6 +4024,10 @@ void dslashMultiSrcStaggeredQuda(void **_hp_x, void **_hp_b, QudaInvertParam *pa
 void dslashMultiSrcCloverQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, QudaParity parity, void *h_gauge,
                               QudaGaugeParam *gauge_param, void *h_clover, void *h_clovinv)
 {
+  if (useMultiRHSDslash(param)) {
+    dslashMultiRHSQuda(_hp_x, _hp_b, param, parity);
+    return;
+  }
   auto op = [](void *_x, void *_b, QudaInvertParam *param, QudaParity parity) { dslashQuda(_x, _b, param, parity); };
   callMultiSrcQuda(_hp_x, _hp_b, param, h_gauge, nullptr, nullptr, gauge_param, h_clover, h_clovinv, op, parity);
 }
@@ -3788,7 +4249,7 @@ void invertMultiShiftQuda(void **_hp_x, void *_hp_b, QudaInvertParam *param)
   delete mSloppy;
 
   if (param->compute_true_res) {
-    // check each shift has the desired tolerance and use sequential CG to refine
+    // check each shift has the desired tolerance and refine those that do not
     profileMulti.TPSTART(QUDA_PROFILE_INIT);
     cudaParam.create = QUDA_ZERO_FIELD_CREATE;
     cudaColorSpinorField r(*b, cudaParam);
@@ -3798,6 +4259,14 @@ void invertMultiShiftQuda(void **_hp_x, void *_hp_b, QudaInvertParam *param)
     Dirac &dirac = *d;
     Dirac &diracSloppy = *dRefine;
 
+    // Without a heavy-quark residual criterion all shifts that need it
+    // are refined concurrently, sharing the operator application
+    bool refine_concurrent = !(param->residual_type & QUDA_HEAVY_QUARK_RESIDUAL);
+    std::vector<int> refine_shifts;
+    SolverParam refineSolverParam(refineparam);
+    refineSolverParam.iter = 0;
+    refineSolverParam.delta = param->reliable_delta_refinement;
+
 #define REFINE_INCREASING_MASS
 #ifdef REFINE_INCREASING_MASS
     for(int i=0; i < param->num_offset; i++) {
@@ -3825,6 +4294,12 @@ void invertMultiShiftQuda(void **_hp_x, void *_hp_b, QudaInvertParam *param)
 	  printfQuda("Refining shift %d: L2 residual %e / %e, heavy quark %e / %e (actual / requested)\n",
 		     i, param->true_res_offset[i], param->tol_offset[i], rsd_hq, tol_hq);
 
+        if (refine_concurrent) {
+          refine_shifts.push_back(i);
+          refineSolverParam.tol_offset[i] = (param->tol_offset[i] > 0.0 ? param->tol_offset[i] : iter_tol);
+          continue;
+        }
+
         // for staggered the shift is just a change in mass term (FIXME: for twisted mass also)
         if (param->dslash_type == QUDA_ASQTAD_DSLASH ||
             param->dslash_type == QUDA_STAGGERED_DSLASH) {
@@ -3918,6 +4393,38 @@ void invertMultiShiftQuda(void **_hp_x, void *_hp_b, QudaInvertParam *param)
         delete mSloppy;
       }
     }
+
+    if (refine_shifts.size() > 0) {
+      // the size of the pool of sloppy temporaries, i.e., the number of shifts refined at once
+      int pool_size = 8;
+      char *pool_env = getenv("QUDA_MULTISHIFT_REFINE_POOL");
+      if (pool_env) pool_size = std::max(1, atoi(pool_env));
+
+      for (int i = 0; i < param->num_offset; i++) {
+        refineSolverParam.true_res_offset[i] = param->true_res_offset[i];
+        refineSolverParam.iter_res_offset[i] = param->iter_res_offset[i];
+        refineSolverParam.true_res_hq_offset[i] = param->true_res_hq_offset[i];
+      }
+
+      // the lowest shift is folded into the staggered mass, the others are added by the solver
+      DiracMatrix *m, *mSloppy;
+      if (param->dslash_type == QUDA_ASQTAD_DSLASH || param->dslash_type == QUDA_STAGGERED_DSLASH) {
+        m = new DiracM(dirac);
+        mSloppy = new DiracM(diracSloppy);
+      } else {
+        m = new DiracMdagM(dirac);
+        mSloppy = new DiracMdagM(diracSloppy);
+      }
+
+      {
+        MultiShiftCGRefine refine(*m, *mSloppy, refineSolverParam, profileMulti, pool_size);
+        refine(x, *b, refine_shifts, p, r2_old.get());
+      }
+      refineSolverParam.updateInvertParam(*param);
+
+      delete m;
+      delete mSloppy;
+    }
   }
 
   // restore shifts
@@ -4086,6 +4593,107 @@ void computeKSLinkQuda(void *fatlink, void *longlink, void *ulink, void *inlink,
   profileFatLink.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
+/**
+   @brief Check whether the cached site-struct gauge field has the
+   same layout and metadata as a given device field, such that the
+   latter can be filled by copying from the former.
+   @param[in] gauge The device field we are comparing against
+   @return Whether the cache is compatible with gauge
+*/
+static bool siteGaugeCacheCompatible(const cudaGaugeField &gauge)
+{
+  return siteGaugeCache && siteGaugeCache->Volume() == gauge.Volume()
+    && siteGaugeCache->Precision() == gauge.Precision() && siteGaugeCache->Reconstruct() == gauge.Reconstruct()
+    && siteGaugeCache->LinkType() == gauge.LinkType() && siteGaugeCache->TBoundary() == gauge.TBoundary()
+    && siteGaugeCache->StaggeredPhaseApplied() == gauge.StaggeredPhaseApplied()
+    && siteGaugeCache->GhostExchange() == gauge.GhostExchange() && siteGaugeCache->Nface() == gauge.Nface()
+    && siteGaugeCache->GaugeFixed() == gauge.GaugeFixed() && siteGaugeCache->Anisotropy() == gauge.Anisotropy()
+    && siteGaugeCache->Tadpole() == gauge.Tadpole();
+}
+
+/**
+   @brief Compute a positional hash of the links held in a host field
+   that wraps a MILC site struct.  Only the link matrices of each site
+   contribute, not the other members of the site struct.
+   @param[in] cpu The host field
+   @return The hash
+*/
+static uint64_t hashSiteGauge(const cpuGaugeField &cpu)
+{
+  const size_t link_bytes = cpu.Geometry() * 2 * cpu.Ncolor() * cpu.Ncolor() * cpu.Precision();
+  return hashHostArray(static_cast<const char *>(cpu.Gauge_p()) + cpu.SiteOffset(), link_bytes, cpu.Volume(),
+                       cpu.SiteSize());
+}
+
+/**
+   @brief Record a device gauge field as the cached copy of the host
+   site-struct field with the given hash.
+   @param[in] gauge The device field
+   @param[in] hash Hash of the host field it corresponds to
+*/
+static void cacheSiteGauge(const cudaGaugeField &gauge, uint64_t hash)
+{
+  if (siteGaugeCache && !siteGaugeCacheCompatible(gauge)) {
+    delete siteGaugeCache;
+    siteGaugeCache = nullptr;
+  }
+
+  if (!siteGaugeCache) {
+    GaugeFieldParam param(gauge);
+    param.create = QUDA_NULL_FIELD_CREATE;
+    siteGaugeCache = new cudaGaugeField(param);
+  }
+  siteGaugeCache->copy(gauge);
+  siteGaugeCacheKey.set(hash);
+}
+
+/**
+   @brief Load a host gauge field into a device field.  Host fields
+   that wrap a MILC site struct are typically passed repeatedly with
+   the same links during an HMC trajectory, so for these we keep a
+   device copy of the last field seen, keyed on a hash of its links,
+   and reuse it rather than reorder and transfer the host field again.
+   @param[out] gauge The device field we are loading
+   @param[in] cpu The host field we are loading from
+   @param[in] cache Whether to use the cache (if not, it is freed)
+*/
+static void loadSiteGauge(cudaGaugeField &gauge, const cpuGaugeField &cpu, bool cache)
+{
+  if (cpu.Order() != QUDA_MILC_SITE_GAUGE_ORDER || !cache) {
+    if (!cache) freeSiteGaugeCache();
+    gauge.loadCPUField(cpu);
+    return;
+  }
+
+  // all processes must agree since loading exchanges ghosts
+  uint64_t hash = hashSiteGauge(cpu);
+  if (siteGaugeCacheKey.hit(hash, siteGaugeCacheCompatible(gauge))) {
+    if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printfQuda("Reusing cached device copy of site-struct gauge field\n");
+    gauge.copy(*siteGaugeCache);
+  } else {
+    gauge.loadCPUField(cpu);
+    cacheSiteGauge(gauge, hash);
+  }
+}
+
+/**
+   @brief Save a device gauge field to a host field.  If the host
+   field wraps a MILC site struct, the device field becomes the cached
+   copy of the updated host links, so that passing them back in does
+   not trigger a reload.
+   @param[in] gauge The device field we are saving
+   @param[out] cpu The host field we are saving to
+   @param[in] cache Whether to use the cache (if not, it is freed)
+*/
+static void saveSiteGauge(const cudaGaugeField &gauge, cpuGaugeField &cpu, bool cache)
+{
+  gauge.saveCPUField(cpu);
+  if (!cache)
+    freeSiteGaugeCache();
+  else if (cpu.Order() == QUDA_MILC_SITE_GAUGE_ORDER)
+    cacheSiteGauge(gauge, hashSiteGauge(cpu));
+}
+
 int computeGaugeForceQuda(void* mom, void* siteLink,  int*** input_path_buf, int* path_length,
 			  double* loop_coeff, int num_paths, int max_length, double eb3, QudaGaugeParam* qudaGaugeParam)
 {
@@ -4113,7 +4721,7 @@ int computeGaugeForceQuda(void* mom, void* siteLink,  int*** input_path_buf, int
     profileGaugeForce.TPSTOP(QUDA_PROFILE_INIT);
 
     profileGaugeForce.TPSTART(QUDA_PROFILE_H2D);
-    cudaSiteLink->loadCPUField(*cpuSiteLink);
+    loadSiteGauge(*cudaSiteLink, *cpuSiteLink, qudaGaugeParam->cache_site_gauge);
     profileGaugeForce.TPSTOP(QUDA_PROFILE_H2D);
 
     profileGaugeForce.TPSTART(QUDA_PROFILE_INIT);
@@ -4971,7 +5579,7 @@ void updateGaugeFieldQuda(void* gauge,
   profileGaugeUpdate.TPSTART(QUDA_PROFILE_H2D);
 
   if (!param->use_resident_gauge) {   // load fields onto the device
-    cudaInGauge->loadCPUField(*cpuGauge);
+    loadSiteGauge(*cudaInGauge, *cpuGauge, param->cache_site_gauge);
   } else { // or use resident fields already present
     if (!gaugePrecise) errorQuda("No resident gauge field allocated");
     cudaInGauge = gaugePrecise;
@@ -4997,7 +5605,7 @@ void updateGaugeFieldQuda(void* gauge,
   if (param->return_result_gauge) {
     // copy the gauge field back to the host
     profileGaugeUpdate.TPSTART(QUDA_PROFILE_D2H);
-    cudaOutGauge->saveCPUField(*cpuGauge);
+    saveSiteGauge(*cudaOutGauge, *cpuGauge, param->cache_site_gauge);
     profileGaugeUpdate.TPSTOP(QUDA_PROFILE_D2H);
   }
 
@@ -5050,7 +5658,7 @@ void updateGaugeFieldQuda(void* gauge,
      gaugePrecise = nullptr;
    } else {
      profileProject.TPSTART(QUDA_PROFILE_H2D);
-     cudaGauge->loadCPUField(*cpuGauge);
+     loadSiteGauge(*cudaGauge, *cpuGauge, param->cache_site_gauge);
      profileProject.TPSTOP(QUDA_PROFILE_H2D);
    }
 
@@ -5068,7 +5676,7 @@ void updateGaugeFieldQuda(void* gauge,
      errorQuda("Error in the SU(3) unitarization: %d failures\n", *num_failures_h);
 
    profileProject.TPSTART(QUDA_PROFILE_D2H);
-   if (param->return_result_gauge) cudaGauge->saveCPUField(*cpuGauge);
+   if (param->return_result_gauge) saveSiteGauge(*cudaGauge, *cpuGauge, param->cache_site_gauge);
    profileProject.TPSTOP(QUDA_PROFILE_D2H);
 
    if (param->make_resident_gauge) {
@@ -0,0 +1,360 @@
+#include <algorithm>
+#include <invert_quda.h>
+#include <blas_quda.h>
+#include <eigen_helper.h>
+
+/**
+   @file inv_block_cg_quda.cpp
+
+   Breakdown-free block CG, following Ji and Li, "A breakdown-free
+   block conjugate gradient method", BIT Numer. Math. 57 (2017).
+
+   At each iteration the search block P is an orthonormal basis for
+   the span of the conjugated residual block Z + P beta, found from
+   the eigen-decomposition of its Gram matrix.  Directions whose
+   singular values are negligible are dropped, so the block shrinks
+   gracefully when the residuals become linearly dependent, instead
+   of the small matrices P^dag A P becoming singular as in the
+   original block CG of O'Leary.  Right-hand sides that have
+   converged are retired from the block altogether.
+*/
+
+namespace quda
+{
+
+  BlockCG::BlockCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
+                   const DiracMatrix &matEig, SolverParam &param, TimeProfile &profile) :
+    Solver(mat, matSloppy, matPrecon, matEig, param, profile),
+    tmpp(nullptr),
+    tmp2p(nullptr),
+    tmp_sloppy(nullptr),
+    tmp2_sloppy(nullptr),
+    n_src(0)
+  {
+  }
+
+  BlockCG::~BlockCG()
+  {
+    profile.TPSTART(QUDA_PROFILE_FREE);
+    destroy();
+    profile.TPSTOP(QUDA_PROFILE_FREE);
+  }
+
+  void BlockCG::create(const ColorSpinorField &x, int n)
+  {
+    if (n == n_src) return;
+    destroy();
+
+    const bool mixed = param.precision != param.precision_sloppy;
+
+    ColorSpinorParam csParam(x);
+    csParam.create = QUDA_NULL_FIELD_CREATE;
+    csParam.setPrecision(param.precision);
+    for (int i = 0; i < n; i++) r.push_back(ColorSpinorField::Create(csParam));
+    tmpp = ColorSpinorField::Create(csParam);
+    tmp2p = ColorSpinorField::Create(csParam);
+
+    csParam.setPrecision(param.precision_sloppy);
+    for (int i = 0; i < n; i++) {
+      r_sloppy.push_back(mixed ? ColorSpinorField::Create(csParam) : r[i]);
+      x_sloppy.push_back(ColorSpinorField::Create(csParam));
+      p.push_back(ColorSpinorField::Create(csParam));
+      q.push_back(ColorSpinorField::Create(csParam));
+      w.push_back(ColorSpinorField::Create(csParam));
+    }
+    tmp_sloppy = mixed ? ColorSpinorField::Create(csParam) : tmpp;
+    tmp2_sloppy = mixed ? ColorSpinorField::Create(csParam) : tmp2p;
+
+    n_src = n;
+  }
+
+  void BlockCG::destroy()
+  {
+    if (n_src == 0) return;
+    const bool mixed = param.precision != param.precision_sloppy;
+
+    for (auto v : w) delete v;
+    for (auto v : q) delete v;
+    for (auto v : p) delete v;
+    for (auto v : x_sloppy) delete v;
+    if (mixed)
+      for (auto v : r_sloppy) delete v;
+    for (auto v : r) delete v;
+    w.clear();
+    q.clear();
+    p.clear();
+    x_sloppy.clear();
+    r_sloppy.clear();
+    r.clear();
+
+    if (mixed) {
+      delete tmp2_sloppy;
+      delete tmp_sloppy;
+    }
+    delete tmp2p;
+    delete tmpp;
+
+    n_src = 0;
+  }
+
+  int BlockCG::orthonormalize(std::vector<ColorSpinorField *> &v)
+  {
+    const int m = v.size();
+    if (m == 0) return 0;
+
+    // relative singular value below which a direction is deemed dependent
+    double rank_tol;
+    switch (param.precision_sloppy) {
+    case QUDA_DOUBLE_PRECISION: rank_tol = 1e-8; break;
+    case QUDA_SINGLE_PRECISION: rank_tol = 1e-4; break;
+    default: rank_tol = 1e-2;
+    }
+
+    std::vector<Complex> G_(m * m);
+    blas::cDotProduct(G_.data(), v, v);
+    MatrixXcd G(m, m);
+    for (int i = 0; i < m; i++)
+      for (int j = 0; j < m; j++) G(i, j) = G_[i * m + j];
+    G = 0.5 * (G + G.adjoint()).eval();
+
+    SelfAdjointEigenSolver<MatrixXcd> eigensolver(G);
+    const VectorXd &sigma2 = eigensolver.eigenvalues(); // ascending
+    const MatrixXcd &U = eigensolver.eigenvectors();
+    if (sigma2(m - 1) <= 0.0) return 0;
+
+    std::vector<int> keep;
+    for (int i = m - 1; i >= 0; i--)
+      if (sigma2(i) > rank_tol * rank_tol * sigma2(m - 1)) keep.push_back(i);
+    const int rank = keep.size();
+
+    // p = v U_k Sigma_k^{-1}
+    std::vector<Complex> T(m * rank);
+    for (int i = 0; i < m; i++)
+      for (int c = 0; c < rank; c++) T[i * rank + c] = U(i, keep[c]) / sqrt(sigma2(keep[c]));
+
+    std::vector<ColorSpinorField *> p_k(p.begin(), p.begin() + rank);
+    for (auto pi : p_k) blas::zero(*pi);
+    blas::caxpy(T.data(), v, p_k);
+
+    if (rank < m && getVerbosity() >= QUDA_DEBUG_VERBOSE)
+      printfQuda("BlockCG: dropped %d of %d dependent directions\n", m - rank, m);
+
+    return rank;
+  }
+
+  void BlockCG::operator()(ColorSpinorField &out, ColorSpinorField &in)
+  {
+    std::vector<ColorSpinorField *> x {&out}, b {&in};
+    blocksolve(x, b);
+  }
+
+  void BlockCG::blocksolve(std::vector<ColorSpinorField *> &x, std::vector<ColorSpinorField *> &b)
+  {
+    if (x.size() != b.size()) errorQuda("Mismatched set sizes out=%lu in=%lu", x.size(), b.size());
+    const int n = b.size();
+    if (n == 0) return;
+    if (n > QUDA_MAX_MULTI_SHIFT)
+      errorQuda("Block CG supports at most %d right-hand sides (requested %d)", QUDA_MAX_MULTI_SHIFT, n);
+    if (checkLocation(*x[0], *b[0]) != QUDA_CUDA_FIELD_LOCATION) errorQuda("Not supported");
+    if (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL) errorQuda("Heavy-quark residual not supported by block CG");
+    if (param.deflate) errorQuda("Deflation not supported by block CG");
+
+    profile.TPSTART(QUDA_PROFILE_INIT);
+
+    create(*x[0], n);
+    const bool mixed = param.precision != param.precision_sloppy;
+
+    std::vector<double> b2(n), r2(n), stop(n);
+    for (int j = 0; j < n; j++) {
+      b2[j] = blas::norm2(*b[j]);
+      stop[j] = stopping(param.tol, b2[j], param.residual_type);
+    }
+
+    if (param.use_init_guess == QUDA_USE_INIT_GUESS_YES) {
+      mat(r, x, *tmpp, *tmp2p);
+      for (int j = 0; j < n; j++) r2[j] = blas::xmyNorm(*b[j], *r[j]);
+    } else {
+      for (int j = 0; j < n; j++) {
+        blas::zero(*x[j]);
+        blas::copy(*r[j], *b[j]);
+        r2[j] = b2[j];
+      }
+    }
+
+    // zero sources have the trivial solution and are never active
+    for (int j = 0; j < n; j++)
+      if (b2[j] == 0.0) {
+        blas::zero(*x[j]);
+        r2[j] = 0.0;
+      }
+    auto unconverged = [&](int j) { return b2[j] > 0.0 && !convergence(r2[j], 0.0, stop[j], param.tol_hq); };
+    std::vector<int> active;
+    for (int j = 0; j < n; j++)
+      if (unconverged(j)) active.push_back(j);
+
+    // report the worst relative residual of the block
+    auto print_stats = [&](int k, const std::vector<int> &set) {
+      int worst = set.size() > 0 ? set[0] : 0;
+      for (auto j : set)
+        if (r2[j] * b2[worst] > r2[worst] * b2[j]) worst = j;
+      PrintStats("BlockCG", k, r2[worst], b2[worst], 0.0);
+    };
+
+    profile.TPSTOP(QUDA_PROFILE_INIT);
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+    blas::flops = 0;
+
+    int k = 0;
+    print_stats(k, active);
+
+    while (active.size() > 0 && k < param.maxiter) {
+      // each cycle starts from the true residual; with mixed precision
+      // a right-hand side leaves the cycle once reduced by delta
+      const std::vector<int> cycle = active;
+      std::vector<double> target(n);
+      for (auto j : cycle) {
+        target[j] = mixed ? std::max(stop[j], param.delta * param.delta * r2[j]) : stop[j];
+        if (mixed) blas::copy(*r_sloppy[j], *r[j]);
+        blas::zero(*x_sloppy[j]);
+      }
+
+      std::vector<int> live = cycle;
+      std::vector<ColorSpinorField *> r_live;
+      for (auto j : live) r_live.push_back(r_sloppy[j]);
+      int rank = orthonormalize(r_live);
+      const int k_cycle = k;
+
+      while (rank > 0 && k < param.maxiter) {
+        const int m = live.size();
+        std::vector<ColorSpinorField *> p_k(p.begin(), p.begin() + rank);
+        std::vector<ColorSpinorField *> q_k(q.begin(), q.begin() + rank);
+        std::vector<ColorSpinorField *> x_live;
+        for (auto j : live) x_live.push_back(x_sloppy[j]);
+
+        matSloppy(q_k, p_k, *tmp_sloppy, *tmp2_sloppy);
+
+        // single reduction for P^dag Q and P^dag R
+        std::vector<ColorSpinorField *> qr(q_k);
+        qr.insert(qr.end(), r_live.begin(), r_live.end());
+        std::vector<Complex> pqr(rank * (rank + m));
+        blas::cDotProduct(pqr.data(), p_k, qr);
+
+        MatrixXcd PQ(rank, rank), PR(rank, m);
+        for (int a = 0; a < rank; a++) {
+          for (int c = 0; c < rank; c++) PQ(a, c) = pqr[a * (rank + m) + c];
+          for (int c = 0; c < m; c++) PR(a, c) = pqr[a * (rank + m) + rank + c];
+        }
+        PQ = 0.5 * (PQ + PQ.adjoint()).eval();
+
+        LLT<MatrixXcd> llt(PQ);
+        if (llt.info() != Success) {
+          warningQuda("BlockCG: P^dag A P is not positive definite at iteration %d, restarting", k);
+          break;
+        }
+        const MatrixXcd alpha = llt.solve(PR);
+
+        // x += P alpha, r -= Q alpha
+        std::vector<Complex> alpha_(rank * m), malpha_(rank * m);
+        for (int a = 0; a < rank; a++)
+          for (int c = 0; c < m; c++) {
+            alpha_[a * m + c] = alpha(a, c);
+            malpha_[a * m + c] = -alpha(a, c);
+          }
+        blas::caxpy(alpha_.data(), p_k, x_live);
+        blas::caxpy(malpha_.data(), q_k, r_live);
+
+        k++;
+
+        // single reduction for Q^dag R and R^dag R
+        std::vector<Complex> qrr((rank + m) * m);
+        blas::cDotProduct(qrr.data(), qr, r_live);
+        for (int c = 0; c < m; c++) r2[live[c]] = qrr[(rank + c) * m + c].real();
+
+        print_stats(k, live);
+
+        // retire the converged right-hand sides
+        std::vector<int> keep;
+        for (int c = 0; c < m; c++)
+          if (!convergence(r2[live[c]], 0.0, target[live[c]], param.tol_hq)) keep.push_back(c);
+        if (keep.size() == 0) break;
+
+        // beta = -(P^dag Q)^{-1} Q^dag Z for the remaining residuals Z
+        const int m_new = keep.size();
+        MatrixXcd QZ(rank, m_new);
+        for (int a = 0; a < rank; a++)
+          for (int c = 0; c < m_new; c++) QZ(a, c) = qrr[a * m + keep[c]];
+        const MatrixXcd beta = -llt.solve(QZ);
+
+        std::vector<int> live_new;
+        std::vector<ColorSpinorField *> r_new;
+        for (auto c : keep) {
+          live_new.push_back(live[c]);
+          r_new.push_back(r_live[c]);
+        }
+        live = live_new;
+        r_live = r_new;
+
+        // W = Z + P beta, then P = orth(W)
+        std::vector<ColorSpinorField *> w_k(w.begin(), w.begin() + m_new);
+        std::vector<Complex> beta_(rank * m_new);
+        for (int a = 0; a < rank; a++)
+          for (int c = 0; c < m_new; c++) beta_[a * m_new + c] = beta(a, c);
+        for (int c = 0; c < m_new; c++) blas::copy(*w_k[c], *r_live[c]);
+        blas::caxpy(beta_.data(), p_k, w_k);
+
+        rank = orthonormalize(w_k);
+      }
+
+      // accumulate the solution and recompute the true residual
+      std::vector<ColorSpinorField *> x_cycle, r_cycle;
+      for (auto j : cycle) {
+        blas::xpy(*x_sloppy[j], *x[j]);
+        x_cycle.push_back(x[j]);
+        r_cycle.push_back(r[j]);
+      }
+      mat(r_cycle, x_cycle, *tmpp, *tmp2p);
+      for (auto j : cycle) r2[j] = blas::xmyNorm(*b[j], *r[j]);
+
+      active.clear();
+      for (auto j : cycle)
+        if (unconverged(j)) active.push_back(j);
+
+      if (getVerbosity() >= QUDA_VERBOSE)
+        printfQuda("BlockCG: %lu of %d right-hand sides remaining after %d iterations\n", active.size(), n, k);
+
+      if (k == k_cycle && active.size() > 0) {
+        warningQuda("BlockCG: no progress with %lu right-hand sides unconverged", active.size());
+        break;
+      }
+    }
+
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    profile.TPSTART(QUDA_PROFILE_EPILOGUE);
+
+    param.secs = profile.Last(QUDA_PROFILE_COMPUTE);
+    double gflops = (blas::flops + mat.flops() + matSloppy.flops()) * 1e-9;
+    param.gflops = gflops;
+    param.iter += k;
+
+    if (k == param.maxiter) warningQuda("Exceeded maximum iterations %d", param.maxiter);
+
+    param.true_res = 0.0;
+    param.true_res_hq = 0.0;
+    for (int j = 0; j < n; j++) {
+      const double true_res = b2[j] > 0.0 ? sqrt(r2[j] / b2[j]) : 0.0;
+      param.true_res_offset[j] = true_res;
+      param.iter_res_offset[j] = true_res;
+      param.true_res_hq_offset[j] = 0.0;
+      param.true_res = std::max(param.true_res, true_res);
+      PrintSummary("BlockCG", k, r2[j], b2[j], stop[j], 0.0);
+    }
+
+    // reset the flops counters
+    blas::flops = 0;
+    mat.flops();
+    matSloppy.flops();
+
+    profile.TPSTOP(QUDA_PROFILE_EPILOGUE);
+  }
+
+} // namespace quda
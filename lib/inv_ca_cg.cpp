@@ -256,6 +256,11 @@ namespace quda {
       // now allocate sloppy fields
       csParam.setPrecision(param.precision_sloppy);
 
+      if (basis == QUDA_NEWTON_BASIS) {
+        warningQuda("CA-CG does not support QUDA_NEWTON_BASIS. Switching to QUDA_CHEBYSHEV_BASIS...\n");
+        basis = QUDA_CHEBYSHEV_BASIS;
+      }
+
       if (basis == QUDA_POWER_BASIS) {
         // in power basis AS[k] = S[k+1], so we don't need a separate array
         S.resize(param.Nkrylov+1);
@@ -12,10 +12,14 @@ namespace quda {
     use_source(param.preserve_source == QUDA_PRESERVE_SOURCE_NO && param.precision == param.precision_sloppy
                && param.use_init_guess == QUDA_USE_INIT_GUESS_NO && !param.deflate),
     basis(param.ca_basis),
+    lambda_init(false),
+    sigma(1.0),
     alpha(nullptr),
     rp(nullptr),
     tmpp(nullptr),
-    tmp_sloppy(nullptr)
+    tmp_sloppy(nullptr),
+    p_block(nullptr),
+    q_block(nullptr)
   {
   }
 
@@ -24,10 +28,14 @@ namespace quda {
 
     if (init) {
       if (alpha) delete []alpha;
-      if (basis == QUDA_POWER_BASIS) {
-        for (int i=0; i<param.Nkrylov+1; i++) if (i>0 || !use_source) delete p[i];
+      if (p_block) {
+        delete p_block;
       } else {
-        for (int i=0; i<param.Nkrylov; i++) if (i>0 || !use_source) delete p[i];
+        for (int i = 0; i < (int)p.size(); i++) if (i>0 || !use_source) delete p[i];
+      }
+      if (q_block) {
+        delete q_block;
+      } else if (basis != QUDA_POWER_BASIS) {
         for (int i=0; i<param.Nkrylov; i++) delete q[i];
       }
       if (tmp_sloppy) delete tmp_sloppy;
@@ -62,26 +70,39 @@ namespace quda {
       // now allocate sloppy fields
       csParam.setPrecision(param.precision_sloppy);
 
-      if (basis != QUDA_POWER_BASIS) {
-        warningQuda("CA-GCR does not support any basis besides QUDA_POWER_BASIS. Switching to QUDA_POWER_BASIS...\n");
+      if (basis != QUDA_POWER_BASIS && basis != QUDA_CHEBYSHEV_BASIS && basis != QUDA_NEWTON_BASIS) {
+        warningQuda("CA-GCR does not support basis %d. Switching to QUDA_POWER_BASIS...\n", basis);
         basis = QUDA_POWER_BASIS;
       }
 
+      // On the device the basis vectors are the components of a
+      // single composite field, such that the block reductions
+      // stream contiguous memory
+      auto create_block = [&](int n) -> ColorSpinorField * {
+        if (n == 0 || csParam.location != QUDA_CUDA_FIELD_LOCATION) return nullptr;
+        ColorSpinorParam blockParam(csParam);
+        blockParam.is_composite = true;
+        blockParam.composite_dim = n;
+        return ColorSpinorField::Create(blockParam);
+      };
+
+      // in power basis q[k] = p[k+1], so we don't need a separate q array
+      const int n_p = basis == QUDA_POWER_BASIS ? param.Nkrylov + 1 : param.Nkrylov;
+      const int offset = use_source ? 1 : 0;
+      p_block = create_block(n_p - offset);
+      p.resize(n_p);
+      q.resize(param.Nkrylov);
+      for (int i = 0; i < n_p; i++) {
+        if (i == 0 && use_source) p[i] = &b;
+        else p[i] = p_block ? &p_block->Component(i - offset) : ColorSpinorField::Create(csParam);
+      }
+
       if (basis == QUDA_POWER_BASIS) {
-        // in power basis q[k] = p[k+1], so we don't need a separate q array
-        p.resize(param.Nkrylov+1);
-        q.resize(param.Nkrylov);
-        for (int i=0; i<param.Nkrylov+1; i++) {
-          p[i] = (i==0 && use_source) ? &b : ColorSpinorField::Create(csParam);
-          if (i>0) q[i-1] = p[i];
-        }
+        for (int i = 0; i < param.Nkrylov; i++) q[i] = p[i + 1];
       } else {
-        p.resize(param.Nkrylov);
-        q.resize(param.Nkrylov);
-        for (int i=0; i<param.Nkrylov; i++) {
-          p[i] = (i==0 && use_source) ? &b : ColorSpinorField::Create(csParam);
-          q[i] = ColorSpinorField::Create(csParam);
-        }
+        q_block = create_block(param.Nkrylov);
+        for (int i = 0; i < param.Nkrylov; i++)
+          q[i] = q_block ? &q_block->Component(i) : ColorSpinorField::Create(csParam);
       }
 
       //sloppy temporary for mat-vec
@@ -93,7 +114,7 @@ namespace quda {
     } // init
   }
 
-  void CAGCR::solve(Complex *psi_, std::vector<ColorSpinorField*> &q, ColorSpinorField &b)
+  double CAGCR::solve(Complex *psi_, std::vector<ColorSpinorField *> &q, ColorSpinorField &b, bool estimate)
   {
     typedef Matrix<Complex, Dynamic, Dynamic> matrix;
     typedef Matrix<Complex, Dynamic, 1> vector;
@@ -109,15 +130,18 @@ namespace quda {
     for (int i=0; i<N; i++) Q.push_back(q[i]);
     Q.push_back(&b);
 
-    // Construct the matrix Q* Q = (A P)* (A P) = (q_i, q_j) = (A p_i, A p_j)
-    Complex *A_ = new Complex[N*(N+1)];
-    blas::cDotProduct(A_, q, Q);
+    // Construct the matrix Q* Q = (A P)* (A P) = (q_i, q_j) = (A p_i, A p_j),
+    // adding the row (b, Q) when estimating, which supplies |b|^2
+    const int M = estimate ? N + 1 : N;
+    Complex *A_ = new Complex[M*(N+1)];
+    blas::cDotProduct(A_, estimate ? Q : q, Q);
     for (int i=0; i<N; i++) {
       phi(i) = A_[i*(N+1)+N];
       for (int j=0; j<N; j++) {
         A(i,j) = A_[i*(N+1)+j];
       }
     }
+    const double b2 = estimate ? A_[N * (N + 1) + N].real() : 0.0;
     delete[] A_;
 #else
     // two reductions but uses the Hermitian block dot product
@@ -136,6 +160,7 @@ namespace quda {
       for (int j=0; j<N; j++)
         A(i,j) = A_[i*N+j];
     delete[] A_;
+    const double b2 = estimate ? blas::norm2(b) : 0.0;
 #endif
 
     if (!param.is_preconditioner) {
@@ -156,6 +181,151 @@ namespace quda {
       profile.TPSTART(QUDA_PROFILE_COMPUTE);
     }
 
+    // |b - Q psi|^2 = |b|^2 - phi^dagger psi at the least-squares minimum
+    return estimate ? b2 - phi.dot(psi).real() : 0.0;
+  }
+
+  void CAGCR::computeBasisParameters(ColorSpinorField &tmpSloppy)
+  {
+    typedef Matrix<Complex, Dynamic, Dynamic> matrix;
+
+    const int N = param.Nkrylov;
+    auto &lambda_min = param.ca_lambda_min;
+    auto &lambda_max = param.ca_lambda_max;
+
+    if (lambda_init || basis == QUDA_POWER_BASIS || N == 1) return;
+    if (basis == QUDA_CHEBYSHEV_BASIS && lambda_max >= lambda_min) return;
+
+    if (!param.is_preconditioner) {
+      profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+      profile.TPSTART(QUDA_PROFILE_INIT);
+    }
+
+    // Arnoldi process with classical Gram-Schmidt, using q as the
+    // orthonormal basis and p[1] as the final workspace (p[0] holds
+    // the residual, which we must preserve)
+    matrix H = matrix::Zero(N, N);
+    blas::copy(*q[0], *p[0]);
+    blas::ax(1.0 / sqrt(blas::norm2(*q[0])), *q[0]);
+
+    std::vector<Complex> h(N);
+    for (int k = 0; k < N; k++) {
+      ColorSpinorField &w = k < N - 1 ? *q[k + 1] : *p[1];
+      matSloppy(w, *q[k], tmpSloppy);
+
+      std::vector<ColorSpinorField *> V(q.begin(), q.begin() + k + 1);
+      std::vector<ColorSpinorField *> W {&w};
+      blas::cDotProduct(h.data(), V, W);
+      for (int j = 0; j <= k; j++) H(j, k) = h[j];
+      if (k == N - 1) break;
+
+      for (int j = 0; j <= k; j++) h[j] = -h[j];
+      blas::caxpy(h.data(), V, W);
+      double norm = sqrt(blas::norm2(w));
+      if (norm == 0.0) break; // invariant subspace found, the Ritz values of the leading block suffice
+      H(k + 1, k) = norm;
+      blas::ax(1.0 / norm, w);
+    }
+
+    ComplexEigenSolver<matrix> eigensolver(H, false);
+    std::vector<Complex> ritz(N);
+    for (int i = 0; i < N; i++) ritz[i] = eigensolver.eigenvalues()[i];
+
+    if (basis == QUDA_CHEBYSHEV_BASIS) {
+      // The Chebyshev basis is defined on the real interval [lambda_min,
+      // lambda_max], which for a non-Hermitian operator only accounts
+      // for the real part of the spectrum, so the Newton basis is better
+      // suited to a spectrum with a large imaginary extent.  The upper
+      // end is bounded by the largest Ritz modulus.  The smallest Ritz
+      // real part overestimates the lower end, so we take half of it,
+      // unless the given lower bound is larger.
+      double max_abs = 0.0;
+      double min_real = ritz[0].real();
+      for (auto &r : ritz) {
+        max_abs = std::max(max_abs, abs(r));
+        min_real = std::min(min_real, r.real());
+      }
+      lambda_max = 1.1 * max_abs;
+      if (min_real > 0.0) lambda_min = std::max(lambda_min, 0.5 * min_real);
+      if (getVerbosity() >= QUDA_SUMMARIZE)
+        printfQuda("CA-GCR Approximate lambda min = %e, lambda max = 1.1 x %e\n", lambda_min, max_abs);
+    } else {
+      // Leja ordering: start from the Ritz value of largest modulus
+      // and then pick the one maximizing the product of distances to
+      // those already chosen, which keeps the Newton basis well
+      // conditioned
+      theta.resize(N - 1);
+      std::vector<bool> used(N, false);
+      sigma = 0.0;
+      for (int k = 0; k < N - 1; k++) {
+        int best = -1;
+        double best_measure = -1.0;
+        for (int i = 0; i < N; i++) {
+          if (used[i]) continue;
+          double measure = abs(ritz[i]);
+          if (k > 0) {
+            measure = 1.0;
+            for (int j = 0; j < k; j++) measure *= abs(ritz[i] - theta[j]);
+          }
+          if (measure > best_measure) {
+            best = i;
+            best_measure = measure;
+          }
+        }
+        used[best] = true;
+        theta[k] = ritz[best];
+        sigma = std::max(sigma, abs(ritz[best]));
+        if (getVerbosity() >= QUDA_VERBOSE)
+          printfQuda("CA-GCR Newton shift %d = (%e, %e)\n", k, theta[k].real(), theta[k].imag());
+      }
+      if (sigma == 0.0) sigma = 1.0;
+    }
+
+    lambda_init = true;
+
+    if (!param.is_preconditioner) {
+      profile.TPSTOP(QUDA_PROFILE_INIT);
+      profile.TPSTART(QUDA_PROFILE_COMPUTE);
+    }
+  }
+
+  void CAGCR::nextBasisVector(int k)
+  {
+    switch (basis) {
+    case QUDA_POWER_BASIS: break; // p[k+1] = q[k] by aliasing
+    case QUDA_CHEBYSHEV_BASIS: {
+      // Factors which map linear operator onto [-1,1]
+      const double lambda_min = param.ca_lambda_min;
+      const double lambda_max = param.ca_lambda_max;
+      const double m_map = 2. / (lambda_max - lambda_min);
+      const double b_map = -(lambda_max + lambda_min) / (lambda_max - lambda_min);
+
+      std::vector<ColorSpinorField *> Pk {p[k + 1]};
+      blas::zero(*p[k + 1]);
+      if (k == 0) {
+        // p_1 = m q_0 + b p_0
+        Complex facs[] = {m_map, b_map};
+        std::vector<ColorSpinorField *> recur {q[0], p[0]};
+        blas::caxpy(facs, recur, Pk);
+      } else {
+        // p_{k+1} = 2 m q_k + 2 b p_k - p_{k-1}
+        Complex facs[] = {2. * m_map, 2. * b_map, -1.};
+        std::vector<ColorSpinorField *> recur {q[k], p[k], p[k - 1]};
+        blas::caxpy(facs, recur, Pk);
+      }
+      break;
+    }
+    case QUDA_NEWTON_BASIS: {
+      // p_{k+1} = (q_k - theta_k p_k) / sigma
+      Complex facs[] = {1.0 / sigma, -theta[k] / sigma};
+      std::vector<ColorSpinorField *> recur {q[k], p[k]};
+      std::vector<ColorSpinorField *> Pk {p[k + 1]};
+      blas::zero(*p[k + 1]);
+      blas::caxpy(facs, recur, Pk);
+      break;
+    }
+    default: errorQuda("Unexpected basis %d", basis);
+    }
   }
 
   /*
@@ -164,6 +334,12 @@ namespace quda {
     2. Minimize the residual in this basis
     3. Update solution and residual vectors
     4. (Optional) restart if convergence or maxiter not reached
+
+    Each cycle of Nkrylov steps requires a single block reduction,
+    since the residual norm follows from the Gram matrix.  With the
+    Chebyshev or Newton basis, Nkrylov can be made large without the
+    basis becoming degenerate, which suits the coarsest grid of
+    multigrid where the solve is dominated by reduction latency.
   */
   void CAGCR::operator()(ColorSpinorField &x, ColorSpinorField &b)
   {
@@ -291,16 +467,29 @@ namespace quda {
 
     blas::copy(*p[0], r); // no op if uni-precision
 
+    // estimate the Chebyshev or Newton basis parameters from the operator
+    computeBasisParameters(tmpSloppy);
+
+    // The Chebyshev and Newton bases take the residual norm from the
+    // block reduction, while for the power basis, whose Gram matrix is
+    // too ill-conditioned for this, it is computed explicitly.  Below
+    // this fraction of the previous squared residual norm, the estimate
+    // has lost too many digits to cancellation and is not used either.
+    const bool estimate_r2 = basis != QUDA_POWER_BASIS && getVerbosity() < QUDA_DEBUG_VERBOSE;
+    const double r2_estimate_tol = sqrt(precisionEpsilon(param.precision_sloppy));
+
     PrintStats("CA-GCR", total_iter, r2, b2, heavy_quark_res);
     while ( !convergence(r2, heavy_quark_res, stop, param.tol_hq) && total_iter < param.maxiter) {
 
       // build up a space of size n_krylov
       for (int k = 0; k < n_krylov; k++) {
         matSloppy(*q[k], *p[k], tmpSloppy);
-        if (k < n_krylov - 1 && basis != QUDA_POWER_BASIS) blas::copy(*p[k + 1], *q[k]);
+        if (k < n_krylov - 1) nextBasisVector(k);
       }
 
-      solve(alpha, q, *p[0]);
+      // single block reduction for the Gram matrix, the projected residual
+      // and, if estimating, the norm of the residual p[0] of this cycle
+      double r2_estimate = solve(alpha, q, *p[0], estimate_r2 || getVerbosity() >= QUDA_DEBUG_VERBOSE);
 
       // update the solution vector
       std::vector<ColorSpinorField*> X;
@@ -322,8 +511,17 @@ namespace quda {
 
       total_iter += n_krylov;
       if ( !fixed_iteration || getVerbosity() >= QUDA_DEBUG_VERBOSE) {
-        // only compute the residual norm if we need to
-        r2 = blas::norm2(r);
+        // only compute the residual norm if we need to, preferring
+        // the estimate from the Gram matrix to save a reduction, but
+        // never accepting convergence on the estimate alone
+        if (estimate_r2 && r2_estimate > r2_estimate_tol * r2 && r2_estimate >= stop) {
+          r2 = r2_estimate;
+        } else {
+          r2 = blas::norm2(r);
+          if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+            printfQuda("CA-GCR: residual norm = %e, Gram-matrix estimate = %e\n", sqrt(r2),
+                       sqrt(std::max(r2_estimate, 0.0)));
+        }
       }
 
       PrintStats("CA-GCR", total_iter, r2, b2, heavy_quark_res);
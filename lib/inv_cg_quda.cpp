@@ -2,8 +2,10 @@
 #include <cstdlib>
 #include <cmath>
 #include <limits>
+#include <algorithm>
 #include <memory>
 #include <iostream>
+#include <string>
 
 #include <quda_internal.h>
 #include <color_spinor_field.h>
@@ -29,7 +31,13 @@ namespace quda {
     tmp3p(nullptr),
     rSloppyp(nullptr),
     xSloppyp(nullptr),
-    init(false)
+    init(false),
+    adaptive_up(false),
+    adaptive_down(false),
+    adaptive_patience(0),
+    adaptive_clean(0),
+    adaptive_step(0),
+    r2_old_exit(0.0)
   {
   }
 
@@ -220,8 +228,95 @@ namespace quda {
 
   }
 
+  void CG::adaptiveSolve(ColorSpinorField &x, ColorSpinorField &b, ColorSpinorField *p_init, double r2_old_init)
+  {
+    if (adaptive_solver.size() == 0) {
+      // the operators available, in order of increasing precision
+      std::vector<std::pair<QudaPrecision, const DiracMatrix *>> ops
+        = {{param.precision_precondition, &matPrecon}, {param.precision_sloppy, &matSloppy}, {param.precision, &mat}};
+      std::stable_sort(ops.begin(), ops.end(),
+                       [](const std::pair<QudaPrecision, const DiracMatrix *> &a,
+                          const std::pair<QudaPrecision, const DiracMatrix *> &b) { return a.first < b.first; });
+
+      for (auto &op : ops) {
+        if (op.first == QUDA_INVALID_PRECISION || op.first > param.precision) continue;
+        if (adaptive_param.size() > 0 && adaptive_param.back()->precision_sloppy == op.first) continue;
+        adaptive_param.push_back(std::make_unique<SolverParam>(param));
+        adaptive_param.back()->precision_sloppy = op.first;
+        adaptive_solver.push_back(
+          std::make_unique<CG>(mat, *op.second, *op.second, matEig, *adaptive_param.back(), profile));
+      }
+    }
+
+    const int n_level = adaptive_solver.size();
+    int level = 0;
+    int patience = 3;
+    int iter = 0;
+    double secs = 0.0;
+    double gflops = 0.0;
+    QudaUseInitGuess use_init_guess = param.use_init_guess;
+    precision_schedule.clear();
+
+    while (true) {
+      CG &cg = *adaptive_solver[level];
+      SolverParam &level_param = *adaptive_param[level];
+
+      // pick up any changes to the parameters since the last solve
+      QudaPrecision precision_sloppy = level_param.precision_sloppy;
+      level_param = param;
+      level_param.precision_sloppy = precision_sloppy;
+      level_param.use_adaptive_precision = false;
+      if (precision_sloppy == param.precision) level_param.use_sloppy_partial_accumulator = false;
+      level_param.use_init_guess = use_init_guess;
+      level_param.maxiter = param.maxiter - iter;
+      level_param.iter = 0;
+
+      cg.adaptive_up = level + 1 < n_level;
+      cg.adaptive_down = level > 0;
+      cg.adaptive_patience = patience;
+      cg.adaptive_clean = 0;
+      cg.adaptive_step = 0;
+
+      precision_schedule.push_back({iter, precision_sloppy});
+      cg(x, b, p_init, r2_old_init);
+
+      iter += level_param.iter;
+      secs += level_param.secs;
+      gflops += level_param.gflops;
+      param.true_res = level_param.true_res;
+      param.true_res_hq = level_param.true_res_hq;
+
+      if (cg.adaptive_step == 0 || iter >= param.maxiter) break;
+
+      // continue the recurrence at the new precision
+      if (getVerbosity() >= QUDA_VERBOSE)
+        printfQuda("CG: stepping sloppy precision %s at iteration %d\n", cg.adaptive_step > 0 ? "up" : "down", iter);
+      if (cg.adaptive_step > 0) patience *= 2; // be more reluctant to step down again
+      level += cg.adaptive_step;
+      p_init = cg.p[0];
+      r2_old_init = cg.r2_old_exit;
+      use_init_guess = QUDA_USE_INIT_GUESS_YES;
+    }
+
+    param.iter += iter;
+    param.secs = secs;
+    param.gflops = gflops;
+
+    if (getVerbosity() >= QUDA_SUMMARIZE) {
+      std::string schedule;
+      for (auto &step : precision_schedule)
+        schedule += " iter " + std::to_string(step.first) + " = " + std::to_string(step.second) + "-byte";
+      printfQuda("CG: adaptive precision schedule:%s\n", schedule.c_str());
+    }
+  }
+
   void CG::operator()(ColorSpinorField &x, ColorSpinorField &b, ColorSpinorField *p_init, double r2_old_init)
   {
+    if (param.use_adaptive_precision && !param.is_preconditioner && !param.deflate && !param.pipeline) {
+      adaptiveSolve(x, b, p_init, r2_old_init);
+      return;
+    }
+
     if (param.is_preconditioner) commGlobalReductionPush(param.global_reduction);
 
     if (checkLocation(x, b) != QUDA_CUDA_FIELD_LOCATION)
@@ -470,6 +565,7 @@ namespace quda {
 
     int steps_since_reliable = 1;
     bool converged = convergence(r2, heavy_quark_res, stop, param.tol_hq);
+    bool handover = false; // whether we exit to continue at another precision
 
     // alternative reliable updates
     if(alternative_reliable){
@@ -600,6 +696,8 @@ namespace quda {
 
       } else {
 
+        const double r2_iter = r2; // iterated residual, used to measure the drift
+
 	{
 	  std::vector<ColorSpinorField*> x_;
 	  x_.push_back(&xSloppy);
@@ -645,8 +743,26 @@ namespace quda {
         // calculate new reliable HQ resididual
         if (use_heavy_quark_res) heavy_quark_res = sqrt(blas::HeavyQuarkResidualNorm(y, r).z);
 
+        // with adaptive precision, too much drift between the iterated
+        // and true residual, or a true residual increase, steps up the
+        // sloppy precision, while a run of clean updates steps it down
+        if (adaptive_up || adaptive_down) {
+          const double drift = sqrt(r2 / r2_iter);
+          const double drift_up = std::min(10.0, std::max(2.0, 1.0 / sqrt(delta)));
+          constexpr double drift_down = 1.1;
+          if (adaptive_up && (drift > drift_up || sqrt(r2) > r0Norm)) {
+            adaptive_step = 1;
+          } else if (drift < drift_down) {
+            if (adaptive_down && ++adaptive_clean >= adaptive_patience) adaptive_step = -1;
+          } else {
+            adaptive_clean = 0;
+          }
+          if (adaptive_step != 0 && getVerbosity() >= QUDA_DEBUG_VERBOSE)
+            printfQuda("CG: residual drift %e at %d-byte sloppy precision\n", drift, param.precision_sloppy);
+        }
+
         // break-out check if we have reached the limit of the precision
-        if (sqrt(r2) > r0Norm && updateX and not L2breakdown) { // reuse r0Norm for this
+        if (sqrt(r2) > r0Norm && updateX and not L2breakdown and adaptive_step <= 0) { // reuse r0Norm for this
           resIncrease++;
           resIncreaseTotal++;
           warningQuda(
@@ -744,7 +860,15 @@ namespace quda {
       }
 
       j = steps_since_reliable == 0 ? 0 : (j+1)%Np; // if just done a reliable update then reset j
+
+      // hand over to another precision, continuing from the current search direction
+      if (adaptive_step != 0 && !converged) {
+        r2_old_exit = r2;
+        handover = true;
+        break;
+      }
     }
+    if (!handover) adaptive_step = 0;
 
     blas::copy(x, xSloppy);
     blas::xpy(y, x);
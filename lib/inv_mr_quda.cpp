@@ -26,6 +26,9 @@ namespace quda {
     if (param.schwarz_type == QUDA_MULTIPLICATIVE_SCHWARZ && param.Nsteps % 2 == 1) {
       errorQuda("For multiplicative Schwarz, number of solver steps %d must be even", param.Nsteps);
     }
+    if (param.schwarz_type == QUDA_BLOCK_JACOBI_SCHWARZ && param.schwarz_block <= 0) {
+      errorQuda("Invalid block-Jacobi block extent %d", param.schwarz_block);
+    }
   }
 
   MR::~MR() {
@@ -50,6 +53,9 @@ namespace quda {
       return;
     }
 
+    // the block-Jacobi update does not track the residual, so it must always be recomputed
+    const bool block_jacobi = param.schwarz_type == QUDA_BLOCK_JACOBI_SCHWARZ;
+
     if (!init) {
       bool mixed = param.precision != param.precision_sloppy;
 
@@ -58,10 +64,10 @@ namespace quda {
 
       // Source needs to be preserved if we're computing the true residual
       rp = (param.use_init_guess == QUDA_USE_INIT_GUESS_YES || param.preserve_source == QUDA_PRESERVE_SOURCE_YES
-	    || param.Nsteps > 1 || param.compute_true_res == 1) ?
+	    || param.Nsteps > 1 || param.compute_true_res == 1 || block_jacobi) ?
 	ColorSpinorField::Create(csParam) : nullptr;
 
-      tmpp = (param.use_init_guess == QUDA_USE_INIT_GUESS_YES || param.Nsteps > 1 || param.compute_true_res) ?
+      tmpp = (param.use_init_guess == QUDA_USE_INIT_GUESS_YES || param.Nsteps > 1 || param.compute_true_res || block_jacobi) ?
 	ColorSpinorField::Create(csParam) : nullptr;
 
       // now allocate sloppy fields
@@ -133,6 +139,12 @@ namespace quda {
 	if (getVerbosity() >= QUDA_VERBOSE) printfQuda("MR: %d cycle, %d iterations, r2 = %e\n", step, k, r2);
 
 	double3 Ar3;
+	if (block_jacobi && r2 > 0.0) {
+	  // each block is relaxed independently within a single host thread, so there is no
+	  // communication and no reduction until the true residual is recomputed below
+	  matSloppy.Expose()->BlockMR(xSloppy, rSloppy, param.schwarz_block, param.maxiter, param.omega);
+	  k = param.maxiter;
+	}
 	while (k < param.maxiter && r2 > 0.0) {
     
 	  matSloppy(Ar, rSloppy, tmpSloppy);
@@ -168,7 +180,7 @@ namespace quda {
       step++;
 
       // FIXME - add over/under relaxation in outer loop
-      if (param.compute_true_res || param.Nsteps > 1) {
+      if (param.compute_true_res || param.Nsteps > 1 || block_jacobi) {
 	mat(r, x, tmp);
 	r2 = blas::xmyNorm(b, r);
 	param.true_res = sqrt(r2 / b2);
@@ -96,7 +96,9 @@ namespace quda {
       return;
     }
 
-    if (N == 1) {
+    // with a single previous solution this is the guess (unless the
+    // basis has been normalized, in which case we need its scale)
+    if (N == 1 && orthogonal) {
       blas::copy(x, *p[0]);
       if (!running) profile.TPSTOP(QUDA_PROFILE_CHRONO);
       return;
@@ -169,5 +171,113 @@ namespace quda {
   }
 
 
+  void ChronoBasis::clear()
+  {
+    for (auto vi : v) delete vi;
+    v.clear();
+    R.clear();
+  }
+
+  void ChronoBasis::push(const ColorSpinorField &x, int max_dim, QudaPrecision precision)
+  {
+    if (max_dim < 1) errorQuda("Invalid chronology length %d", max_dim);
+    while (size() >= max_dim) evict(0);
+
+    const int n = size();
+    ColorSpinorParam cs_param(x);
+    cs_param.create = QUDA_NULL_FIELD_CREATE;
+    cs_param.setPrecision(precision);
+    ColorSpinorField *w = ColorSpinorField::Create(cs_param);
+    *w = x;
+    const double x_norm = sqrt(blas::norm2(*w));
+
+    // classical Gram-Schmidt with one re-orthogonalization
+    std::vector<Complex> h(n, 0.0), dh(n);
+    if (n > 0) {
+      std::vector<ColorSpinorField *> W = {w};
+      for (int pass = 0; pass < 2; pass++) {
+        blas::cDotProduct(dh.data(), v, W);
+        for (int i = 0; i < n; i++) {
+          h[i] += dh[i];
+          dh[i] = -dh[i];
+        }
+        blas::caxpy(dh.data(), v, W);
+      }
+    }
+
+    // a solution whose new component is at the rounding level of the
+    // storage precision is numerically dependent on the chronology
+    double eps = 0.0;
+    switch (precision) {
+    case QUDA_DOUBLE_PRECISION: eps = std::numeric_limits<double>::epsilon() / 2.; break;
+    case QUDA_SINGLE_PRECISION: eps = std::numeric_limits<float>::epsilon() / 2.; break;
+    case QUDA_HALF_PRECISION: eps = pow(2., -13); break;
+    case QUDA_QUARTER_PRECISION: eps = pow(2., -6); break;
+    default: errorQuda("Invalid precision %d", precision);
+    }
+
+    double rho = sqrt(blas::norm2(*w));
+    if (rho <= sqrt(eps) * x_norm) {
+      warningQuda("Solution is linearly dependent on the chronology (relative norm %e), not added",
+                  x_norm > 0.0 ? rho / x_norm : 0.0);
+      delete w;
+      return;
+    }
+    blas::ax(1.0 / rho, *w);
+
+    // grow the triangular factor by the new column (h, rho)
+    std::vector<Complex> R_new((n + 1) * (n + 1), 0.0);
+    for (int i = 0; i < n; i++) {
+      for (int j = i; j < n; j++) R_new[i * (n + 1) + j] = R[i * n + j];
+      R_new[i * (n + 1) + n] = h[i];
+    }
+    R_new[n * (n + 1) + n] = rho;
+    R = std::move(R_new);
+    v.push_back(w);
+  }
+
+  void ChronoBasis::evict(int k)
+  {
+    const int n = size();
+    if (k < 0 || k >= n) errorQuda("Invalid chronology index %d (size %d)", k, n);
+
+    // remove column k of R, leaving it upper Hessenberg from column k on
+    std::vector<Complex> H(n * (n - 1));
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n - 1; j++) H[i * (n - 1) + j] = R[i * n + (j < k ? j : j + 1)];
+
+    // restore the triangular form with Givens rotations on rows (j, j+1),
+    // applying their adjoint to the basis vectors (j, j+1) such that V R is unchanged
+    ColorSpinorParam cs_param(*v[0]);
+    cs_param.create = QUDA_NULL_FIELD_CREATE;
+    ColorSpinorField *tmp = k < n - 1 ? ColorSpinorField::Create(cs_param) : nullptr;
+    for (int j = k; j < n - 1; j++) {
+      Complex a = H[j * (n - 1) + j];
+      Complex b = H[(j + 1) * (n - 1) + j];
+      double r = sqrt(norm(a) + norm(b));
+      if (r == 0.0) continue;
+      double c = abs(a) / r;
+      Complex s = abs(a) > 0.0 ? (a / abs(a)) * conj(b) / r : Complex(1.0, 0.0);
+
+      for (int l = j; l < n - 1; l++) {
+        Complex h0 = H[j * (n - 1) + l];
+        Complex h1 = H[(j + 1) * (n - 1) + l];
+        H[j * (n - 1) + l] = c * h0 + s * h1;
+        H[(j + 1) * (n - 1) + l] = -conj(s) * h0 + c * h1;
+      }
+
+      blas::copy(*tmp, *v[j]);
+      blas::caxpby(conj(s), *v[j + 1], c, *v[j]);
+      blas::caxpby(-s, *tmp, c, *v[j + 1]);
+    }
+    if (tmp) delete tmp;
+
+    // the last row of H is now zero, so the last basis vector drops out
+    delete v[n - 1];
+    v.pop_back();
+    R.resize((n - 1) * (n - 1));
+    for (int i = 0; i < n - 1; i++)
+      for (int j = 0; j < n - 1; j++) R[i * (n - 1) + j] = H[i * (n - 1) + j];
+  }
 
 } // namespace quda
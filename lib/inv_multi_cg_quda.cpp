@@ -2,6 +2,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <limits>
+#include <algorithm>
 
 #include <quda_internal.h>
 #include <color_spinor_field.h>
@@ -580,4 +581,275 @@ namespace quda {
     return;
   }
 
+  MultiShiftCGRefine::MultiShiftCGRefine(const DiracMatrix &mat, const DiracMatrix &matSloppy, SolverParam &param,
+                                         TimeProfile &profile, int pool_size) :
+    MultiShiftSolver(mat, matSloppy, param, profile), pool_size(pool_size)
+  {
+    if (pool_size < 1) errorQuda("Invalid pool size %d", pool_size);
+  }
+
+  namespace
+  {
+    /**
+       State of the CG recurrence held by a slot of the refinement pool
+    */
+    struct RefineSlot {
+      int shift = -1; // index of the shift being refined, -1 if the slot is free
+      double r2 = 0.0;
+      double stop = 0.0;
+      double rNorm = 0.0;
+      double r0Norm = 0.0;
+      double maxrx = 0.0;
+      double maxrr = 0.0;
+      int iter = 0;
+      int res_increase = 0;
+      int res_increase_total = 0;
+    };
+  } // namespace
+
+  void MultiShiftCGRefine::operator()(std::vector<ColorSpinorField *> x, ColorSpinorField &b,
+                                      const std::vector<int> &shifts, const std::vector<ColorSpinorField *> &p_init,
+                                      const double *r2_old_array)
+  {
+    if (checkLocation(*(x[0]), b) != QUDA_CUDA_FIELD_LOCATION) errorQuda("Not supported");
+    if (shifts.size() == 0) return;
+
+    profile.TPSTART(QUDA_PROFILE_INIT);
+
+    const double b2 = blas::norm2(b);
+    if (b2 == 0) {
+      profile.TPSTOP(QUDA_PROFILE_INIT);
+      printfQuda("Warning: inverting on zero-field source\n");
+      for (auto i : shifts) {
+        *(x[i]) = b;
+        param.true_res_offset[i] = 0.0;
+        param.true_res_hq_offset[i] = 0.0;
+      }
+      return;
+    }
+
+    const bool mixed = param.precision_sloppy != param.precision;
+    const int n_slot = std::min(pool_size, static_cast<int>(shifts.size()));
+
+    ColorSpinorParam csParam(b);
+    csParam.create = QUDA_NULL_FIELD_CREATE;
+    cudaColorSpinorField r(b, csParam);
+    cudaColorSpinorField tmp(b, csParam);
+    // tmp2 only needed for multi-gpu Wilson-like kernels
+    cudaColorSpinorField *tmp2_p = !mat.isStaggered() ? new cudaColorSpinorField(b, csParam) : &tmp;
+
+    // the pool of sloppy fields
+    csParam.setPrecision(param.precision_sloppy);
+    std::vector<ColorSpinorField *> r_sloppy(n_slot), x_sloppy(mixed ? n_slot : 0), p(n_slot), Ap(n_slot);
+    for (int s = 0; s < n_slot; s++) {
+      r_sloppy[s] = new cudaColorSpinorField(b, csParam);
+      if (mixed) x_sloppy[s] = new cudaColorSpinorField(b, csParam);
+      p[s] = new cudaColorSpinorField(b, csParam);
+      Ap[s] = new cudaColorSpinorField(b, csParam);
+    }
+    cudaColorSpinorField *tmp_sloppy_p = mixed ? new cudaColorSpinorField(b, csParam) : &tmp;
+    cudaColorSpinorField *tmp2_sloppy_p = mixed && !mat.isStaggered() ? new cudaColorSpinorField(b, csParam) : tmp2_p;
+
+    profile.TPSTOP(QUDA_PROFILE_INIT);
+    profile.TPSTART(QUDA_PROFILE_PREAMBLE);
+
+    const double delta = param.delta;
+    const int maxResIncrease = param.max_res_increase;
+    const int maxResIncreaseTotal = param.max_res_increase_total;
+
+    std::vector<RefineSlot> slot(n_slot);
+    size_t next = 0; // next shift waiting for a slot
+
+    // recompute the true residual of the shift in slot s, folding in the sloppy correction
+    auto true_residual = [&](int s) -> double {
+      const int i = slot[s].shift;
+      if (mixed) {
+        blas::xpy(*x_sloppy[s], *x[i]);
+        blas::zero(*x_sloppy[s]);
+      }
+      mat(r, *x[i], tmp, *tmp2_p);
+      if (sigma(i, b) != 0.0) blas::axpy(sigma(i, b), *x[i], r);
+      double r2 = blas::xmyNorm(b, r);
+      blas::copy(*r_sloppy[s], r);
+      return r2;
+    };
+
+    // hand slot s over to the next shift waiting for refinement
+    auto load = [&](int s) {
+      slot[s] = RefineSlot();
+      if (next == shifts.size()) return;
+      const int i = shifts[next++];
+      slot[s].shift = i;
+      if (mixed) blas::zero(*x_sloppy[s]);
+      slot[s].r2 = true_residual(s);
+      slot[s].stop = Solver::stopping(param.tol_offset[i], b2, param.residual_type);
+      slot[s].rNorm = slot[s].r0Norm = slot[s].maxrx = slot[s].maxrr = sqrt(slot[s].r2);
+
+      // warm start from the search direction of the multi-shift solve
+      if (i < static_cast<int>(p_init.size()) && r2_old_array && r2_old_array[i] != 0.0) {
+        blas::copy(*p[s], *p_init[i]);
+        Complex rp = blas::cDotProduct(*r_sloppy[s], *p[s]) / slot[s].r2;
+        blas::caxpy(-rp, *r_sloppy[s], *p[s]);
+        blas::xpay(*r_sloppy[s], slot[s].r2 / r2_old_array[i], *p[s]);
+      } else {
+        blas::copy(*p[s], *r_sloppy[s]);
+      }
+
+      if (getVerbosity() >= QUDA_VERBOSE)
+        printfQuda("MultiShift CG refine: shift %d starting with |r|/|b| = %e\n", i, sqrt(slot[s].r2 / b2));
+    };
+
+    for (int s = 0; s < n_slot; s++) load(s);
+
+    int k = 0;
+    int rUpdate = 0;
+    blas::flops = 0;
+
+    profile.TPSTOP(QUDA_PROFILE_PREAMBLE);
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+
+    std::vector<ColorSpinorField *> P, AP;
+    std::vector<int> retired;
+    while (k < param.maxiter) {
+      P.clear();
+      AP.clear();
+      for (int s = 0; s < n_slot; s++) {
+        if (slot[s].shift < 0) continue;
+        P.push_back(p[s]);
+        AP.push_back(Ap[s]);
+      }
+      if (P.size() == 0) break;
+
+      // one application of the operator to all search directions
+      matSloppy(AP, P, *tmp_sloppy_p, *tmp2_sloppy_p);
+
+      for (int s = 0; s < n_slot; s++) {
+        RefineSlot &sl = slot[s];
+        if (sl.shift < 0) continue;
+        const int i = sl.shift;
+        ColorSpinorField &xs = mixed ? *x_sloppy[s] : *x[i];
+
+        double pAp = sigma(i, b) != 0.0 ? blas::axpyReDot(sigma(i, b), *p[s], *Ap[s]) : blas::reDotProduct(*p[s], *Ap[s]);
+        double alpha = sl.r2 / pAp;
+        double r2_old = sl.r2;
+
+        Complex cg_norm = blas::axpyCGNorm(-alpha, *Ap[s], *r_sloppy[s]);
+        sl.r2 = real(cg_norm);
+        double zn = imag(cg_norm);
+        sl.iter++;
+
+        if (std::isnan(sl.r2) || std::isinf(sl.r2))
+          errorQuda("MultiShift CG refine appears to have diverged on shift %d with residual %9.6e", i, sl.r2);
+
+        sl.rNorm = sqrt(sl.r2);
+        if (sl.rNorm > sl.maxrx) sl.maxrx = sl.rNorm;
+        if (sl.rNorm > sl.maxrr) sl.maxrr = sl.rNorm;
+        bool updateX = (sl.rNorm < delta * sl.r0Norm && sl.r0Norm <= sl.maxrx);
+        bool updateR = ((sl.rNorm < delta * sl.maxrr && sl.r0Norm <= sl.maxrr) || updateX);
+        bool converged = sl.r2 < sl.stop;
+
+        if (!(updateR || converged)) {
+          blas::axpyZpbx(alpha, *p[s], xs, *r_sloppy[s], zn / r2_old);
+          continue;
+        }
+
+        blas::axpy(alpha, *p[s], xs);
+        sl.r2 = true_residual(s);
+        rUpdate++;
+
+        if (sl.r2 < sl.stop) {
+          if (getVerbosity() >= QUDA_VERBOSE)
+            printfQuda("MultiShift CG refine: shift %d converged after %d iterations\n", i, sl.iter);
+          sl.shift = -1;
+          retired.push_back(s);
+          continue;
+        }
+
+        // break-out check if we have reached the limit of the precision
+        if (sqrt(sl.r2) > sl.r0Norm) {
+          sl.res_increase++;
+          sl.res_increase_total++;
+          warningQuda("MultiShift CG refine: shift %d, updated residual %e is greater than previous residual %e (total #inc %i)",
+                      i, sqrt(sl.r2), sl.r0Norm, sl.res_increase_total);
+          if (sl.res_increase > maxResIncrease || sl.res_increase_total > maxResIncreaseTotal) {
+            warningQuda("MultiShift CG refine: shift %d exiting due to too many true residual norm increases", i);
+            sl.shift = -1;
+            retired.push_back(s);
+            continue;
+          }
+        } else {
+          sl.res_increase = 0;
+        }
+
+        // explicitly restore the orthogonality of the gradient vector
+        Complex rp = blas::cDotProduct(*r_sloppy[s], *p[s]) / sl.r2;
+        blas::caxpy(-rp, *r_sloppy[s], *p[s]);
+        blas::xpay(*r_sloppy[s], sl.r2 / r2_old, *p[s]);
+
+        sl.rNorm = sl.r0Norm = sl.maxrx = sl.maxrr = sqrt(sl.r2);
+      }
+
+      k++;
+
+      // hand the slots of the retired shifts over to the shifts still waiting
+      for (auto s : retired) load(s);
+      retired.clear();
+
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE) {
+        for (int s = 0; s < n_slot; s++)
+          if (slot[s].shift >= 0)
+            printfQuda("MultiShift CG refine: %d iterations, shift %d <r,r> = %e, |r|/|b| = %e\n", k, slot[s].shift,
+                       slot[s].r2, sqrt(slot[s].r2 / b2));
+      }
+    }
+
+    if (k == param.maxiter) {
+      warningQuda("Exceeded maximum iterations %d\n", param.maxiter);
+      // fold in the outstanding corrections of the unconverged shifts
+      for (int s = 0; s < n_slot; s++)
+        if (slot[s].shift >= 0 && mixed) blas::xpy(*x_sloppy[s], *x[slot[s].shift]);
+    }
+
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    profile.TPSTART(QUDA_PROFILE_EPILOGUE);
+
+    param.secs = profile.Last(QUDA_PROFILE_COMPUTE);
+    double gflops = (blas::flops + mat.flops() + matSloppy.flops()) * 1e-9;
+    param.gflops = gflops;
+    param.iter += k;
+
+    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("MultiShift CG refine: Reliable updates = %d\n", rUpdate);
+
+    for (auto i : shifts) {
+      mat(r, *x[i], tmp, *tmp2_p);
+      if (sigma(i, b) != 0.0) blas::axpy(sigma(i, b), *x[i], r);
+      double true_res = blas::xmyNorm(b, r);
+      param.true_res_offset[i] = sqrt(true_res / b2);
+      param.iter_res_offset[i] = param.true_res_offset[i];
+      param.true_res_hq_offset[i] = sqrt(blas::HeavyQuarkResidualNorm(*x[i], r).z);
+      if (getVerbosity() >= QUDA_SUMMARIZE)
+        printfQuda("MultiShift CG refine: shift=%d, relative residual: true = %e\n", i, param.true_res_offset[i]);
+    }
+
+    // reset the flops counters
+    blas::flops = 0;
+    mat.flops();
+    matSloppy.flops();
+
+    profile.TPSTOP(QUDA_PROFILE_EPILOGUE);
+    profile.TPSTART(QUDA_PROFILE_FREE);
+
+    for (int s = 0; s < n_slot; s++) {
+      delete r_sloppy[s];
+      if (mixed) delete x_sloppy[s];
+      delete p[s];
+      delete Ap[s];
+    }
+    if (tmp2_sloppy_p != tmp2_p) delete tmp2_sloppy_p;
+    if (tmp_sloppy_p != &tmp) delete tmp_sloppy_p;
+    if (tmp2_p != &tmp) delete tmp2_p;
+
+    profile.TPSTOP(QUDA_PROFILE_FREE);
+  }
+
 } // namespace quda
@@ -9,9 +9,11 @@
 #include <unitarization_links.h>
 #include <ks_improved_force.h>
 #include <dslash_quda.h>
+#include <host_hash.h>
 
 #include <vector>
 #include <fstream>
+#include <algorithm>
 
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 
@@ -59,6 +61,15 @@ static bool create_quda_gauge = false;
 
 static bool have_resident_gauge = false;
 
+// fingerprint of the host links the resident fat/long links were loaded from (empty if not cached)
+static quda::HostCacheKey resident_links_key;
+
+// fingerprint of the inputs and outputs of the last link construction, which is only kept while
+// its output links are the ones loaded into QUDA (empty otherwise), and the host output links
+static quda::HostCacheKey created_links_key;
+static const void *created_fatlink = nullptr;
+static const void *created_longlink = nullptr;
+
 static bool invalidate_quda_mom = true;
 
 static bool invalidate_quda_mg = true;
@@ -238,9 +249,60 @@ static  void invalidateGaugeQuda() {
   freeGaugeQuda();
   invalidate_quda_gauge = true;
   have_resident_gauge = false;
+  resident_links_key.reset();
+  created_links_key.reset();
   qudamilc_called<false>(__func__);
 }
 
+/**
+   @brief Whether the content-based link cache is enabled.  This can
+   be disabled by setting QUDA_MILC_LINK_CACHE=0, in which case links
+   computed by MILC are reloaded, and freed, on every call.
+*/
+static bool linkCacheEnabled()
+{
+  static bool queried = false;
+  static bool enabled = true;
+  if (!queried) {
+    char *cache_env = getenv("QUDA_MILC_LINK_CACHE");
+    if (cache_env && strcmp(cache_env, "0") == 0) {
+      enabled = false;
+      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("QUDA_MILC_INTERFACE: Disabling link cache\n");
+    }
+    queried = true;
+  }
+  return enabled;
+}
+
+/**
+   @brief Compute a fingerprint of a set of MILC-ordered link arrays
+   (null entries are skipped) together with any parameters that
+   affect how they are used.
+   @param[in] links The link arrays
+   @param[in] prec The host precision of the link arrays
+   @param[in] param Parameters to include in the fingerprint
+   @return The fingerprint
+*/
+static uint64_t hashLinks(const std::vector<const void *> &links, QudaPrecision prec, const std::vector<double> &param)
+{
+  const size_t bytes = 4ul * localDim[0] * localDim[1] * localDim[2] * localDim[3] * 18 * prec;
+
+  uint64_t hash = hashHostArray(param.data(), param.size() * sizeof(double));
+  for (auto link : links) hash = hashMix(hash, link ? hashHostArray(link, bytes) : 0);
+  return hash;
+}
+
+/**
+   @brief Check whether a condition holds on all processes, such
+   that collective operations are skipped consistently
+*/
+static bool allProcesses(bool condition)
+{
+  int fail = condition ? 0 : 1;
+  comm_allreduce_int(&fail);
+  return fail == 0;
+}
+
 void qudaLoadKSLink(int prec, QudaFatLinkArgs_t, const double act_path_coeff[6], void *inlink, void *fatlink,
                     void *longlink)
 {
@@ -250,6 +312,19 @@ void qudaLoadKSLink(int prec, QudaFatLinkArgs_t, const double act_path_coeff[6],
       (prec==1) ? QUDA_SINGLE_PRECISION : QUDA_DOUBLE_PRECISION,
       QUDA_GENERAL_LINKS);
 
+  // if neither the input links nor the links we produced last time
+  // have changed, and the latter are still the ones loaded, then the
+  // resident links are still valid
+  std::vector<double> coeff(act_path_coeff, act_path_coeff + 6);
+  coeff.push_back(0.0); // distinguishes these links from unitarized ones
+  if (linkCacheEnabled() && !created_links_key.empty()
+      && created_links_key.hit(hashLinks({inlink, fatlink, longlink}, param.cpu_prec, coeff))) {
+    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("QUDA_MILC_INTERFACE: Links unchanged, skipping construction\n");
+    create_quda_gauge = true;
+    qudamilc_called<false>(__func__);
+    return;
+  }
+
   param.staggered_phase_applied = 1;
   param.staggered_phase_type = QUDA_STAGGERED_PHASE_MILC;
 
@@ -257,6 +332,11 @@ void qudaLoadKSLink(int prec, QudaFatLinkArgs_t, const double act_path_coeff[6],
 
   // requires loadGaugeQuda to be called in subequent solver
   invalidateGaugeQuda();
+  if (linkCacheEnabled()) {
+    created_links_key.set(hashLinks({inlink, fatlink, longlink}, param.cpu_prec, coeff));
+    created_fatlink = fatlink;
+    created_longlink = longlink;
+  }
 
   // this flags that we are using QUDA to create the HISQ links
   create_quda_gauge = true;
@@ -272,10 +352,25 @@ void qudaLoadUnitarizedLink(int prec, QudaFatLinkArgs_t, const double act_path_c
 					   (prec==1) ? QUDA_SINGLE_PRECISION : QUDA_DOUBLE_PRECISION,
 					   QUDA_GENERAL_LINKS);
 
+  std::vector<double> coeff(act_path_coeff, act_path_coeff + 6);
+  coeff.push_back(1.0); // distinguishes these links from the fat and long links
+  if (linkCacheEnabled() && !created_links_key.empty()
+      && created_links_key.hit(hashLinks({inlink, fatlink, ulink}, param.cpu_prec, coeff))) {
+    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("QUDA_MILC_INTERFACE: Links unchanged, skipping construction\n");
+    create_quda_gauge = true;
+    qudamilc_called<false>(__func__);
+    return;
+  }
+
   computeKSLinkQuda(fatlink, nullptr, ulink, inlink, const_cast<double*>(act_path_coeff), &param);
 
   // requires loadGaugeQuda to be called in subequent solver
   invalidateGaugeQuda();
+  if (linkCacheEnabled()) {
+    created_links_key.set(hashLinks({inlink, fatlink, ulink}, param.cpu_prec, coeff));
+    created_fatlink = fatlink;
+    created_longlink = nullptr; // the unitarized links are not loaded as long links
+  }
 
   // this flags that we are using QUDA to create the HISQ links
   create_quda_gauge = true;
@@ -827,6 +922,65 @@ static void setGaugeParams(QudaGaugeParam &fat_param, QudaGaugeParam &long_param
 
 }
 
+/**
+   @brief Load the fat and long links into QUDA, unless the resident
+   links are still valid.  Links that QUDA created itself remain valid
+   until they are invalidated; links computed by MILC are fingerprinted
+   and are only reloaded if their content, or the parameters they are
+   loaded with, have changed since they were last loaded.  Links used
+   for naive staggered fermions share the resident gauge field with
+   the HMC routines, so these are not cached.
+   @param[in] fatlink The host fat links
+   @param[in] longlink The host long links (nullptr for naive staggered)
+   @param[in] fat_param The fat-link parameters
+   @param[in] long_param The long-link parameters
+   @param[in] force Whether to force a reload
+   @return Whether the links were loaded
+*/
+static bool loadFatLongLinks(const void *fatlink, const void *longlink, QudaGaugeParam &fat_param,
+                             QudaGaugeParam &long_param, bool force = false)
+{
+  const bool cached = !create_quda_gauge && longlink != nullptr && linkCacheEnabled();
+  uint64_t hash = 0;
+  if (cached) {
+    std::vector<double> param
+      = {static_cast<double>(fat_param.cuda_prec),
+         static_cast<double>(fat_param.cuda_prec_sloppy),
+         static_cast<double>(fat_param.cuda_prec_precondition),
+         static_cast<double>(fat_param.cuda_prec_refinement_sloppy),
+         static_cast<double>(fat_param.cuda_prec_eigensolver),
+         static_cast<double>(long_param.reconstruct),
+         static_cast<double>(long_param.reconstruct_sloppy),
+         static_cast<double>(long_param.reconstruct_precondition),
+         static_cast<double>(long_param.reconstruct_refinement_sloppy),
+         static_cast<double>(long_param.reconstruct_eigensolver),
+         long_param.tadpole_coeff,
+         long_param.scale};
+    hash = hashLinks({fatlink, longlink}, fat_param.cpu_prec, param);
+  }
+
+  // links created by QUDA stay valid until invalidated, uncached links are always reloaded
+  const bool valid = !force && !invalidate_quda_gauge;
+  const bool reuse = cached ? resident_links_key.hit(hash, valid) : create_quda_gauge && allProcesses(valid);
+  if (!reuse) {
+    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
+    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
+    invalidate_quda_gauge = false;
+    if (cached)
+      resident_links_key.set(hash);
+    else
+      resident_links_key.reset();
+    // the loaded links are only those of the last construction if loaded from its output
+    if (!create_quda_gauge || fatlink != created_fatlink || (created_longlink && longlink != created_longlink))
+      created_links_key.reset();
+    return true;
+  }
+
+  if (getVerbosity() >= QUDA_VERBOSE && !create_quda_gauge)
+    printfQuda("QUDA_MILC_INTERFACE: Links unchanged, reusing resident links\n");
+  return false;
+}
+
 static void setColorSpinorParams(const int dim[4], QudaPrecision precision, ColorSpinorParam *param)
 {
   param->nColor = 3;
@@ -952,11 +1106,7 @@ void qudaMultishiftInvert(int external_precision, int quda_precision, int num_of
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
   // set the solver
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadFatLongLinks(fatlink, longlink, fat_param, long_param);
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -976,7 +1126,7 @@ void qudaMultishiftInvert(int external_precision, int quda_precision, int num_of
     final_fermilab_residual[i] = invertParam.true_res_hq_offset[i];
   } // end loop over number of offsets
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  if (!create_quda_gauge && resident_links_key.empty()) invalidateGaugeQuda();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaMultiShiftInvert
@@ -1039,11 +1189,7 @@ void qudaInvert(int external_precision, int quda_precision, double mass, QudaInv
   // dirty hack to invalidate the cached gauge field without breaking interface compatability
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadFatLongLinks(fatlink, longlink, fat_param, long_param);
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -1056,7 +1202,7 @@ void qudaInvert(int external_precision, int quda_precision, double mass, QudaInv
   *final_residual = invertParam.true_res;
   *final_fermilab_residual = invertParam.true_res_hq;
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  if (!create_quda_gauge && resident_links_key.empty()) invalidateGaugeQuda();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaInvert
@@ -1092,11 +1238,7 @@ void qudaDslash(int external_precision, int quda_precision, QudaInvertArgs_t inv
   // dirty hack to invalidate the cached gauge field without breaking interface compatability
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadFatLongLinks(fatlink, longlink, fat_param, long_param);
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -1107,7 +1249,7 @@ void qudaDslash(int external_precision, int quda_precision, QudaInvertArgs_t inv
 	     static_cast<char*>(src) + src_offset*host_precision,
 	     &invertParam, local_parity);
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  if (!create_quda_gauge && resident_links_key.empty()) invalidateGaugeQuda();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaDslash
@@ -1154,11 +1296,7 @@ void qudaInvertMsrc(int external_precision, int quda_precision, double mass, Qud
   // dirty hack to invalidate the cached gauge field without breaking interface compatability
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadFatLongLinks(fatlink, longlink, fat_param, long_param);
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -1179,7 +1317,7 @@ void qudaInvertMsrc(int external_precision, int quda_precision, double mass, Qud
   *final_residual = invertParam.true_res;
   *final_fermilab_residual = invertParam.true_res_hq;
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  if (!create_quda_gauge && resident_links_key.empty()) invalidateGaugeQuda();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaInvert
@@ -1251,11 +1389,7 @@ void qudaEigCGInvert(int external_precision, int quda_precision, double mass, Qu
   // dirty hack to invalidate the cached gauge field without breaking interface compatability
   if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
 
-  if ((invalidate_quda_gauge || !create_quda_gauge) && (rhs_idx == 0)) { // do this for the first RHS
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  if (rhs_idx == 0) loadFatLongLinks(fatlink, longlink, fat_param, long_param); // do this for the first RHS
 
   if (longlink == nullptr) invertParam.dslash_type = QUDA_STAGGERED_DSLASH;
 
@@ -1274,7 +1408,7 @@ void qudaEigCGInvert(int external_precision, int quda_precision, double mass, Qu
   *final_residual = invertParam.true_res;
   *final_fermilab_residual = invertParam.true_res_hq;
 
-  if (!create_quda_gauge && last_rhs_flag) invalidateGaugeQuda();
+  if (!create_quda_gauge && resident_links_key.empty() && last_rhs_flag) invalidateGaugeQuda();
 
   qudamilc_called<false>(__func__, verbosity);
 } // qudaEigCGInvert
@@ -2112,18 +2246,14 @@ void *qudaMultigridCreate(int external_precision, int quda_precision, double mas
   // if (*num_iters == -1 || !canReuseResidentGauge(&invertParam)) invalidateGaugeQuda();
   invalidateGaugeQuda();
 
-  if (invalidate_quda_gauge || !create_quda_gauge) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-  }
+  loadFatLongLinks(fatlink, longlink, fat_param, long_param);
 
   mg_pack->mg_preconditioner = newMultigridQuda(&mg_pack->mg_param);
   mg_pack->last_mass = mass;
 
   invalidate_quda_mg = false;
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  if (!create_quda_gauge && resident_links_key.empty()) invalidateGaugeQuda();
 
   qudamilc_called<false>(__func__, verbosity);
 
@@ -2202,11 +2332,8 @@ void qudaInvertMG(int external_precision, int quda_precision, double mass, QudaI
     invalidate_quda_mg = true;
   }
 
-  if (invalidate_quda_gauge || !create_quda_gauge || invalidate_quda_mg) {
-    loadGaugeQuda(const_cast<void *>(fatlink), &fat_param);
-    if (longlink != nullptr) loadGaugeQuda(const_cast<void *>(longlink), &long_param);
-    invalidate_quda_gauge = false;
-
+  // only update the multigrid solver if the links or mass have changed
+  if (loadFatLongLinks(fatlink, longlink, fat_param, long_param, invalidate_quda_mg)) {
     // FIXME: hack to reset gaugeFatPrecise (see interface_quda.cpp), etc.
     // Solution is to have a version of this that _only_
     // rebuilds the Dirac matrices, I believe.
@@ -2246,7 +2373,7 @@ void qudaInvertMG(int external_precision, int quda_precision, double mass, QudaI
   *final_residual = invertParam.true_res;
   *final_fermilab_residual = invertParam.true_res_hq;
 
-  if (!create_quda_gauge) invalidateGaugeQuda();
+  if (!create_quda_gauge && resident_links_key.empty()) invalidateGaugeQuda();
 
   qudamilc_called<false>(__func__, verbosity);
 }
@@ -2427,6 +2554,7 @@ void qudaLoadGaugeField(int external_precision,
   setGaugeParams(qudaGaugeParam, localDim, inv_args, external_precision, quda_precision);
 
   loadGaugeQuda(const_cast<void *>(milc_link), &qudaGaugeParam);
+  created_links_key.reset();
   qudamilc_called<false>(__func__);
 } // qudaLoadGaugeField
 
@@ -2434,6 +2562,8 @@ void qudaLoadGaugeField(int external_precision,
 void qudaFreeGaugeField() {
     qudamilc_called<true>(__func__);
   freeGaugeQuda();
+  resident_links_key.reset();
+  created_links_key.reset();
     qudamilc_called<false>(__func__);
 } // qudaFreeGaugeField
 
@@ -1,9 +1,16 @@
 #include <cstring>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include <multigrid.h>
 #include <tune_quda.h>
+#include <reducer.h>
 #include <random_quda.h>
 #include <vector_io.h>
+#include <checkpoint_io.h>
+#include <split_grid.h>
+#include <eigen_helper.h>
 
 // for building the KD inverse op
 #include <staggered_kd_build_xinv.h>
@@ -15,6 +22,149 @@ namespace quda
 
   static bool debug = false;
 
+  /**
+     @brief Return the checkpoint filename of a given component of a
+     given level of the multigrid hierarchy
+   */
+  static std::string hierarchyFilename(const char *prefix, int level, const char *component)
+  {
+    return std::string(prefix) + "_level_" + std::to_string(level) + "_" + component;
+  }
+
+  /**
+     @brief Whether the coarse operator below a given level is
+     checkpointed.  The optimized KD operator is cheap to construct
+     and so is always rebuilt.
+   */
+  static bool hierarchyHasCoarseOp(const QudaMultigridParam &mg_param, int level)
+  {
+    return !(level == 0 && mg_param.transfer_type[level] == QUDA_TRANSFER_OPTIMIZED_KD);
+  }
+
+  AgglomeratedSolver::AgglomeratedSolver(const DiracMatrix &mat_coarse, const DiracCoarse &dirac_coarse,
+                                         const ColorSpinorField &meta, const CommKey &split_key, SolverParam &param,
+                                         TimeProfile &profile, const char *prefix) :
+    Solver(mat_coarse, mat_coarse, mat_coarse, mat_coarse, param, profile),
+    split_key(split_key),
+    parent_key(get_current_comm_key()),
+    b_agglomerate(nullptr),
+    x_agglomerate(nullptr),
+    tmp1(nullptr),
+    tmp2(nullptr),
+    dirac(nullptr),
+    mat_agglomerate(nullptr),
+    solver(nullptr)
+  {
+    const bool preconditioned = dirac_coarse.getDiracType() == QUDA_COARSEPC_DIRAC;
+
+    // the vectors are allocated with the agglomerated communicator active such that their ghost zones match
+    ColorSpinorParam csParam(meta);
+    for (int d = 0; d < CommKey::n_dim; d++) csParam.x[d] *= split_key[d];
+    csParam.create = QUDA_NULL_FIELD_CREATE;
+    push_communicator(parent_key * split_key);
+    b_agglomerate = ColorSpinorField::Create(csParam);
+    x_agglomerate = ColorSpinorField::Create(csParam);
+    csParam.create = QUDA_ZERO_FIELD_CREATE;
+    tmp1 = ColorSpinorField::Create(csParam);
+    tmp2 = ColorSpinorField::Create(csParam);
+    push_communicator(parent_key);
+
+    DiracParam diracParam;
+    diracParam.type = dirac_coarse.getDiracType();
+    diracParam.kappa = dirac_coarse.Kappa();
+    diracParam.mass = dirac_coarse.Mass();
+    diracParam.mu = dirac_coarse.Mu();
+    diracParam.mu_factor = dirac_coarse.MuFactor();
+    diracParam.dagger = QUDA_DAG_NO;
+    diracParam.matpcType = dirac_coarse.getMatPCType();
+    diracParam.halo_precision = dirac_coarse.HaloPrecision();
+    diracParam.tmp1 = preconditioned ? &(tmp1->Even()) : tmp1;
+    diracParam.tmp2 = preconditioned ? &(tmp2->Even()) : tmp2;
+
+    if (preconditioned)
+      dirac = new DiracCoarsePC(dirac_coarse, diracParam, split_key, meta.Location());
+    else
+      dirac = new DiracCoarse(dirac_coarse, diracParam, split_key, meta.Location());
+    mat_agglomerate = new DiracM(*dirac);
+
+    Solver *inner
+      = Solver::create(param, *mat_agglomerate, *mat_agglomerate, *mat_agglomerate, *mat_agglomerate, profile);
+    solver = new PreconditionedSolver(*inner, *dirac, param, profile, prefix);
+
+    if (getVerbosity() >= QUDA_SUMMARIZE) {
+      printfQuda("Agglomerating coarse solve onto %d sub-partitions (%d x %d x %d x %d), local volume %lu -> %lu\n",
+                 product(split_key), split_key[0], split_key[1], split_key[2], split_key[3], meta.Volume(),
+                 meta.Volume() * product(split_key));
+    }
+  }
+
+  AgglomeratedSolver::~AgglomeratedSolver()
+  {
+    delete solver;
+    delete mat_agglomerate;
+    delete dirac;
+    delete tmp2;
+    delete tmp1;
+    delete x_agglomerate;
+    delete b_agglomerate;
+  }
+
+  void AgglomeratedSolver::operator()(ColorSpinorField &x, ColorSpinorField &b)
+  {
+    std::vector<ColorSpinorField *> v_b(1, &b);
+    split_field(*b_agglomerate, v_b, split_key);
+
+    push_communicator(parent_key * split_key);
+    (*solver)(*x_agglomerate, *b_agglomerate);
+    push_communicator(parent_key);
+
+    std::vector<ColorSpinorField *> v_x(1, &x);
+    join_field(v_x, *x_agglomerate, split_key);
+  }
+
+  AsyncCoarseSolve::AsyncCoarseSolve(Solver &solver, ColorSpinorField &x, ColorSpinorField &b, int n_thread) :
+    solver(solver), x(x), b(b), n_thread(n_thread), applied(false), reduce_buffers(reducer::create_buffers())
+  {
+  }
+
+  AsyncCoarseSolve::~AsyncCoarseSolve()
+  {
+    wait();
+    reducer::destroy_buffers(reduce_buffers);
+  }
+
+  void AsyncCoarseSolve::apply(const qudaStream_t)
+  {
+    solver(x, b);
+    applied = true;
+  }
+
+  void AsyncCoarseSolve::launch()
+  {
+    if (thread.joinable()) errorQuda("Coarse solve has already been launched");
+
+    // the output state is per thread, so the worker is explicitly given that of the launching thread
+    QudaVerbosity verbosity = getVerbosity();
+    std::string prefix(getOutputPrefix());
+
+    thread = std::thread([=]() {
+      device::init_thread();
+      setVerbosity(verbosity);
+      setOutputPrefix(prefix.c_str());
+      // reductions on this thread must not share buffers with those on the launching thread
+      reducer::set_thread_buffers(reduce_buffers);
+#ifdef _OPENMP
+      if (n_thread > 0) omp_set_num_threads(n_thread);
+#endif
+      apply();
+    });
+  }
+
+  void AsyncCoarseSolve::wait()
+  {
+    if (thread.joinable()) thread.join();
+  }
+
   MG::MG(MGParam &param, TimeProfile &profile_global) :
     Solver(*param.matResidual, *param.matSmooth, *param.matSmoothSloppy, *param.matSmoothSloppy, param, profile),
     param(param),
@@ -26,6 +176,7 @@ namespace quda
     profile("MG level " + std::to_string(param.level), false),
     coarse(nullptr),
     coarse_solver(nullptr),
+    coarse_async(nullptr),
     param_coarse(nullptr),
     param_presmooth(nullptr),
     param_postsmooth(nullptr),
@@ -46,7 +197,17 @@ namespace quda
     matCoarseResidual(nullptr),
     matCoarseSmoother(nullptr),
     matCoarseSmootherSloppy(nullptr),
-    rng(nullptr)
+    rng(nullptr),
+    smooth_events(param.location),
+    coarse_events(param.location),
+    adapt_reference(-1.0),
+    adapt_direction(1),
+    adapt_rejected(0),
+    adapt_improved(false),
+    nu_pre_accepted(param.nu_pre),
+    nu_post_accepted(param.nu_post),
+    nu_pre_max(2 * param.nu_pre),
+    nu_post_max(2 * param.nu_post)
   {
     sprintf(prefix, "MG level %d (%s): ", param.level, param.location == QUDA_CUDA_FIELD_LOCATION ? "GPU" : "CPU");
     pushLevel(param.level);
@@ -81,7 +242,14 @@ namespace quda
 
     rng = new RNG(*param.B[0], 1234);
 
-    if (param.transfer_type == QUDA_TRANSFER_AGGREGATE) {
+    if (param.restore_hierarchy) {
+      if (param.transfer_type == QUDA_TRANSFER_AGGREGATE && param.level < param.Nlevel - 1) {
+        if (getVerbosity() >= QUDA_SUMMARIZE)
+          printfQuda("Restoring level %d from %s\n", param.level, param.mg_global.hierarchy_infile);
+        CheckpointIO io(hierarchyFilename(param.mg_global.hierarchy_infile, param.level, "null"), false);
+        for (int i = 0; i < param.Nvec; i++) io.load(*param.B[i]);
+      }
+    } else if (param.transfer_type == QUDA_TRANSFER_AGGREGATE) {
       if (param.level < param.Nlevel - 1) {
         if (param.mg_global.compute_null_vector == QUDA_COMPUTE_NULL_VECTOR_YES) {
           if (param.mg_global.generate_all_levels == QUDA_BOOLEAN_TRUE || param.level == 0) {
@@ -117,10 +285,13 @@ namespace quda
     // in case of iterative setup with MG the coarse level may be already built
     if (!transfer) reset();
 
+    // any subsequent reset must recompute the hierarchy
+    param.restore_hierarchy = false;
+
     popLevel();
   }
 
-  void MG::reset(bool refresh) {
+  void MG::reset(bool refresh, double gauge_change) {
     pushLevel(param.level);
 
     if (getVerbosity() >= QUDA_VERBOSE) printfQuda("%s level %d\n", transfer ? "Resetting" : "Creating", param.level);
@@ -128,17 +299,34 @@ namespace quda
     destroySmoother();
     destroyCoarseSolver();
 
+    // the operator has changed so the K-cycle smoothing is retuned afresh
+    adapt_reference = -1.0;
+    adapt_rejected = 0;
+    adapt_improved = false;
+    cycle_work = CycleWork();
+    smooth_events.reset();
+    coarse_events.reset();
+
     // reset the Dirac operator pointers since these may have changed
     diracResidual = param.matResidual->Expose();
     diracSmoother = param.matSmooth->Expose();
     diracSmootherSloppy = param.matSmoothSloppy->Expose();
 
+    // for an incremental refresh the relaxation is proportional to the gauge-field change
+    const bool incremental = refresh && gauge_change >= 0.0;
+    int refresh_maxiter = param.mg_global.setup_maxiter_refresh[param.level];
+    if (incremental) {
+      double fraction = gauge_change / param.mg_global.incremental_refresh_gauge_change;
+      refresh_maxiter = std::min(refresh_maxiter, static_cast<int>(std::ceil(fraction * refresh_maxiter)));
+    }
+
     // Only refresh if we needed to generate near-nulls, that is,
     // if we aren't doing a staggered KD solve
-    if (param.level != 0 || param.transfer_type == QUDA_TRANSFER_AGGREGATE) {
+    const bool aggregate = param.level != 0 || param.transfer_type == QUDA_TRANSFER_AGGREGATE;
+    if (aggregate) {
       // Refresh the null-space vectors if we need to
       if (refresh && param.level < param.Nlevel - 1) {
-        if (param.mg_global.setup_maxiter_refresh[param.level]) generateNullVectors(param.B, refresh);
+        if (refresh_maxiter) generateNullVectors(param.B, refresh, refresh_maxiter);
       }
     }
 
@@ -148,7 +336,17 @@ namespace quda
       if (transfer) {
         // restoring FULL parity in Transfer changed at the end of this procedure
         transfer->setSiteSubset(QUDA_FULL_SITE_SUBSET, QUDA_INVALID_PARITY);
-        if (resetTransfer || refresh) {
+        bool update_transfer = resetTransfer || refresh;
+        if (incremental && !resetTransfer && aggregate) {
+          // only rebuild the transfer operator if it no longer captures the relaxed null space
+          double defect = refresh_maxiter ? transferDefect() : 0.0;
+          update_transfer = defect > param.mg_global.incremental_refresh_transfer_tol;
+          if (getVerbosity() >= QUDA_SUMMARIZE)
+            printfQuda("Incremental refresh: gauge change = %e, %d relaxation iterations, null-space defect = %e, %s "
+                       "transfer operator\n",
+                       gauge_change, refresh_maxiter, defect, update_transfer ? "rebuilding" : "keeping");
+        }
+        if (update_transfer) {
           transfer->reset();
           resetTransfer = false;
         }
@@ -157,7 +355,11 @@ namespace quda
         if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Creating transfer operator\n");
         transfer = new Transfer(param.B, param.Nvec, param.NblockOrtho, param.blockOrthoTwoPass, param.geoBlockSize,
                                 param.spinBlockSize, param.mg_global.precision_null[param.level],
-                                param.mg_global.transfer_type[param.level], profile);
+                                param.mg_global.transfer_type[param.level], profile, !param.restore_hierarchy);
+        if (param.restore_hierarchy) {
+          CheckpointIO io(hierarchyFilename(param.mg_global.hierarchy_infile, param.level, "transfer"), false);
+          transfer->load(io);
+        }
         for (int i=0; i<QUDA_MAX_MG_LEVEL; i++) param.mg_global.geo_block_size[param.level][i] = param.geoBlockSize[i];
 
         // create coarse temporary vector if not already created in verify()
@@ -190,7 +392,9 @@ namespace quda
           (*B_coarse)[i] = param.B[0]->CreateCoarse(param.geoBlockSize, param.spinBlockSize, param.Nvec, B_coarse_precision, param.mg_global.setup_location[param.level+1]);
 
         // if we're not generating on all levels then we need to propagate the vectors down
-        if ((param.level != 0 || param.Nlevel - 1) && param.mg_global.generate_all_levels == QUDA_BOOLEAN_FALSE) {
+        // (when restoring, each level loads its own null-space vectors)
+        if ((param.level != 0 || param.Nlevel - 1) && param.mg_global.generate_all_levels == QUDA_BOOLEAN_FALSE
+            && !param.restore_hierarchy) {
           if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Restricting null space vectors\n");
           for (int i=0; i<param.Nvec; i++) {
             zero(*(*B_coarse)[i]);
@@ -222,7 +426,7 @@ namespace quda
         coarse->param.matResidual = matCoarseResidual;
         coarse->param.matSmooth = matCoarseSmoother;
         coarse->param.matSmoothSloppy = matCoarseSmootherSloppy;
-        coarse->reset(refresh);
+        coarse->reset(refresh, gauge_change);
       } else {
         // create the next multigrid level
         param_coarse = new MGParam(param, *B_coarse, matCoarseResidual, matCoarseSmoother, matCoarseSmootherSloppy,
@@ -321,6 +525,14 @@ namespace quda
     param_presmooth->sloppy_converge = true; // this means we don't check the true residual before declaring convergence
 
     param_presmooth->schwarz_type = param.mg_global.smoother_schwarz_type[param.level];
+    param_presmooth->schwarz_block = param.mg_global.smoother_schwarz_block[param.level];
+    if (param_presmooth->schwarz_type == QUDA_BLOCK_JACOBI_SCHWARZ) {
+      if (param.level == 0 || param.mg_global.location[param.level] != QUDA_CPU_FIELD_LOCATION)
+        errorQuda("Block-Jacobi Schwarz smoothing requires a CPU-located coarse level");
+      if (param.smoother != QUDA_MR_INVERTER) errorQuda("Block-Jacobi Schwarz smoothing requires an MR smoother");
+      if (param.mg_global.smoother_solve_type[param.level] != QUDA_DIRECT_SOLVE)
+        errorQuda("Block-Jacobi Schwarz smoothing requires a direct smoother solve type");
+    }
     // inner solver should recompute the true residual after each cycle if using Schwarz preconditioning
     param_presmooth->compute_true_res = (param_presmooth->schwarz_type != QUDA_INVALID_SCHWARZ) ? true : false;
 
@@ -458,11 +670,17 @@ namespace quda
       diracParam.use_mma = param.use_mma;
 
       diracCoarseResidual = new DiracCoarse(diracParam, param.setup_location == QUDA_CUDA_FIELD_LOCATION ? true : false,
-                                            param.mg_global.setup_minimize_memory == QUDA_BOOLEAN_TRUE ? true : false);
+                                            param.mg_global.setup_minimize_memory == QUDA_BOOLEAN_TRUE ? true : false,
+                                            !param.restore_hierarchy);
+      if (param.restore_hierarchy) {
+        CheckpointIO io(hierarchyFilename(param.mg_global.hierarchy_infile, param.level, "coarse_op"), false);
+        static_cast<DiracCoarse *>(diracCoarseResidual)->load(io);
+      }
 
       // create smoothing operators
       diracParam.dirac = const_cast<Dirac *>(param.matSmooth->Expose());
       diracParam.halo_precision = param.mg_global.smoother_halo_precision[param.level + 1];
+      diracParam.block_float_precision = param.mg_global.block_float_precision[param.level + 1];
 
       if (param.mg_global.smoother_solve_type[param.level + 1] == QUDA_DIRECT_PC_SOLVE) {
         diracParam.type = QUDA_COARSEPC_DIRAC;
@@ -504,15 +722,23 @@ namespace quda
 
     if (param.cycle_type == QUDA_MG_CYCLE_VCYCLE && param.level < param.Nlevel-2) {
       // nothing to do
-    } else if (param.cycle_type == QUDA_MG_CYCLE_RECURSIVE || param.level == param.Nlevel-2) {
+    } else if (param.cycle_type == QUDA_MG_CYCLE_RECURSIVE || param.cycle_type == QUDA_MG_CYCLE_KCYCLE
+               || param.level == param.Nlevel - 2) {
+      if (coarse_async) {
+        delete coarse_async;
+        coarse_async = nullptr;
+      }
       if (coarse_solver) {
-        auto &coarse_solver_inner = reinterpret_cast<PreconditionedSolver *>(coarse_solver)->ExposeSolver();
-        // int defl_size = coarse_solver_inner.evecs.size();
-        int defl_size = coarse_solver_inner.deflationSpaceSize();
-        if (defl_size > 0 && transfer && param.mg_global.preserve_deflation) {
-          // Deflation space exists and we are going to create a new solver. Extract deflation space.
-          if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Extracting deflation space size %d to MG\n", defl_size);
-          coarse_solver_inner.extractDeflationSpace(evecs);
+        // an agglomerated coarse solver is never deflated
+        if (!dynamic_cast<AgglomeratedSolver *>(coarse_solver)) {
+          auto &coarse_solver_inner = reinterpret_cast<PreconditionedSolver *>(coarse_solver)->ExposeSolver();
+          // int defl_size = coarse_solver_inner.evecs.size();
+          int defl_size = coarse_solver_inner.deflationSpaceSize();
+          if (defl_size > 0 && transfer && param.mg_global.preserve_deflation) {
+            // Deflation space exists and we are going to create a new solver. Extract deflation space.
+            if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Extracting deflation space size %d to MG\n", defl_size);
+            coarse_solver_inner.extractDeflationSpace(evecs);
+          }
         }
         delete coarse_solver;
         coarse_solver = nullptr;
@@ -528,6 +754,34 @@ namespace quda
     popLevel();
   }
 
+  CommKey MG::agglomerationKey() const
+  {
+    CommKey split_key = {1, 1, 1, 1};
+
+    const int threshold = param.mg_global.coarse_solver_agglomerate_volume[param.level + 1];
+    if (threshold <= 0) return split_key;
+
+    if (param.level != param.Nlevel - 2 || coarse->presmoother || param.mg_global.use_eig_solver[param.Nlevel - 1]
+        || diracCoarseResidual->getDiracType() != QUDA_COARSE_DIRAC) {
+      warningQuda("Agglomeration is only supported for an undeflated, unpreconditioned coarsest-level solve");
+      return split_key;
+    }
+
+    const int local_volume = r_coarse->Volume();
+    while (local_volume * product(split_key) < threshold) {
+      // halve the number of processes in the dimension that has the most
+      int dim = -1;
+      for (int d = 0; d < CommKey::n_dim; d++) {
+        if ((comm_dim(d) / split_key[d]) % 2 != 0) continue;
+        if (dim < 0 || comm_dim(d) / split_key[d] > comm_dim(dim) / split_key[dim]) dim = d;
+      }
+      if (dim < 0) break;
+      split_key[dim] *= 2;
+    }
+
+    return split_key;
+  }
+
   void MG::createCoarseSolver() {
     pushLevel(param.level);
 
@@ -537,10 +791,15 @@ namespace quda
       // if coarse solver is not a bottom solver and on the second to bottom level then we can just use the coarse solver as is
       coarse_solver = coarse;
       if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Assigned coarse solver to coarse MG operator\n");
-    } else if (param.cycle_type == QUDA_MG_CYCLE_RECURSIVE || param.level == param.Nlevel-2) {
+    } else if (param.cycle_type == QUDA_MG_CYCLE_RECURSIVE || param.cycle_type == QUDA_MG_CYCLE_KCYCLE
+               || param.level == param.Nlevel - 2) {
 
       param_coarse_solver = new SolverParam(param);
       param_coarse_solver->inv_type = param.mg_global.coarse_solver[param.level + 1];
+      // the K-cycle preconditioner varies between iterations so the Krylov solve must be flexible
+      if (param.cycle_type == QUDA_MG_CYCLE_KCYCLE && param.level < param.Nlevel - 2
+          && param_coarse_solver->inv_type != QUDA_GCR_INVERTER && param_coarse_solver->inv_type != QUDA_FGMRESDR_INVERTER)
+        errorQuda("K-cycle requires a flexible coarse solver (GCR or FGMRES-DR), not %d", param_coarse_solver->inv_type);
       param_coarse_solver->is_preconditioner = false;
       param_coarse_solver->sloppy_converge = true; // this means we don't check the true residual before declaring convergence
 
@@ -619,7 +878,17 @@ namespace quda
       param_coarse_solver->precision_sloppy = param_coarse_solver->precision;
       param_coarse_solver->precision_precondition = param_coarse_solver->precision_sloppy;
 
-      if (param.mg_global.coarse_grid_solution_type[param.level + 1] == QUDA_MATPC_SOLUTION) {
+      CommKey split_key = agglomerationKey();
+
+      if (product(split_key) > 1) {
+        const bool preconditioned = param.mg_global.coarse_grid_solution_type[param.level + 1] == QUDA_MATPC_SOLUTION;
+        sprintf(coarse_prefix, "MG level %d (%s): ", param.level + 1,
+                param.mg_global.location[param.level + 1] == QUDA_CUDA_FIELD_LOCATION ? "GPU" : "CPU");
+        coarse_solver = new AgglomeratedSolver(
+          preconditioned ? *matCoarseSmoother : *matCoarseResidual,
+          static_cast<const DiracCoarse &>(preconditioned ? *diracCoarseSmoother : *diracCoarseResidual), *r_coarse,
+          split_key, *param_coarse_solver, profile, coarse_prefix);
+      } else if (param.mg_global.coarse_grid_solution_type[param.level + 1] == QUDA_MATPC_SOLUTION) {
         Solver *solver = Solver::create(*param_coarse_solver, *matCoarseSmoother, *matCoarseSmoother,
                                         *matCoarseSmoother, *matCoarseSmoother, profile);
         sprintf(coarse_prefix, "MG level %d (%s): ", param.level + 1,
@@ -661,6 +930,22 @@ namespace quda
         param_coarse_solver->maxiter = param.mg_global.coarse_solver_maxiter[param.level + 1];
       }
 
+      if (param.level == param.Nlevel - 2 && param.mg_global.coarse_solver_async[param.level + 1] == QUDA_BOOLEAN_TRUE) {
+        if (param.mg_global.location[param.level + 1] != QUDA_CPU_FIELD_LOCATION) {
+          warningQuda("Asynchronous coarse solve requires a CPU-located coarsest level");
+        } else if (product(split_key) > 1) {
+          warningQuda("Asynchronous coarse solve is not supported with agglomeration");
+        } else if (comm_size() > 1) {
+          // the coarse solve would communicate from a worker thread, concurrently with the post
+          // smoother, which also toggles the global reductions of the shared communicator
+          warningQuda("Asynchronous coarse solve is only supported on a single process");
+        } else {
+          coarse_async = new AsyncCoarseSolve(*coarse_solver, *x_coarse, *r_coarse,
+                                              param.mg_global.coarse_solver_async_threads[param.level + 1]);
+          if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Coarse solve will overlap with the post smoothing\n");
+        }
+      }
+
       if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Assigned coarse solver to preconditioned GCR solver\n");
     } else {
       errorQuda("Multigrid cycle type %d not supported", param.cycle_type);
@@ -676,7 +961,9 @@ namespace quda
 
     if (param.level < param.Nlevel - 1) {
       if (coarse) delete coarse;
-      if (param.level == param.Nlevel-1 || param.cycle_type == QUDA_MG_CYCLE_RECURSIVE) {
+      if (coarse_async) delete coarse_async;
+      if (param.level == param.Nlevel-1 || param.cycle_type == QUDA_MG_CYCLE_RECURSIVE
+          || param.cycle_type == QUDA_MG_CYCLE_KCYCLE) {
 	if (coarse_solver) delete coarse_solver;
 	if (param_coarse_solver) delete param_coarse_solver;
       }
@@ -965,10 +1252,86 @@ namespace quda
       if (getVerbosity() >= QUDA_VERBOSE) printfQuda("...skipping check due to long links\n"); // asqtad operator only
     }
 
+    // check the block-Jacobi smoother of the coarse level against MR with the full coarse operator,
+    // restricted to one block at a time by masking
+    if (param.mg_global.smoother_schwarz_type[param.level + 1] == QUDA_BLOCK_JACOBI_SCHWARZ) {
+      if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Checking 0 = (block-Jacobi MR - reference block MR)\n");
+
+      const int block = param.mg_global.smoother_schwarz_block[param.level + 1];
+      const int n_iter = std::max(param.mg_global.nu_pre[param.level + 1], 1);
+      const double omega = param.mg_global.omega[param.level + 1];
+      auto &dirac = *static_cast<DiracCoarse *>(diracCoarseResidual);
+
+      ColorSpinorParam csParam_block(*r_coarse);
+      csParam_block.create = QUDA_NULL_FIELD_CREATE;
+      std::unique_ptr<ColorSpinorField> r_block(ColorSpinorField::Create(csParam_block));
+      std::unique_ptr<ColorSpinorField> Ar_block(ColorSpinorField::Create(csParam_block));
+
+      spinorNoise(*tmp_coarse, *rng, QUDA_NOISE_UNIFORM);
+      dirac.BlockMR(*x_coarse, *tmp_coarse, block, n_iter, omega);
+
+      int n_block = 1;
+      for (int d = 0; d < 4; d++) n_block *= tmp_coarse->X(d) / block;
+
+      zero(*tmp2_coarse);
+      for (int b = 0; b < n_block; b++) {
+        *r_block = *tmp_coarse;
+        CoarseBlockMask(*r_block, block, b);
+        zero(*r_coarse);
+        for (int k = 0; k < n_iter; k++) {
+          dirac.M(*Ar_block, *r_block);
+          CoarseBlockMask(*Ar_block, block, b);
+          double Ar2 = norm2(*Ar_block);
+          if (Ar2 == 0.0) break;
+          Complex alpha = cDotProduct(*Ar_block, *r_block) / Ar2;
+          caxpy(alpha, *r_block, *r_coarse);
+          caxpy(-alpha, *Ar_block, *r_block);
+        }
+        axpy(omega, *r_coarse, *tmp2_coarse);
+      }
+
+      double x_nrm = norm2(*x_coarse);
+      deviation = sqrt(xmyNorm(*tmp2_coarse, *x_coarse) / norm2(*tmp2_coarse));
+      if (getVerbosity() >= QUDA_VERBOSE)
+        printfQuda("L2 norms: Reference = %e, Block-Jacobi = %e, relative deviation = %e\n", norm2(*tmp2_coarse), x_nrm,
+                   deviation);
+      if (deviation > tol) errorQuda("failed, deviation = %e (tol=%e)", deviation, tol);
+    }
+
+    // check the block floating point links of the coarse smoother against the original links
+    if (param.mg_global.block_float_precision[param.level + 1] != QUDA_INVALID_PRECISION
+        && param.mg_global.location[param.level + 1] == QUDA_CUDA_FIELD_LOCATION) {
+      if (getVerbosity() >= QUDA_SUMMARIZE)
+        printfQuda("Checking 0 = (block floating point coarse operator - coarse operator)\n");
+
+      auto &dirac = *static_cast<DiracCoarse *>(diracCoarseSmoother);
+      const bool pc = dirac.getDiracType() == QUDA_COARSEPC_DIRAC;
+      ColorSpinorField &in = pc ? x_coarse->Even() : *x_coarse;
+      ColorSpinorField &out = pc ? r_coarse->Even() : *r_coarse;
+      ColorSpinorField &ref = pc ? tmp2_coarse->Even() : *tmp2_coarse;
+
+      spinorNoise(*x_coarse, *rng, QUDA_NOISE_UNIFORM);
+      dirac.enableBlockFloat(false);
+      dirac.M(ref, in);
+      dirac.enableBlockFloat(true);
+      dirac.M(out, in);
+
+      double bf_tol = param.mg_global.block_float_precision[param.level + 1] == QUDA_QUARTER_PRECISION ? 5e-2 : 1e-3;
+      double out_nrm = norm2(out);
+      deviation = sqrt(xmyNorm(ref, out) / norm2(ref));
+      if (getVerbosity() >= QUDA_VERBOSE)
+        printfQuda("L2 norms: Original = %e, Block floating point = %e, relative deviation = %e\n", norm2(ref),
+                   out_nrm, deviation);
+      if (deviation > bf_tol) errorQuda("failed, deviation = %e (tol=%e)", deviation, bf_tol);
+    }
+
     // check the preconditioned operator construction on the lower level if applicable
     bool coarse_was_preconditioned = (param.mg_global.coarse_grid_solution_type[param.level + 1] == QUDA_MATPC_SOLUTION
                                       && param.mg_global.smoother_solve_type[param.level + 1] == QUDA_DIRECT_PC_SOLVE);
     if (coarse_was_preconditioned) {
+      // compare with the original links, since the block floating point copies are checked above
+      static_cast<DiracCoarse *>(diracCoarseSmoother)->enableBlockFloat(false);
+
       // check eo
       if (getVerbosity() >= QUDA_SUMMARIZE)
         printfQuda("Checking Deo of preconditioned operator 0 = \\hat{D}_c - A^{-1} D_c\n");
@@ -994,6 +1357,8 @@ namespace quda
         printfQuda("L2 norms: Emulated = %e, Native = %e, relative deviation = %e\n", norm2(x_coarse->Odd()), r_nrm,
                    deviation);
       if (deviation > tol) errorQuda("failed, deviation = %e (tol=%e)", deviation, tol);
+
+      static_cast<DiracCoarse *>(diracCoarseSmoother)->enableBlockFloat(true);
     }
 
     // here we check that the Hermitian conjugate operator is working
@@ -1138,7 +1503,10 @@ namespace quda
       if (param.smoother_solve_type == QUDA_DIRECT_PC_SOLVE) *b_tilde = *in;
       else b_tilde = &b;
 
+      const bool kcycle = param.cycle_type == QUDA_MG_CYCLE_KCYCLE;
+      if (kcycle) smooth_events.start();
       if (presmoother) (*presmoother)(*out, *in); else zero(*out);
+      if (kcycle) smooth_events.stop();
 
       ColorSpinorField &solution = inner_solution_type == outer_solution_type ? x : x.Even();
       diracSmoother->reconstruct(solution, b, inner_solution_type);
@@ -1151,6 +1519,14 @@ namespace quda
         true :
         false;
 
+      // when the transfer can act on the fine fields in place, form the residual
+      // inside the restrictor, and add the coarse-grid correction inside the prolongator
+      // (b and x are at the preconditioner precision and r at the sloppy precision, so
+      // otherwise we fall back to the mixed-precision blas)
+      const bool fuse_restrict = !debug && !use_solver_residual && transfer && transfer->fusable(b, *r_coarse)
+        && transfer->fusable(residual, *r_coarse);
+      const bool fuse_prolong = !debug && transfer && transfer->fusable(solution, *x_coarse);
+
       // FIXME this is currently borked if inner solver is preconditioned
       double r2 = 0.0;
       if (use_solver_residual) {
@@ -1159,29 +1535,56 @@ namespace quda
         (*param.matResidual)(*r, x);
         if (debug)
           r2 = xmyNorm(b, *r);
-        else
+        else if (!fuse_restrict)
           axpby(1.0, b, -1.0, *r);
       }
 
       // We need this to ensure that the coarse level has been created.
       // e.g. in case of iterative setup with MG we use just pre- and post-smoothing at the first iteration.
+      // if the coarse solve is asynchronous, the coarse-grid correction is additive: the coarse
+      // solve runs concurrently with the post smoothing and the correction is added afterwards
+      const bool overlap = transfer && coarse_async && coarse_async->ready();
+
       if (transfer) {
+        const int coarse_iter = param_coarse_solver ? param_coarse_solver->iter : 0;
+        if (kcycle) coarse_events.start();
 
-        // restrict to the coarse grid
-        transfer->R(*r_coarse, residual);
+        // restrict to the coarse grid, r_coarse = R (b - A x) if fused
+        if (fuse_restrict)
+          transfer->R(*r_coarse, b, &residual);
+        else
+          transfer->R(*r_coarse, residual);
         if ( debug ) printfQuda("after pre-smoothing x2 = %e, r2 = %e, r_coarse2 = %e\n", norm2(x), r2, norm2(*r_coarse));
 
-        // recurse to the next lower level
-        (*coarse_solver)(*x_coarse, *r_coarse);
-        if (debug) printfQuda("after coarse solve x_coarse2 = %e r_coarse2 = %e\n", norm2(*x_coarse), norm2(*r_coarse));
-
-        // prolongate back to this grid
-        ColorSpinorField &x_coarse_2_fine = inner_solution_type == QUDA_MAT_SOLUTION ? *r : r->Even(); // define according to inner solution type
-        transfer->P(x_coarse_2_fine, *x_coarse); // repurpose residual storage
-        xpy(x_coarse_2_fine, solution); // sum to solution FIXME - sum should be done inside the transfer operator
-        if ( debug ) {
-          printfQuda("Prolongated coarse solution y2 = %e\n", norm2(*r));
-          printfQuda("after coarse-grid correction x2 = %e, r2 = %e\n", norm2(x), norm2(*r));
+        if (overlap) {
+          qudaDeviceSynchronize(); // ensure the restricted residual is complete before the worker reads it
+          coarse_async->launch();
+        } else {
+          // recurse to the next lower level
+          if (coarse_async)
+            coarse_async->apply();
+          else
+            (*coarse_solver)(*x_coarse, *r_coarse);
+          if (debug)
+            printfQuda("after coarse solve x_coarse2 = %e r_coarse2 = %e\n", norm2(*x_coarse), norm2(*r_coarse));
+
+          // prolongate back to this grid
+          if (fuse_prolong) {
+            transfer->P(solution, *x_coarse, true); // sum to solution inside the transfer operator
+          } else {
+            ColorSpinorField &x_coarse_2_fine = inner_solution_type == QUDA_MAT_SOLUTION ? *r : r->Even(); // define according to inner solution type
+            transfer->P(x_coarse_2_fine, *x_coarse); // repurpose residual storage
+            xpy(x_coarse_2_fine, solution); // sum to solution
+          }
+          if (debug) {
+            printfQuda("Prolongated coarse solution y2 = %e\n", norm2(*r));
+            printfQuda("after coarse-grid correction x2 = %e, r2 = %e\n", norm2(x), norm2(*r));
+          }
+        }
+
+        if (kcycle) {
+          coarse_events.stop();
+          if (param_coarse_solver && !overlap) cycle_work.coarse_iter += param_coarse_solver->iter - coarse_iter;
         }
       }
 
@@ -1199,7 +1602,26 @@ namespace quda
       // we should keep a copy of the prepared right hand side as we've already destroyed it
       //dirac.prepare(in, out, solution, residual, inner_solution_type);
 
+      if (kcycle) smooth_events.start();
       if (postsmoother) (*postsmoother)(*out, *in); // for inner solve preconditioned, in the should be the original prepared rhs
+      if (kcycle) {
+        smooth_events.stop();
+        cycle_work.cycles++;
+      }
+
+      if (overlap) {
+        coarse_async->wait();
+        if (debug) printfQuda("after coarse solve x_coarse2 = %e\n", norm2(*x_coarse));
+
+        // prolongate back to this grid and add the coarse-grid correction
+        if (fuse_prolong) {
+          transfer->P(solution, *x_coarse, true);
+        } else {
+          ColorSpinorField &x_coarse_2_fine = inner_solution_type == QUDA_MAT_SOLUTION ? *r : r->Even();
+          transfer->P(x_coarse_2_fine, *x_coarse);
+          xpy(x_coarse_2_fine, solution);
+        }
+      }
 
       if (debug) printfQuda("exited postsmooth, about to reconstruct\n");
 
@@ -1225,6 +1647,119 @@ namespace quda
     popOutputPrefix();
   }
 
+  MG::CycleEvents::~CycleEvents()
+  {
+    for (auto &e : events) {
+      qudaEventDestroy(e.first);
+      qudaEventDestroy(e.second);
+    }
+  }
+
+  void MG::CycleEvents::start()
+  {
+    if (running) errorQuda("Cannot start already running cycle events");
+    running = true;
+    if (host) {
+      host_timer.start();
+      return;
+    }
+    if (n_recorded == max_events) fold();
+    if (n_recorded == events.size()) events.push_back({qudaChronoEventCreate(), qudaChronoEventCreate()});
+    qudaEventRecord(events[n_recorded].first, device::get_default_stream());
+  }
+
+  void MG::CycleEvents::stop()
+  {
+    if (!running) errorQuda("Cannot stop unstarted cycle events");
+    running = false;
+    if (host) {
+      host_timer.stop();
+      return;
+    }
+    qudaEventRecord(events[n_recorded].second, device::get_default_stream());
+    n_recorded++;
+  }
+
+  void MG::CycleEvents::fold()
+  {
+    if (n_recorded > 0) {
+      // the events are recorded in order on one stream, so waiting for the last suffices
+      qudaEventSynchronize(events[n_recorded - 1].second);
+      for (size_t i = 0; i < n_recorded; i++) time += qudaEventElapsedTime(events[i].first, events[i].second);
+    }
+    n_recorded = 0;
+  }
+
+  double MG::CycleEvents::elapsed()
+  {
+    if (running) errorQuda("Cannot read running cycle events");
+    fold();
+    double elapsed = time + host_timer.time;
+    time = 0.0;
+    host_timer.time = 0.0;
+    return elapsed;
+  }
+
+  void MG::adaptCycle()
+  {
+    if (param.level == param.Nlevel - 1) return;
+    pushLevel(param.level);
+
+    // read back the timing of the cycles since the last adaptation
+    cycle_work.smooth_time = smooth_events.elapsed();
+    cycle_work.coarse_time = coarse_events.elapsed();
+
+    if (param.cycle_type == QUDA_MG_CYCLE_KCYCLE && cycle_work.cycles > 0) {
+      const double work = cycle_work.smooth_time + cycle_work.coarse_time;
+      if (getVerbosity() >= QUDA_SUMMARIZE)
+        printfQuda("K-cycle work: %d cycles, %.1f coarse iterations per cycle, smoothing %.3e s, coarse correction "
+                   "%.3e s (nu_pre = %d, nu_post = %d)\n",
+                   cycle_work.cycles, static_cast<double>(cycle_work.coarse_iter) / cycle_work.cycles,
+                   cycle_work.smooth_time, cycle_work.coarse_time, param.nu_pre, param.nu_post);
+
+      if (adapt_rejected < 2) {
+        if (adapt_reference < 0.0 || work < adapt_reference) {
+          // keep the current smoothing and carry on in the same direction
+          if (adapt_reference >= 0.0) adapt_improved = true;
+          adapt_reference = work;
+          nu_pre_accepted = param.nu_pre;
+          nu_post_accepted = param.nu_post;
+        } else {
+          // go back to the accepted smoothing: if we had been improving we are done, else try the other direction
+          adapt_rejected = adapt_improved ? 2 : adapt_rejected + 1;
+          adapt_direction = -adapt_direction;
+          adapt_improved = false;
+        }
+
+        // trial smoothing, varying only those smoothers that are applied
+        int nu_pre = nu_pre_accepted;
+        int nu_post = nu_post_accepted;
+        while (adapt_rejected < 2) {
+          if (nu_pre_accepted > 0) nu_pre = std::min(std::max(nu_pre_accepted + adapt_direction, 1), nu_pre_max);
+          if (nu_post_accepted > 0) nu_post = std::min(std::max(nu_post_accepted + adapt_direction, 1), nu_post_max);
+          if (nu_pre != nu_pre_accepted || nu_post != nu_post_accepted) break;
+          // we are at a limit in this direction
+          adapt_rejected = adapt_improved ? 2 : adapt_rejected + 1;
+          adapt_direction = -adapt_direction;
+          adapt_improved = false;
+        }
+
+        if (nu_pre != param.nu_pre || nu_post != param.nu_post) {
+          if (getVerbosity() >= QUDA_SUMMARIZE)
+            printfQuda("K-cycle smoothing changed to nu_pre = %d, nu_post = %d\n", nu_pre, nu_post);
+          param.nu_pre = param.mg_global.nu_pre[param.level] = nu_pre;
+          param.nu_post = param.mg_global.nu_post[param.level] = nu_post;
+          createSmoother();
+        }
+      }
+    }
+    cycle_work = CycleWork();
+
+    popLevel();
+
+    if (coarse) coarse->adaptCycle();
+  }
+
   // supports separate reading or single file read
   void MG::loadVectors(std::vector<ColorSpinorField *> &B)
   {
@@ -1280,7 +1815,60 @@ namespace quda
     if (param.level < param.Nlevel - 2) coarse->dumpNullVectors();
   }
 
-  void MG::generateNullVectors(std::vector<ColorSpinorField *> &B, bool refresh)
+  void MG::dumpHierarchy(uint64_t checksum) const
+  {
+    if (param.level >= param.Nlevel - 1) return;
+
+    bool is_running = profile_global.isRunning(QUDA_PROFILE_INIT);
+    if (is_running) profile_global.TPSTOP(QUDA_PROFILE_INIT);
+    profile_global.TPSTART(QUDA_PROFILE_IO);
+    pushLevel(param.level);
+
+    const char *prefix = param.mg_global.hierarchy_outfile;
+    if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Saving level %d to %s\n", param.level, prefix);
+
+    if (param.transfer_type == QUDA_TRANSFER_AGGREGATE) {
+      CheckpointIO io(hierarchyFilename(prefix, param.level, "null"), true, checksum);
+      for (int i = 0; i < param.Nvec; i++) io.save(*param.B[i]);
+    }
+
+    {
+      CheckpointIO io(hierarchyFilename(prefix, param.level, "transfer"), true, checksum);
+      transfer->save(io);
+    }
+
+    if (hierarchyHasCoarseOp(param.mg_global, param.level)) {
+      CheckpointIO io(hierarchyFilename(prefix, param.level, "coarse_op"), true, checksum);
+      static_cast<const DiracCoarse *>(diracCoarseResidual)->save(io);
+    }
+
+    popLevel();
+    profile_global.TPSTOP(QUDA_PROFILE_IO);
+    if (is_running) profile_global.TPSTART(QUDA_PROFILE_INIT);
+
+    if (param.level < param.Nlevel - 2) coarse->dumpHierarchy(checksum);
+  }
+
+  bool MG::checkHierarchy(const QudaMultigridParam &mg_param, uint64_t checksum)
+  {
+    const char *prefix = mg_param.hierarchy_infile;
+    bool valid = strcmp(prefix, "") != 0;
+
+    for (int l = 0; valid && l < mg_param.n_level - 1; l++) {
+      if (mg_param.transfer_type[l] == QUDA_TRANSFER_AGGREGATE)
+        valid = valid && CheckpointIO::valid(hierarchyFilename(prefix, l, "null"), checksum);
+      valid = valid && CheckpointIO::valid(hierarchyFilename(prefix, l, "transfer"), checksum);
+      if (hierarchyHasCoarseOp(mg_param, l))
+        valid = valid && CheckpointIO::valid(hierarchyFilename(prefix, l, "coarse_op"), checksum);
+    }
+
+    // only restore if every process is able to
+    int invalid = valid ? 0 : 1;
+    comm_allreduce_int(&invalid);
+    return invalid == 0;
+  }
+
+  void MG::generateNullVectors(std::vector<ColorSpinorField *> &B, bool refresh, int maxiter)
   {
     pushLevel(param.level);
 
@@ -1288,6 +1876,7 @@ namespace quda
     // set null-space generation options - need to expose these
     solverParam.maxiter
       = refresh ? param.mg_global.setup_maxiter_refresh[param.level] : param.mg_global.setup_maxiter[param.level];
+    if (maxiter > 0) solverParam.maxiter = maxiter;
     solverParam.tol = param.mg_global.setup_tol[param.level];
     solverParam.use_init_guess = QUDA_USE_INIT_GUESS_YES;
     solverParam.delta = 1e-1;
@@ -1339,7 +1928,14 @@ namespace quda
     QudaPrecision halo_precision = diracSmootherSloppy->HaloPrecision();
     if (halo_precision == QUDA_QUARTER_PRECISION) diracSmootherSloppy->setHaloPrecision(QUDA_HALF_PRECISION);
 
-    Solver *solve;
+    // the batched relaxation replaces the per-vector solves for null-vector setup, but not for the recursive MG setup
+    const int batch_size = std::min(param.mg_global.setup_batch_size[param.level], static_cast<int>(B.size()));
+    const bool batched = batch_size > 1 && solverParam.inv_type != QUDA_MG_INVERTER
+      && param.mg_global.setup_type == QUDA_NULL_VECTOR_SETUP;
+    if (batch_size > 1 && !batched)
+      warningQuda("Batched setup is only supported for null-vector setup without MG setup inverter, solving each vector in turn");
+
+    Solver *solve = nullptr;
     DiracMdagM *mdagm = (solverParam.inv_type == QUDA_CG_INVERTER || solverParam.inv_type == QUDA_CA_CG_INVERTER) ? new DiracMdagM(*diracSmoother) : nullptr;
     DiracMdagM *mdagmSloppy = (solverParam.inv_type == QUDA_CG_INVERTER || solverParam.inv_type == QUDA_CA_CG_INVERTER) ? new DiracMdagM(*diracSmootherSloppy) : nullptr;
     if (solverParam.inv_type == QUDA_CG_INVERTER || solverParam.inv_type == QUDA_CA_CG_INVERTER) {
@@ -1364,7 +1960,7 @@ namespace quda
       solve = Solver::create(solverParam, *param.matSmooth, *param.matSmooth, *param.matSmoothSloppy,
                              *param.matSmoothSloppy, profile);
       solverParam.inv_type = QUDA_MG_INVERTER;
-    } else {
+    } else if (!batched) {
       solve = Solver::create(solverParam, *param.matSmooth, *param.matSmoothSloppy, *param.matSmoothSloppy,
                              *param.matSmoothSloppy, profile);
     }
@@ -1387,8 +1983,17 @@ namespace quda
         }
       }
 
+      if (batched) {
+        // relax the vectors in batches against the normal operator if the setup inverter requires it
+        const DiracMatrix &mat = mdagmSloppy ? static_cast<const DiracMatrix &>(*mdagmSloppy) : *param.matSmoothSloppy;
+        for (int i = 0; i < (int)B.size(); i += batch_size) {
+          std::vector<ColorSpinorField *> B_batch(B.begin() + i, B.begin() + std::min(i + batch_size, (int)B.size()));
+          relaxNullVectorsBatched(B_batch, mat, solverParam);
+        }
+      }
+
       // launch solver for each source
-      for (int i=0; i<(int)B.size(); i++) {
+      for (int i = 0; i < (int)B.size() && !batched; i++) {
         if (param.mg_global.setup_type == QUDA_TEST_VECTOR_SETUP) { // DDalphaAMG test vector idea
           *b = *B[i];  // inverting against the vector
           zero(*x);    // with zero initial guess
@@ -1447,7 +2052,7 @@ namespace quda
       }
     }
 
-    delete solve;
+    if (solve) delete solve;
     if (mdagm) delete mdagm;
     if (mdagmSloppy) delete mdagmSloppy;
 
@@ -1471,6 +2076,151 @@ namespace quda
     popLevel();
   }
 
+  double MG::transferDefect()
+  {
+    pushLevel(param.level);
+
+    ColorSpinorParam csParam(*param.B[0]);
+    csParam.create = QUDA_NULL_FIELD_CREATE;
+    ColorSpinorField *tmp = ColorSpinorField::Create(csParam);
+    ColorSpinorField *tmp_coarse = param.B[0]->CreateCoarse(param.geoBlockSize, param.spinBlockSize, param.Nvec,
+                                                            (*B_coarse)[0]->Precision(), (*B_coarse)[0]->Location());
+
+    double defect = 0.0;
+    for (int i = 0; i < param.Nvec; i++) {
+      transfer->R(*tmp_coarse, *param.B[i]);
+      transfer->P(*tmp, *tmp_coarse);
+      double b2 = blas::norm2(*param.B[i]);
+      double defect2 = blas::xmyNorm(*param.B[i], *tmp); // tmp = B - P R B
+      if (b2 > 0.0) defect = std::max(defect, sqrt(defect2 / b2));
+    }
+
+    delete tmp_coarse;
+    delete tmp;
+
+    popLevel();
+    return defect;
+  }
+
+  void MG::relaxNullVectorsBatched(std::vector<ColorSpinorField *> &B, const DiracMatrix &mat,
+                                   const SolverParam &solverParam)
+  {
+    const int n = B.size();
+
+    // full-field workspace, at the sloppy precision of the operator
+    ColorSpinorParam csParam(*B[0]);
+    csParam.setPrecision(solverParam.precision_sloppy, solverParam.precision_sloppy, true);
+    csParam.location = QUDA_CUDA_FIELD_LOCATION;
+    csParam.gammaBasis = B[0]->Nspin() == 1 ? QUDA_DEGRAND_ROSSI_GAMMA_BASIS : QUDA_UKQCD_GAMMA_BASIS;
+    csParam.create = QUDA_ZERO_FIELD_CREATE;
+    std::vector<ColorSpinorField *> x_full(n), b_full(n), x(n);
+    for (int i = 0; i < n; i++) {
+      x_full[i] = ColorSpinorField::Create(csParam);
+      b_full[i] = ColorSpinorField::Create(csParam);
+      *x_full[i] = *B[i];
+      ColorSpinorField *in = nullptr;
+      diracSmoother->prepare(in, x[i], *x_full[i], *b_full[i], QUDA_MAT_SOLUTION);
+    }
+
+    // workspace for the system we are relaxing (single parity if preconditioned)
+    ColorSpinorParam rParam(*x[0]);
+    rParam.create = QUDA_NULL_FIELD_CREATE;
+    std::vector<ColorSpinorField *> r(n), Ar(n);
+    for (int i = 0; i < n; i++) {
+      r[i] = ColorSpinorField::Create(rParam);
+      Ar[i] = ColorSpinorField::Create(rParam);
+    }
+    ColorSpinorField *tmp1 = ColorSpinorField::Create(rParam);
+    ColorSpinorField *tmp2 = ColorSpinorField::Create(rParam);
+
+    // Gram-Schmidt, as used for the global orthonormalization of the
+    // null-space vectors, with a second pass to restore orthogonality
+    auto gram_schmidt = [&]() {
+      for (int i = 0; i < n; i++) {
+        for (int pass = 0; pass < 2; pass++) {
+          for (int j = 0; j < i; j++) {
+            Complex alpha = cDotProduct(*x[j], *x[i]); // <j,i>
+            caxpy(-alpha, *x[j], *x[i]);              // i-<j,i>j
+          }
+        }
+        double nrm2 = norm2(*x[i]);
+        if (sqrt(nrm2) > 1e-16)
+          ax(1.0 / sqrt(nrm2), *x[i]);
+        else
+          errorQuda("Cannot normalize batched vector %d (nrm=%e)", i, sqrt(nrm2));
+      }
+    };
+
+    // Cholesky-QR: with G = X^dag X = L L^dag we have Q = X L^{-dag},
+    // using r as the workspace for the orthonormalized batch.  If the
+    // batch is too ill-conditioned (at the sloppy precision) for the
+    // Cholesky factorization we fall back to Gram-Schmidt.
+    auto orthonormalize = [&]() {
+      std::vector<Complex> G_(n * n);
+      blas::hDotProduct(G_.data(), x, x);
+      MatrixXcd G(n, n);
+      for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) G(i, j) = G_[j * n + i];
+      Eigen::LLT<MatrixXcd> llt(G);
+      if (llt.info() != Eigen::Success) {
+        if (getVerbosity() >= QUDA_VERBOSE)
+          printfQuda("Cholesky-QR of the batch failed, orthonormalizing with Gram-Schmidt\n");
+        gram_schmidt();
+        return;
+      }
+      MatrixXcd L_inv_dag = llt.matrixL().solve(MatrixXcd::Identity(n, n)).adjoint();
+
+      std::vector<Complex> T(n * n);
+      for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) T[i * n + j] = L_inv_dag(i, j);
+      for (auto ri : r) blas::zero(*ri);
+      blas::caxpy(T.data(), x, r);
+      for (int i = 0; i < n; i++) blas::copy(*x[i], *r[i]);
+    };
+
+    orthonormalize();
+
+    // since the batch is normalized the residual norm is relative to the vector norm
+    const double stop = solverParam.tol * solverParam.tol;
+    int k = 0;
+    double r2_max = 0.0;
+    for (; k < solverParam.maxiter; k++) {
+      mat(r, x, *tmp1, *tmp2);  // residual of the homogeneous system is -r
+      mat(Ar, r, *tmp1, *tmp2);
+
+      r2_max = 0.0;
+      for (int i = 0; i < n; i++) {
+        double3 Ar_r = blas::cDotProductNormA(*Ar[i], *r[i]);
+        double r2 = blas::norm2(*r[i]);
+        r2_max = std::max(r2_max, r2);
+        if (Ar_r.z > 0.0) blas::caxpy(-Complex(Ar_r.x, Ar_r.y) / Ar_r.z, *r[i], *x[i]);
+      }
+
+      orthonormalize();
+
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+        printfQuda("Batched setup iteration %d: max residual norm = %e\n", k, sqrt(r2_max));
+      if (r2_max < stop) break;
+    }
+
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("Batched setup of %d vectors: %d iterations, max residual norm = %e\n", n, k, sqrt(r2_max));
+
+    for (int i = 0; i < n; i++) {
+      diracSmoother->reconstruct(*x_full[i], *b_full[i], QUDA_MAT_SOLUTION);
+      *B[i] = *x_full[i];
+    }
+
+    delete tmp2;
+    delete tmp1;
+    for (int i = 0; i < n; i++) {
+      delete Ar[i];
+      delete r[i];
+      delete b_full[i];
+      delete x_full[i];
+    }
+  }
+
   // generate a full span of free vectors.
   // FIXME: Assumes fine level is SU(3).
   void MG::buildFreeVectors(std::vector<ColorSpinorField *> &B)
@@ -4,26 +4,36 @@
 #include <tunable_nd.h>
 #include <kernels/reduce_init.cuh>
 
-// These are used for reduction kernels
-static device_reduce_t *d_reduce = nullptr;
-static device_reduce_t *h_reduce = nullptr;
-static device_reduce_t *hd_reduce = nullptr;
-
-static count_t *reduce_count = nullptr;
-static qudaEvent_t reduceEnd;
-
 namespace quda
 {
 
   namespace reducer
   {
 
+    /**
+       The buffers and event used for reduction kernels.  The main
+       thread uses the default set, while host threads that reduce
+       concurrently with it must bind a set of their own.
+    */
+    struct buffers_t {
+      device_reduce_t *d_reduce = nullptr;
+      device_reduce_t *h_reduce = nullptr;
+      device_reduce_t *hd_reduce = nullptr;
+      count_t *reduce_count = nullptr;
+      qudaEvent_t reduceEnd;
+    };
+
+    static buffers_t default_buffers;
+    static thread_local buffers_t *thread_buffers = nullptr;
+
+    static buffers_t &buffers() { return thread_buffers ? *thread_buffers : default_buffers; }
+
     // FIXME need to dynamically resize these
-    void *get_device_buffer() { return d_reduce; }
-    void *get_mapped_buffer() { return hd_reduce; }
-    void *get_host_buffer() { return h_reduce; }
-    template <> count_t *get_count() { return reduce_count; }
-    qudaEvent_t &get_event() { return reduceEnd; }
+    void *get_device_buffer() { return buffers().d_reduce; }
+    void *get_mapped_buffer() { return buffers().hd_reduce; }
+    void *get_host_buffer() { return buffers().h_reduce; }
+    template <> count_t *get_count() { return buffers().reduce_count; }
+    qudaEvent_t &get_event() { return buffers().reduceEnd; }
 
     size_t buffer_size()
     {
@@ -67,49 +77,69 @@ namespace quda
       }
     };
 
-    void init()
+    static void allocate(buffers_t &b)
     {
       auto bytes = buffer_size();
-      if (!d_reduce) d_reduce = (device_reduce_t *)device_malloc(bytes);
+      if (!b.d_reduce) b.d_reduce = (device_reduce_t *)device_malloc(bytes);
 
       // these arrays are actually oversized currently (only needs to be device_reduce_t x 3)
 
-      if (!h_reduce) {
-        h_reduce = (device_reduce_t *)mapped_malloc(bytes);
-        hd_reduce = (device_reduce_t *)get_mapped_device_pointer(h_reduce); // set the matching device pointer
+      if (!b.h_reduce) {
+        b.h_reduce = (device_reduce_t *)mapped_malloc(bytes);
+        b.hd_reduce = (device_reduce_t *)get_mapped_device_pointer(b.h_reduce); // set the matching device pointer
 
         using system_atomic_t = device_reduce_t;
         size_t n_reduce = bytes / sizeof(system_atomic_t);
-        auto *atomic_buf = reinterpret_cast<system_atomic_t *>(h_reduce);
+        auto *atomic_buf = reinterpret_cast<system_atomic_t *>(b.h_reduce);
         for (size_t i = 0; i < n_reduce; i++) new (atomic_buf + i) system_atomic_t {0}; // placement new constructor
       }
 
-      if (!reduce_count) {
-        reduce_count = static_cast<count_t *>(device_malloc(max_n_reduce() * sizeof(decltype(*reduce_count))));
-        init_reduce<count_t> init(reduce_count);
+      if (!b.reduce_count) {
+        b.reduce_count = static_cast<count_t *>(device_malloc(max_n_reduce() * sizeof(decltype(*b.reduce_count))));
+        init_reduce<count_t> init(b.reduce_count);
       }
 
-      reduceEnd = qudaEventCreate();
+      b.reduceEnd = qudaEventCreate();
     }
 
-    void destroy()
+    static void release(buffers_t &b)
     {
-      qudaEventDestroy(reduceEnd);
+      qudaEventDestroy(b.reduceEnd);
 
-      if (reduce_count) {
-        device_free(reduce_count);
-        reduce_count = nullptr;
+      if (b.reduce_count) {
+        device_free(b.reduce_count);
+        b.reduce_count = nullptr;
       }
-      if (d_reduce) {
-        device_free(d_reduce);
-        d_reduce = 0;
+      if (b.d_reduce) {
+        device_free(b.d_reduce);
+        b.d_reduce = 0;
       }
-      if (h_reduce) {
-        host_free(h_reduce);
-        h_reduce = 0;
+      if (b.h_reduce) {
+        host_free(b.h_reduce);
+        b.h_reduce = 0;
       }
-      hd_reduce = 0;
+      b.hd_reduce = 0;
     }
 
+    void init() { allocate(default_buffers); }
+
+    void destroy() { release(default_buffers); }
+
+    void *create_buffers()
+    {
+      auto b = new buffers_t;
+      allocate(*b);
+      return b;
+    }
+
+    void destroy_buffers(void *b)
+    {
+      if (!b) return;
+      release(*static_cast<buffers_t *>(b));
+      delete static_cast<buffers_t *>(b);
+    }
+
+    void set_thread_buffers(void *b) { thread_buffers = static_cast<buffers_t *>(b); }
+
   } // namespace reducer
 } // namespace quda
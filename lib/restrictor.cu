@@ -40,6 +40,7 @@ namespace quda {
     const int *fine_to_coarse;
     const int *coarse_to_fine;
     const int parity;
+    const ColorSpinorField *sub;
 
     bool tuneSharedBytes() const { return false; }
     bool tuneAuxDim() const { return true; }
@@ -47,15 +48,16 @@ namespace quda {
 
   public:
     RestrictLaunch(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField &v,
-                   const int *fine_to_coarse, const int *coarse_to_fine, int parity) :
+                   const int *fine_to_coarse, const int *coarse_to_fine, int parity, const ColorSpinorField *sub) :
       TunableBlock2D(in, coarseColor / coarse_colors_per_thread<fineColor, coarseColor>(), max_y_block()),
       out(out), in(in), v(v), fine_to_coarse(fine_to_coarse), coarse_to_fine(coarse_to_fine),
-      parity(parity)
+      parity(parity), sub(sub)
     {
       strcat(vol, ",");
       strcat(vol, out.VolString());
       strcat(aux, ",");
       strcat(aux, out.AuxString());
+      if (sub) strcat(aux, ",residual");
 
       apply(device::get_default_stream());
     }
@@ -64,7 +66,7 @@ namespace quda {
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       if (out.FieldOrder() == QUDA_FLOAT2_FIELD_ORDER) {
-        Arg<QUDA_FLOAT2_FIELD_ORDER> arg(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+        Arg<QUDA_FLOAT2_FIELD_ORDER> arg(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         arg.swizzle_factor = tp.aux.x;
         launch<Restrictor, Aggregates>(tp, stream, arg);
       } else {
@@ -105,29 +107,33 @@ namespace quda {
       param.aux.x = 1; // swizzle factor
     }
 
-    long long flops() const { return 8 * fineSpin * fineColor * coarseColor * in.SiteSubset()*(long long)in.VolumeCB(); }
+    long long flops() const
+    {
+      return (8 * fineSpin * fineColor * coarseColor + (sub ? 2 * fineSpin * fineColor : 0)) * in.SiteSubset()
+        * (long long)in.VolumeCB();
+    }
 
     long long bytes() const {
       size_t v_bytes = v.Bytes() / (v.SiteSubset() == in.SiteSubset() ? 1 : 2);
-      return in.Bytes() + out.Bytes() + v_bytes + in.SiteSubset()*in.VolumeCB()*sizeof(int);
+      return (sub ? 2 : 1) * in.Bytes() + out.Bytes() + v_bytes + in.SiteSubset()*in.VolumeCB()*sizeof(int);
     }
 
   };
 
   template <typename Float, int fineSpin, int fineColor, int coarseSpin, int coarseColor>
   void Restrict(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField &v,
-                const int *fine_to_coarse, const int *coarse_to_fine, int parity) {
+                const int *fine_to_coarse, const int *coarse_to_fine, int parity, const ColorSpinorField *sub) {
 
     if (v.Precision() == QUDA_HALF_PRECISION) {
 #if QUDA_PRECISION & 2
       RestrictLaunch<Float, short, fineSpin, fineColor, coarseSpin, coarseColor>
-        restrictor(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+        restrictor(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
 #else
       errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
 #endif
     } else if (v.Precision() == in.Precision()) {
       RestrictLaunch<Float, Float, fineSpin, fineColor, coarseSpin, coarseColor>
-        restrictor(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+        restrictor(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
     } else {
       errorQuda("Unsupported V precision %d", v.Precision());
     }
@@ -135,7 +141,8 @@ namespace quda {
 
   template <typename Float>
   void Restrict(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField &v,
-                int nVec, const int *fine_to_coarse, const int *coarse_to_fine, const int * const * spin_map, int parity)
+                int nVec, const int *fine_to_coarse, const int *coarse_to_fine, const int * const * spin_map, int parity,
+                const ColorSpinorField *sub)
   {
     if (out.Nspin() != 2) errorQuda("Unsupported nSpin %d", out.Nspin());
     constexpr int coarseSpin = 2;
@@ -154,11 +161,11 @@ namespace quda {
             if (mapper(s,p) != spin_map[s][p]) errorQuda("Spin map does not match spin_mapper");
 
         if (nVec == 6) { // free field Wilson
-          Restrict<Float,fineSpin,fineColor,coarseSpin,6>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,6>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else if (nVec == 24) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,24>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,24>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else if (nVec == 32) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,32>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,32>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else {
           errorQuda("Unsupported nVec %d", nVec);
         }
@@ -176,11 +183,11 @@ namespace quda {
             if (mapper(s,p) != spin_map[s][p]) errorQuda("Spin map does not match spin_mapper");
 
         if (nVec == 24) { // free field staggered
-          Restrict<Float,fineSpin,fineColor,coarseSpin,24>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,24>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else if (nVec == 64) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,64>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,64>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else if (nVec == 96) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,96>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,96>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else {
           errorQuda("Unsupported nVec %d", nVec);
         }
@@ -205,7 +212,7 @@ namespace quda {
       if (in.Ncolor() == 6) { // Coarsen coarsened Wilson free field
         const int fineColor = 6;
         if (nVec == 6) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,6>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,6>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else {
           errorQuda("Unsupported nVec %d", nVec);
         }
@@ -214,16 +221,16 @@ namespace quda {
       if (in.Ncolor() == 24) { // to keep compilation under control coarse grids have same or more colors
         const int fineColor = 24;
         if (nVec == 24) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,24>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,24>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
 #ifdef NSPIN4
         } else if (nVec == 32) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,32>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,32>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
 #endif // NSPIN4
 #ifdef NSPIN1
         } else if (nVec == 64) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,64>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,64>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else if (nVec == 96) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,96>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,96>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
 #endif // NSPIN1
         } else {
           errorQuda("Unsupported nVec %d", nVec);
@@ -232,7 +239,7 @@ namespace quda {
       } else if (in.Ncolor() == 32) {
         const int fineColor = 32;
         if (nVec == 32) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,32>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,32>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else {
           errorQuda("Unsupported nVec %d", nVec);
         }
@@ -241,16 +248,16 @@ namespace quda {
       } else if (in.Ncolor() == 64) {
         const int fineColor = 64;
         if (nVec == 64) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,64>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,64>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else if (nVec == 96) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,96>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,96>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else {
           errorQuda("Unsupported nVec %d", nVec);
         }
       } else if (in.Ncolor() == 96) {
         const int fineColor = 96;
         if (nVec == 96) {
-          Restrict<Float,fineSpin,fineColor,coarseSpin,96>(out, in, v, fine_to_coarse, coarse_to_fine, parity);
+          Restrict<Float,fineSpin,fineColor,coarseSpin,96>(out, in, v, fine_to_coarse, coarse_to_fine, parity, sub);
         } else {
           errorQuda("Unsupported nVec %d", nVec);
         }
@@ -263,27 +270,34 @@ namespace quda {
 
 #ifdef GPU_MULTIGRID
   void Restrict(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField &v,
-                int Nvec, const int *fine_to_coarse, const int *coarse_to_fine, const int * const * spin_map, int parity)
+                int Nvec, const int *fine_to_coarse, const int *coarse_to_fine, const int * const * spin_map, int parity,
+                const ColorSpinorField *sub)
   {
     checkOrder(out, in, v);
     checkLocation(out, in, v);
     QudaPrecision precision = checkPrecision(out, in);
+    if (sub) {
+      checkOrder(in, *sub);
+      checkLocation(in, *sub);
+      checkPrecision(in, *sub);
+      if (sub->SiteSubset() != in.SiteSubset()) errorQuda("Site subsets do not match (in=%d, sub=%d)", in.SiteSubset(), sub->SiteSubset());
+    }
 
     if (precision == QUDA_DOUBLE_PRECISION) {
 #ifdef GPU_MULTIGRID_DOUBLE
-      Restrict<double>(out, in, v, Nvec, fine_to_coarse, coarse_to_fine, spin_map, parity);
+      Restrict<double>(out, in, v, Nvec, fine_to_coarse, coarse_to_fine, spin_map, parity, sub);
 #else
       errorQuda("Double precision multigrid has not been enabled");
 #endif
     } else if (precision == QUDA_SINGLE_PRECISION) {
-      Restrict<float>(out, in, v, Nvec, fine_to_coarse, coarse_to_fine, spin_map, parity);
+      Restrict<float>(out, in, v, Nvec, fine_to_coarse, coarse_to_fine, spin_map, parity, sub);
     } else {
       errorQuda("Unsupported precision %d", out.Precision());
     }
   }
 #else
   void Restrict(ColorSpinorField &, const ColorSpinorField &, const ColorSpinorField &,
-                int, const int *, const int *, const int * const *, int)
+                int, const int *, const int *, const int * const *, int, const ColorSpinorField *)
   {
     errorQuda("Multigrid has not been built");
   }
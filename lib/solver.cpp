@@ -82,6 +82,10 @@ namespace quda {
       report("CA-CGNR");
       solver = new CACGNR(mat, matSloppy, matPrecon, matEig, param, profile);
       break;
+    case QUDA_BLOCK_CG_INVERTER:
+      report("BlockCG");
+      solver = new BlockCG(mat, matSloppy, matPrecon, matEig, param, profile);
+      break;
     case QUDA_CA_GCR_INVERTER:
       report("CA-GCR");
       solver = new CAGCR(mat, matSloppy, matPrecon, matEig, param, profile);
@@ -300,6 +304,18 @@ namespace quda {
     }
   }
 
+  void Solver::blocksolve(std::vector<ColorSpinorField *> &out, std::vector<ColorSpinorField *> &in)
+  {
+    if (out.size() != in.size()) errorQuda("Mismatched set sizes out=%lu in=%lu", out.size(), in.size());
+    for (auto i = 0u; i < in.size(); i++) {
+      (*this)(*out[i], *in[i]);
+      if (i < QUDA_MAX_MULTI_SHIFT) {
+        param.true_res_offset[i] = param.true_res;
+        param.true_res_hq_offset[i] = param.true_res_hq;
+      }
+    }
+  }
+
   double Solver::stopping(double tol, double b2, QudaResidualType residual_type)
   {
     double stop=0.0;
@@ -27,10 +27,13 @@ namespace quda
 
     static bool initialized = false;
 
+    static int device_id = -1;
+
     void init(int dev)
     {
       if (initialized) return;
       initialized = true;
+      device_id = dev;
 
       int driver_version;
       CHECK_CUDA_ERROR(cudaDriverGetVersion(&driver_version));
@@ -190,6 +193,13 @@ namespace quda
       }
     }
 
+    void init_thread()
+    {
+#ifndef USE_QDPJIT
+      if (device_id >= 0) CHECK_CUDA_ERROR(cudaSetDevice(device_id));
+#endif
+    }
+
     void create_context()
     {
       streams = new cudaStream_t[Nstream];
@@ -279,6 +289,13 @@ namespace quda
       return max_blocks_per_sm;
     }
 
+    size_t free_memory()
+    {
+      size_t free_bytes, total_bytes;
+      CHECK_CUDA_ERROR(cudaMemGetInfo(&free_bytes, &total_bytes));
+      return free_bytes;
+    }
+
     namespace profile
     {
 
@@ -362,6 +362,16 @@ namespace quda
     }
   }
 
+  void qudaMemcpy2DAsync_(void *dst, size_t dpitch, const void *src, size_t spitch, size_t width, size_t height,
+                          qudaMemcpyKind kind, const qudaStream_t &stream, const char *func, const char *file,
+                          const char *line)
+  {
+    if (width == 0 || height == 0) return;
+    cudaError_t error
+      = cudaMemcpy2DAsync(dst, dpitch, src, spitch, width, height, qudaMemcpyKindToAPI(kind), get_stream(stream));
+    set_runtime_error(error, __func__, func, file, line);
+  }
+
   void qudaMemcpyP2PAsync_(void *dst, const void *src, size_t count, const qudaStream_t &stream, const char *func,
                            const char *file, const char *line)
   {
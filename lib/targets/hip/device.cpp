@@ -22,10 +22,13 @@ namespace quda
 
     static bool initialized = false;
 
+    static int device_id = -1;
+
     void init(int dev)
     {
       if (initialized) return;
       initialized = true;
+      device_id = dev;
       printfQuda("*** HIP BACKEND ***\n");
       int driver_version;
       cudaDriverGetVersion(&driver_version);
@@ -119,6 +122,16 @@ namespace quda
       // cudaGetDeviceProperties(&deviceProp, dev);
     }
 
+    void init_thread()
+    {
+#ifndef USE_QDPJIT
+      if (device_id >= 0) {
+        cudaSetDevice(device_id);
+        checkCudaErrorNoSync();
+      }
+#endif
+    }
+
     void create_context()
     {
       streams = new qudaStream_t[Nstream];
@@ -21,7 +21,7 @@ namespace quda {
   */
   Transfer::Transfer(const std::vector<ColorSpinorField *> &B, int Nvec, int n_block_ortho, bool block_ortho_two_pass,
                      int *geo_bs, int spin_bs, QudaPrecision null_precision, const QudaTransferType transfer_type,
-                     TimeProfile &profile) :
+                     TimeProfile &profile, bool compute) :
     B(B),
     Nvec(Nvec),
     NblockOrtho(n_block_ortho),
@@ -126,14 +126,15 @@ namespace quda {
       coarse_to_fine_d = static_cast<int*>(pool_device_malloc(B[0]->Volume()*sizeof(int)));
     }
 
-    createGeoMap(geo_bs);
+    // when restoring from a checkpoint the maps are loaded instead
+    if (compute) createGeoMap(geo_bs);
 
     // allocate the fine-to-coarse spin map
     spin_map = static_cast<int**>(safe_malloc(nspin_fine*sizeof(int*)));
     for (int s = 0; s < B[0]->Nspin(); s++) spin_map[s] = static_cast<int*>(safe_malloc(2*sizeof(int)));
     createSpinMap(spin_bs);
 
-    reset();
+    if (compute) reset();
     postTrace();
   }
 
@@ -260,6 +261,33 @@ namespace quda {
     postTrace();
   }
 
+  void Transfer::save(CheckpointIO &io) const
+  {
+    io.save(fine_to_coarse_h, B[0]->Volume() * sizeof(int));
+    io.save(coarse_to_fine_h, B[0]->Volume() * sizeof(int));
+    if (transfer_type == QUDA_TRANSFER_AGGREGATE) io.save(Vectors());
+  }
+
+  void Transfer::load(CheckpointIO &io)
+  {
+    io.load(fine_to_coarse_h, B[0]->Volume() * sizeof(int));
+    io.load(coarse_to_fine_h, B[0]->Volume() * sizeof(int));
+    if (enable_gpu) {
+      qudaMemcpy(fine_to_coarse_d, fine_to_coarse_h, B[0]->Volume() * sizeof(int), qudaMemcpyHostToDevice);
+      qudaMemcpy(coarse_to_fine_d, coarse_to_fine_h, B[0]->Volume() * sizeof(int), qudaMemcpyHostToDevice);
+    }
+
+    if (transfer_type != QUDA_TRANSFER_AGGREGATE) return;
+
+    if (B[0]->Location() == QUDA_CUDA_FIELD_LOCATION) {
+      io.load(*V_d);
+      if (enable_cpu) *V_h = *V_d;
+    } else {
+      io.load(*V_h);
+      if (enable_gpu) *V_d = *V_h;
+    }
+  }
+
   Transfer::~Transfer() {
     if (spin_map)
     {
@@ -358,10 +386,28 @@ namespace quda {
     }
   }
 
+  bool Transfer::fusable(const ColorSpinorField &fine, const ColorSpinorField &coarse) const
+  {
+    if (transfer_type != QUDA_TRANSFER_AGGREGATE || !use_gpu || !enable_gpu) return false;
+    if (fine.Location() != QUDA_CUDA_FIELD_LOCATION) return false;
+    if (V_d->Nspin() != 1 && fine.GammaBasis() != V_d->GammaBasis()) return false;
+
+    // the fine field is not staged, so it must match the precision and order of the coarse
+    // field the kernel reads or writes, which is staged on the device if need be
+    const bool staged = coarse.Location() != QUDA_CUDA_FIELD_LOCATION;
+    const QudaPrecision coarse_precision
+      = staged ? std::max(B[0]->Precision(), QUDA_SINGLE_PRECISION) : coarse.Precision();
+    const QudaFieldOrder coarse_order = staged ? QUDA_FLOAT2_FIELD_ORDER : coarse.FieldOrder();
+    return fine.Precision() >= QUDA_SINGLE_PRECISION && fine.Precision() == coarse_precision
+      && fine.FieldOrder() == V_d->FieldOrder() && coarse_order == V_d->FieldOrder();
+  }
+
   // apply the prolongator
-  void Transfer::P(ColorSpinorField &out, const ColorSpinorField &in) const {
+  void Transfer::P(ColorSpinorField &out, const ColorSpinorField &in, bool accumulate) const {
     profile.TPSTART(QUDA_PROFILE_COMPUTE);
 
+    if (accumulate && !fusable(out, in)) errorQuda("Accumulating prolongation is not supported for this field");
+
     ColorSpinorField *input = const_cast<ColorSpinorField*>(&in);
     ColorSpinorField *output = &out;
     initializeLazy(use_gpu ? QUDA_CUDA_FIELD_LOCATION : QUDA_CPU_FIELD_LOCATION);
@@ -408,9 +454,9 @@ namespace quda {
                   output->GammaBasis(), in.GammaBasis(), V->GammaBasis());
       }
 
-      Prolongate(*output, *input, *V, Nvec, fine_to_coarse, spin_map, parity);
+      Prolongate(*output, *input, *V, Nvec, fine_to_coarse, spin_map, parity, accumulate);
 
-      flops_ += 8 * in.Ncolor() * out.Ncolor() * out.VolumeCB() * out.SiteSubset();
+      flops_ += (8 * in.Ncolor() + (accumulate ? 2 : 0)) * out.Ncolor() * out.VolumeCB() * out.SiteSubset();
     } else {
       errorQuda("Invalid transfer type in prolongate");
     }
@@ -421,10 +467,12 @@ namespace quda {
   }
 
   // apply the restrictor
-  void Transfer::R(ColorSpinorField &out, const ColorSpinorField &in) const
+  void Transfer::R(ColorSpinorField &out, const ColorSpinorField &in, const ColorSpinorField *sub) const
   {
     profile.TPSTART(QUDA_PROFILE_COMPUTE);
 
+    if (sub && !(fusable(in, out) && fusable(*sub, out))) errorQuda("Residual restriction is not supported for this field");
+
     ColorSpinorField *input = &const_cast<ColorSpinorField&>(in);
     ColorSpinorField *output = &out;
     initializeLazy(use_gpu ? QUDA_CUDA_FIELD_LOCATION : QUDA_CPU_FIELD_LOCATION);
@@ -471,9 +519,9 @@ namespace quda {
         errorQuda("Cannot apply restrictor using fields in a different basis from the null space (%d,%d) != %d",
                   out.GammaBasis(), input->GammaBasis(), V->GammaBasis());
 
-      Restrict(*output, *input, *V, Nvec, fine_to_coarse, coarse_to_fine, spin_map, parity);
+      Restrict(*output, *input, *V, Nvec, fine_to_coarse, coarse_to_fine, spin_map, parity, sub);
 
-      flops_ += 8 * out.Ncolor() * in.Ncolor() * in.VolumeCB() * in.SiteSubset();
+      flops_ += (8 * out.Ncolor() + (sub ? 2 : 0)) * in.Ncolor() * in.VolumeCB() * in.SiteSubset();
     } else {
       errorQuda("Invalid transfer type in restrict");
     }
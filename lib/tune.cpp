@@ -17,6 +17,7 @@
 #include <deque>
 #include <queue>
 #include <functional>
+#include <mutex>
 
 #include <communicator_quda.h>
 
@@ -25,9 +26,19 @@ extern char *gitversion;
 
 namespace quda
 {
+  // serializes access to the tune cache, trace and last key, since
+  // kernels may be launched from host worker threads (e.g., an
+  // asynchronous coarse-grid solve); recursive since tuning a kernel
+  // calls tuneLaunch again from within the kernel's apply
+  static std::recursive_mutex tune_mutex;
+
   static TuneKey last_key;
 
-  TuneKey getLastTuneKey() { return quda::last_key; }
+  TuneKey getLastTuneKey()
+  {
+    std::lock_guard<std::recursive_mutex> lock(tune_mutex);
+    return quda::last_key;
+  }
 
   typedef std::map<TuneKey, TuneParam> map;
 
@@ -86,6 +97,7 @@ namespace quda
   void postTrace_(const char *func, const char *file, int line)
   {
     if (traceEnabled() >= 1) {
+      std::lock_guard<std::recursive_mutex> lock(tune_mutex);
       char aux[TuneKey::aux_n];
       strcpy(aux, file);
       strcat(aux, ":");
@@ -101,7 +113,6 @@ namespace quda
   static const std::string quda_hash = QUDA_HASH; // defined in lib/Makefile
   static std::string resource_path;
   static map tunecache;
-  static map::iterator it;
   static size_t initial_cache_size = 0;
 
 #define STR_(x) #x
@@ -429,6 +440,7 @@ namespace quda
    */
   void saveTuneCache(bool error)
   {
+    std::lock_guard<std::recursive_mutex> lock(tune_mutex);
     time_t now;
     int lock_handle;
     std::string lock_path, cache_path;
@@ -512,6 +524,7 @@ namespace quda
   // flush profile, setting counts to zero
   void flushProfile()
   {
+    std::lock_guard<std::recursive_mutex> lock(tune_mutex);
     for (map::iterator entry = tunecache.begin(); entry != tunecache.end(); entry++) {
       // set all n_calls = 0
       TuneParam &param = entry->second;
@@ -522,6 +535,7 @@ namespace quda
   // save profile
   void saveProfile(const std::string label)
   {
+    std::lock_guard<std::recursive_mutex> lock(tune_mutex);
     time_t now;
     int lock_handle;
     std::string lock_path, profile_path, async_profile_path, trace_path;
@@ -684,6 +698,8 @@ namespace quda
    */
   TuneParam tuneLaunch(Tunable &tunable, QudaTune enabled, QudaVerbosity verbosity)
   {
+    std::lock_guard<std::recursive_mutex> lock(tune_mutex);
+
 #ifdef LAUNCH_TIMER
     launchTimer.TPSTART(QUDA_PROFILE_TOTAL);
     launchTimer.TPSTART(QUDA_PROFILE_INIT);
@@ -699,7 +715,7 @@ namespace quda
 #endif
 
     static const Tunable *active_tunable; // for error checking
-    it = tunecache.find(key);
+    auto it = tunecache.find(key);
 
     // first check if we have the tuned value and return if we have it
     if (enabled == QUDA_TUNE_YES && it != tunecache.end()) {
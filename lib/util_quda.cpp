@@ -4,6 +4,9 @@
 #include <stack>
 #include <sstream>
 #include <sys/time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include <enum_quda.h>
 #include <util_quda.h>
@@ -12,12 +15,14 @@
 
 static const size_t MAX_PREFIX_SIZE = 100;
 
-static QudaVerbosity verbosity_ = QUDA_SUMMARIZE;
-static char prefix_[MAX_PREFIX_SIZE] = "";
+// the verbosity, output prefix and print buffer are per thread so
+// that host worker threads can print alongside the main thread
+static thread_local QudaVerbosity verbosity_ = QUDA_SUMMARIZE;
+static thread_local char prefix_[MAX_PREFIX_SIZE] = "";
 static FILE *outfile_ = stdout;
 
 static const int MAX_BUFFER_SIZE = 1000;
-static char buffer_[MAX_BUFFER_SIZE] = "";
+static thread_local char buffer_[MAX_BUFFER_SIZE] = "";
 
 QudaVerbosity getVerbosity() { return verbosity_; }
 char *getOutputPrefix() { return prefix_; }
@@ -79,7 +84,7 @@ void setOutputFile(FILE *outfile)
 }
 
 
-static std::stack<QudaVerbosity> vstack;
+static thread_local std::stack<QudaVerbosity> vstack;
 
 void pushVerbosity(QudaVerbosity verbosity)
 {
@@ -101,7 +106,7 @@ void popVerbosity()
   vstack.pop();
 }
 
-static std::stack<char *> pstack;
+static thread_local std::stack<char *> pstack;
 
 void pushOutputPrefix(const char *prefix)
 {
@@ -144,6 +149,15 @@ char* getOmpThreadStr() {
   return omp_thread_string;
 }
 
+int host_kernel_threads()
+{
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
 void errorQuda_(const char *func, const char *file, int line, ...)
 {
   fprintf(getOutputFile(), " (rank %d, host %s, %s:%d in %s())\n", comm_rank_global(), comm_hostname(), file, line, func);
@@ -32,8 +32,8 @@ void display_test_info(int precision, QudaReconstructType link_recon)
   //   dimPartitioned(3));
 
   if (dslash_test_wrapper.test_split_grid) {
-    printfQuda("Testing with split grid: %d  %d  %d  %d\n", grid_partition[0], grid_partition[1], grid_partition[2],
-               grid_partition[3]);
+    printfQuda("Testing with split grid: %d  %d  %d  %d, %d sources\n", grid_partition[0], grid_partition[1],
+               grid_partition[2], grid_partition[3], dslash_test_wrapper.num_src);
   }
 
   return ;
@@ -147,6 +147,7 @@ int main(int argc, char **argv)
   initComms(argc, argv, gridsize_from_cmdline);
 
   dslash_test_wrapper.num_src = grid_partition[0] * grid_partition[1] * grid_partition[2] * grid_partition[3];
+  if (dslash_test_wrapper.num_src == 1 && Nsrc > 1) dslash_test_wrapper.num_src = Nsrc;
   dslash_test_wrapper.test_split_grid = dslash_test_wrapper.num_src > 1;
 
   // The 'SetUp()' method of the Google Test class from which DslashTest
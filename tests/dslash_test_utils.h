@@ -125,6 +125,8 @@ struct DslashTestWrapper {
   void init(int argc, char **argv)
   {
     num_src = grid_partition[0] * grid_partition[1] * grid_partition[2] * grid_partition[3];
+    // without a split grid, multiple sources are applied locally as one multi-RHS dslash
+    if (num_src == 1 && Nsrc > 1) num_src = Nsrc;
     test_split_grid = num_src > 1;
     if (test_split_grid) { dtest_type = dslash_test_type::Dslash; }
 
@@ -1103,7 +1105,7 @@ struct DslashTestWrapper {
 
   double verify()
   {
-    double deviation;
+    double deviation = 0.0;
     if (test_split_grid) {
       for (int n = 0; n < num_src; n++) {
         double norm2_cpu = blas::norm2(*spinorRef);
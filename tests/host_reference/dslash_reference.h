@@ -86,20 +86,26 @@ static inline void su3Tmul(sFloat *res, gFloat *mat, sFloat *vec) {
   su3Transpose(matT, mat);
   su3Mul(res, matT, vec);
 }
-void verifyInversion(void *spinorOut, void *spinorIn, void *spinorCheck, QudaGaugeParam &gauge_param,
-                     QudaInvertParam &inv_param, void **gauge, void *clover, void *clover_inv);
-
-void verifyInversion(void *spinorOut, void **spinorOutMulti, void *spinorIn, void *spinorCheck,
-                     QudaGaugeParam &gauge_param, QudaInvertParam &inv_param, void **gauge, void *clover,
-                     void *clover_inv);
-
-void verifyDomainWallTypeInversion(void *spinorOut, void **spinorOutMulti, void *spinorIn, void *spinorCheck,
-                                   QudaGaugeParam &gauge_param, QudaInvertParam &inv_param, void **gauge, void *clover,
-                                   void *clover_inv);
-
-void verifyWilsonTypeInversion(void *spinorOut, void **spinorOutMulti, void *spinorIn, void *spinorCheck,
-                               QudaGaugeParam &gauge_param, QudaInvertParam &inv_param, void **gauge, void *clover,
-                               void *clover_inv);
+/**
+   @brief Verify an inversion by applying the host reference operator
+   to the solution and comparing with the source
+   @return The host L2 relative residual (the maximum over shifts for
+   a multi-shift solve)
+*/
+double verifyInversion(void *spinorOut, void *spinorIn, void *spinorCheck, QudaGaugeParam &gauge_param,
+                       QudaInvertParam &inv_param, void **gauge, void *clover, void *clover_inv);
+
+double verifyInversion(void *spinorOut, void **spinorOutMulti, void *spinorIn, void *spinorCheck,
+                       QudaGaugeParam &gauge_param, QudaInvertParam &inv_param, void **gauge, void *clover,
+                       void *clover_inv);
+
+double verifyDomainWallTypeInversion(void *spinorOut, void **spinorOutMulti, void *spinorIn, void *spinorCheck,
+                                     QudaGaugeParam &gauge_param, QudaInvertParam &inv_param, void **gauge,
+                                     void *clover, void *clover_inv);
+
+double verifyWilsonTypeInversion(void *spinorOut, void **spinorOutMulti, void *spinorIn, void *spinorCheck,
+                                 QudaGaugeParam &gauge_param, QudaInvertParam &inv_param, void **gauge, void *clover,
+                                 void *clover_inv);
 
 void verifyStaggeredInversion(quda::ColorSpinorField *tmp, quda::ColorSpinorField *ref, quda::ColorSpinorField *in,
                               quda::ColorSpinorField *out, double mass, void *qdp_fatlink[], void *qdp_longlink[],
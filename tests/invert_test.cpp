@@ -16,6 +16,9 @@
 
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 
+// whether to restore the saved multigrid hierarchy and check the solves are unchanged
+bool mg_verify_hierarchy = false;
+
 void display_test_info()
 {
   printfQuda("running the following test:\n");
@@ -108,6 +111,9 @@ int main(int argc, char **argv)
   add_eofa_option_group(app);
   add_multigrid_option_group(app);
   add_comms_option_group(app);
+  app->add_option("--mg-verify-hierarchy", mg_verify_hierarchy,
+                  "Restore the hierarchy saved with --mg-save-hierarchy and check the solves take the same iterations "
+                  "(default false)");
   try {
     app->parse(argc, argv);
   } catch (const CLI::ParseError &e) {
@@ -207,6 +213,8 @@ int main(int argc, char **argv)
 
   int num_sub_partition = grid_partition[0] * grid_partition[1] * grid_partition[2] * grid_partition[3];
   bool use_split_grid = num_sub_partition > 1;
+  // block solvers take all sources at once through the multi-source interface
+  bool use_multi_src = use_split_grid || (inv_type == QUDA_BLOCK_CG_INVERTER && Nsrc > 1);
 
   // set parameters for the reference Dslash, and prepare fields to be loaded
   if (dslash_type == QUDA_DOMAIN_WALL_DSLASH || dslash_type == QUDA_DOMAIN_WALL_4D_DSLASH
@@ -223,7 +231,7 @@ int main(int argc, char **argv)
   for (int dir = 0; dir < 4; dir++) gauge[dir] = safe_malloc(V * gauge_site_size * host_gauge_data_type_size);
   constructHostGaugeField(gauge, gauge_param, argc, argv);
   // Load the gauge field to the device
-  loadGaugeQuda((void *)gauge, &gauge_param);
+  loadHostGaugeQuda((void *)gauge, gauge_param);
 
   // Allocate host side memory for clover terms if needed.
   //----------------------------------------------------------------------------
@@ -254,6 +262,7 @@ int main(int argc, char **argv)
     if (use_split_grid) { errorQuda("Split grid does not work with MG yet."); }
     mg_preconditioner = newMultigridQuda(&mg_param);
     inv_param.preconditioner = mg_preconditioner;
+    if (mg_param.hierarchy_store == QUDA_BOOLEAN_TRUE) dumpMultigridQuda(mg_preconditioner, &mg_param);
   }
 
   // Compute plaquette as a sanity check
@@ -306,6 +315,8 @@ int main(int argc, char **argv)
 
   auto *rng = new quda::RNG(*check, 1234);
 
+  int test_rc = 0;
+
   for (int i = 0; i < Nsrc; i++) {
     // Populate the host spinor with random numbers.
     in[i] = quda::ColorSpinorField::Create(cs_param);
@@ -313,7 +324,7 @@ int main(int argc, char **argv)
     out[i] = quda::ColorSpinorField::Create(cs_param);
   }
 
-  if (!use_split_grid) {
+  if (!use_multi_src) {
 
     for (int i = 0; i < Nsrc; i++) {
       // If deflating, preserve the deflation space between solves
@@ -331,6 +342,29 @@ int main(int argc, char **argv)
       printfQuda("Done: %i iter / %g secs = %g Gflops\n\n", inv_param.iter, inv_param.secs,
                  inv_param.gflops / inv_param.secs);
     }
+
+    if (inv_multigrid && mg_verify_hierarchy) {
+      if (mg_param.hierarchy_store != QUDA_BOOLEAN_TRUE) errorQuda("Verifying the hierarchy requires it to be saved");
+
+      // rebuild the preconditioner from the checkpoint we just wrote
+      destroyMultigridQuda(mg_preconditioner);
+      strcpy(mg_param.hierarchy_infile, mg_param.hierarchy_outfile);
+      mg_param.hierarchy_load = QUDA_BOOLEAN_TRUE;
+      mg_param.hierarchy_store = QUDA_BOOLEAN_FALSE;
+      mg_preconditioner = newMultigridQuda(&mg_param);
+      inv_param.preconditioner = mg_preconditioner;
+
+      // the restored hierarchy must reproduce the solves exactly
+      for (int i = 0; i < Nsrc; i++) {
+        invertQuda(out[i]->V(), in[i]->V(), &inv_param);
+        printfQuda("Restored hierarchy: source %d took %d iter (set up hierarchy took %d iter)\n", i, inv_param.iter,
+                   iter[i]);
+        if (inv_param.iter != iter[i]) {
+          printfQuda("ERROR: the restored hierarchy does not match the set up hierarchy\n");
+          test_rc = 1;
+        }
+      }
+    }
   } else {
     inv_param.num_src = Nsrc;
     inv_param.num_src_per_sub_partition = Nsrc / num_sub_partition;
@@ -366,13 +400,18 @@ int main(int argc, char **argv)
   if (inv_multigrid) destroyMultigridQuda(mg_preconditioner);
 
   // Compute performance statistics
-  if (Nsrc > 1 && !use_split_grid) performanceStats(time, gflops, iter);
+  if (Nsrc > 1 && !use_multi_src) performanceStats(time, gflops, iter);
 
   // Perform host side verification of inversion if requested
   if (verify_results) {
     for (int i = 0; i < Nsrc; i++) {
-      verifyInversion(out[i]->V(), _hp_multi_x[i].data(), in[i]->V(), check->V(), gauge_param, inv_param, gauge, clover,
-                      clover_inv);
+      double l2r = verifyInversion(out[i]->V(), _hp_multi_x[i].data(), in[i]->V(), check->V(), gauge_param, inv_param,
+                                   gauge, clover, clover_inv);
+      // Empirical: if the host residual is more than 1 order above the target accuracy, the solve failed to converge
+      if (l2r > 10 * inv_param.tol) {
+        printfQuda("Source %d has empirically failed to converge\n", i);
+        test_rc = 1;
+      }
     }
   }
 
@@ -398,5 +437,5 @@ int main(int argc, char **argv)
   endQuda();
   finalizeComms();
 
-  return 0;
+  return test_rc;
 }
@@ -0,0 +1,153 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+
+#include <util_quda.h>
+#include <host_utils.h>
+#include <command_line_params.h>
+#include <comm_quda.h>
+
+#include <quda_milc_interface.h>
+
+/*
+  Checks that the MILC interface never skips the construction of the
+  fat and long links when the links resident in QUDA are not the ones
+  it last produced.  Two gauge configurations are alternated, and every
+  solve is compared against a reference solve on the same configuration.
+*/
+
+namespace
+{
+
+  constexpr int n_config = 2;
+  constexpr double solution_tol = 1e-6;
+
+  // gauge fields in MILC site order
+  std::vector<double> in_link[n_config];
+  std::vector<double> fat_link[n_config];
+  std::vector<double> long_link[n_config];
+
+  std::vector<double> source;
+
+  const double act_path_coeff[6] = {0.625, -0.058527, -0.087158, 0.030833, -0.016389, 0.004167};
+
+  void loadLinks(int config)
+  {
+    QudaFatLinkArgs_t fatlink_args = {1, 0};
+    qudaLoadKSLink(2, fatlink_args, act_path_coeff, in_link[config].data(), fat_link[config].data(),
+                   long_link[config].data());
+  }
+
+  std::vector<double> solve(int config, bool force_reload = false)
+  {
+    QudaInvertArgs_t inv_args = {};
+    inv_args.max_iter = 1000;
+    inv_args.evenodd = QUDA_EVEN_PARITY;
+    inv_args.mixed_precision = 0;
+    inv_args.solver_type = QUDA_CG_INVERTER;
+    inv_args.tadpole = 1.0;
+    inv_args.naik_epsilon = 0.0;
+
+    std::vector<double> solution(source.size(), 0.0);
+    double residual, fermilab_residual;
+    int num_iters = force_reload ? -1 : 0;
+    qudaInvert(2, 2, 0.5, inv_args, 1e-10, 0.0, fat_link[config].data(), long_link[config].data(), source.data(),
+               solution.data(), &residual, &fermilab_residual, &num_iters);
+    return solution;
+  }
+
+  double deviation(const std::vector<double> &x, const std::vector<double> &ref)
+  {
+    std::vector<double> diff(x.size());
+    for (auto i = 0u; i < x.size(); i++) diff[i] = x[i] - ref[i];
+    return sqrt(norm_2(diff.data(), diff.size(), QUDA_DOUBLE_PRECISION)
+                / norm_2(const_cast<double *>(ref.data()), ref.size(), QUDA_DOUBLE_PRECISION));
+  }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  // initialize QMP/MPI, QUDA comms grid and RNG (host_utils.cpp)
+  initComms(argc, argv, gridsize_from_cmdline);
+  initRand();
+
+  QudaGaugeParam gauge_param = newQudaGaugeParam();
+  setWilsonGaugeParam(gauge_param);
+  gauge_param.cpu_prec = QUDA_DOUBLE_PRECISION;
+  setDims(gauge_param.X);
+
+  const int lat_size[4] = {xdim * gridsize_from_cmdline[0], ydim * gridsize_from_cmdline[1],
+                           zdim * gridsize_from_cmdline[2], tdim * gridsize_from_cmdline[3]};
+  QudaInitArgs_t init_args;
+  init_args.verbosity = verbosity;
+  init_args.layout.latsize = lat_size;
+  init_args.layout.machsize = gridsize_from_cmdline.data();
+  init_args.layout.device = device_ordinal;
+  qudaInit(init_args);
+
+  // random SU(3) configurations, reordered from QDP to MILC order
+  void *qdp_link[4];
+  for (int d = 0; d < 4; d++) qdp_link[d] = safe_malloc(V * gauge_site_size * sizeof(double));
+  for (int c = 0; c < n_config; c++) {
+    constructQudaGaugeField(qdp_link, 1, QUDA_DOUBLE_PRECISION, &gauge_param);
+    in_link[c].resize(4 * V * gauge_site_size);
+    for (int i = 0; i < V; i++)
+      for (int d = 0; d < 4; d++)
+        for (int k = 0; k < gauge_site_size; k++)
+          in_link[c][(i * 4 + d) * gauge_site_size + k] = static_cast<double *>(qdp_link[d])[i * gauge_site_size + k];
+    fat_link[c].resize(4 * V * gauge_site_size);
+    long_link[c].resize(4 * V * gauge_site_size);
+  }
+  for (int d = 0; d < 4; d++) host_free(qdp_link[d]);
+
+  source.resize(V * stag_spinor_site_size);
+  for (auto &s : source) s = rand() / (double)RAND_MAX - 0.5;
+
+  // reference solutions
+  std::vector<double> ref[n_config];
+  for (int c = n_config - 1; c >= 0; c--) {
+    loadLinks(c);
+    ref[c] = solve(c);
+  }
+
+  int fail = 0;
+  auto check = [&](const char *step, int config, const std::vector<double> &x) {
+    double dev = deviation(x, ref[config]);
+    printfQuda("%s: configuration %d deviation = %e\n", step, config, dev);
+    if (!(dev < solution_tol)) {
+      printfQuda("ERROR: %s does not match the reference solve\n", step);
+      fail++;
+    }
+  };
+
+  // the resident links still come from configuration 0, so this is a genuine skip
+  loadLinks(0);
+  check("unchanged links", 0, solve(0));
+
+  // load configuration 1 behind the back of the link construction
+  check("reloaded links", 1, solve(1, true));
+
+  // configuration 0 must now be constructed again, not skipped
+  loadLinks(0);
+  check("alternated links", 0, solve(0));
+
+  // and back again, twice, to exercise both the rebuild and the skip
+  loadLinks(1);
+  check("alternated links", 1, solve(1));
+  loadLinks(1);
+  check("unchanged links", 1, solve(1));
+
+  qudaFinalize();
+  finalizeComms();
+
+  return fail;
+}
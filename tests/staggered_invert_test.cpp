@@ -174,6 +174,8 @@ int main(int argc, char **argv)
 
   int num_sub_partition = grid_partition[0] * grid_partition[1] * grid_partition[2] * grid_partition[3];
   bool use_split_grid = num_sub_partition > 1;
+  // block solvers take all sources at once through the multi-source interface
+  bool use_multi_src = use_split_grid || (inv_type == QUDA_BLOCK_CG_INVERTER && Nsrc > 1);
 
   if (inv_multigrid) {
 
@@ -279,6 +281,7 @@ int main(int argc, char **argv)
     if (use_split_grid) { errorQuda("Split grid does not work with MG yet."); }
     mg_preconditioner = newMultigridQuda(&mg_param);
     inv_param.preconditioner = mg_preconditioner;
+    if (mg_param.hierarchy_store == QUDA_BOOLEAN_TRUE) dumpMultigridQuda(mg_preconditioner, &mg_param);
   }
 
   // Staggered vector construct START
@@ -332,7 +335,7 @@ int main(int argc, char **argv)
 
     for (int k = 0; k < Nsrc; k++) { quda::spinorNoise(*in[k], *rng, QUDA_NOISE_UNIFORM); }
 
-    if (!use_split_grid) {
+    if (!use_multi_src) {
       for (int k = 0; k < Nsrc; k++) {
         if (inv_deflate) eig_param.preserve_deflation = k < Nsrc - 1 ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
         invertQuda(out[k]->V(), in[k]->V(), &inv_param);
@@ -418,7 +421,7 @@ int main(int argc, char **argv)
   } // switch
 
   // Compute timings
-  if (Nsrc > 1 && !use_split_grid) performanceStats(time, gflops, iter);
+  if (Nsrc > 1 && !use_multi_src) performanceStats(time, gflops, iter);
 
   // Free RNG
   delete rng;
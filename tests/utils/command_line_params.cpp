@@ -44,6 +44,7 @@ char latfile[256] = "";
 bool unit_gauge = false;
 double gaussian_sigma = 0.2;
 char gauge_outfile[256] = "";
+int gauge_stream_slab = -1;
 int Nsrc = 1;
 int Msrc = 1;
 int niter = 100;
@@ -58,6 +59,8 @@ int test_type = 0;
 quda::mgarray<int> nvec = {};
 quda::mgarray<char[256]> mg_vec_infile;
 quda::mgarray<char[256]> mg_vec_outfile;
+char mg_hierarchy_infile[256] = "";
+char mg_hierarchy_outfile[256] = "";
 QudaInverterType inv_type;
 bool inv_deflate = false;
 bool inv_multigrid = false;
@@ -89,6 +92,7 @@ double tol_precondition = 1e-1;
 double tol_hq = 0.;
 double reliable_delta = 0.1;
 bool alternative_reliable = false;
+bool adaptive_precision = false;
 QudaTwistFlavorType twist_flavor = QUDA_TWIST_SINGLET;
 QudaMassNormalization normalization = QUDA_KAPPA_NORMALIZATION;
 QudaMatPCType matpc_type = QUDA_MATPC_EVEN_EVEN;
@@ -111,6 +115,7 @@ quda::mgarray<QudaInverterType> setup_inv = {};
 quda::mgarray<QudaSolveType> coarse_solve_type = {};
 quda::mgarray<QudaSolveType> smoother_solve_type = {};
 quda::mgarray<int> num_setup_iter = {};
+quda::mgarray<int> setup_batch_size = {};
 quda::mgarray<double> setup_tol = {};
 quda::mgarray<int> setup_maxiter = {};
 quda::mgarray<int> setup_maxiter_refresh = {};
@@ -132,11 +137,20 @@ quda::mgarray<QudaCABasis> coarse_solver_ca_basis = {};
 quda::mgarray<int> coarse_solver_ca_basis_size = {};
 quda::mgarray<double> coarse_solver_ca_lambda_min = {};
 quda::mgarray<double> coarse_solver_ca_lambda_max = {};
+quda::mgarray<int> coarse_solver_agglomerate_volume = {};
+quda::mgarray<bool> coarse_solver_async = {};
+quda::mgarray<int> coarse_solver_async_threads = {};
 bool generate_nullspace = true;
 bool generate_all_levels = true;
 quda::mgarray<QudaSchwarzType> mg_schwarz_type = {};
 quda::mgarray<int> mg_schwarz_cycle = {};
+quda::mgarray<int> mg_schwarz_block = {};
+quda::mgarray<QudaPrecision> mg_block_float_prec = {};
+quda::mgarray<QudaMultigridCycleType> mg_cycle_type = {};
 bool mg_evolve_thin_updates = false;
+bool mg_evolve_incremental_refresh = false;
+double mg_incremental_refresh_gauge_change = 0.1;
+double mg_incremental_refresh_transfer_tol = 1e-2;
 
 // Aggregation type for the top level of staggered
 // FIXME: replace with QUDA_TRANSFER_OPTIMIZED_KD when ready
@@ -178,7 +192,7 @@ int eig_n_ev = 16;
 int eig_n_kr = 32;
 int eig_n_conv = -1;        // If unchanged, will be set to n_ev
 int eig_n_ev_deflate = -1;  // If unchanged, will be set to n_conv
-int eig_batched_rotate = 0; // If unchanged, will be set to maximum
+int eig_batched_rotate = 0; // If unchanged, will be chosen automatically
 bool eig_require_convergence = true;
 int eig_check_interval = 10;
 int eig_max_restarts = 1000;
@@ -249,7 +263,8 @@ std::array<int, 4> grid_partition = {1, 1, 1, 1};
 
 namespace
 {
-  CLI::TransformPairs<QudaCABasis> ca_basis_map {{"power", QUDA_POWER_BASIS}, {"chebyshev", QUDA_CHEBYSHEV_BASIS}};
+  CLI::TransformPairs<QudaCABasis> ca_basis_map {
+    {"power", QUDA_POWER_BASIS}, {"chebyshev", QUDA_CHEBYSHEV_BASIS}, {"newton", QUDA_NEWTON_BASIS}};
 
   CLI::TransformPairs<QudaContractType> contract_type_map {{"open", QUDA_CONTRACT_TYPE_OPEN},
                                                            {"dr", QUDA_CONTRACT_TYPE_DR}};
@@ -297,7 +312,8 @@ namespace
                                                            {"ca-cg", QUDA_CA_CG_INVERTER},
                                                            {"ca-cgne", QUDA_CA_CGNE_INVERTER},
                                                            {"ca-cgnr", QUDA_CA_CGNR_INVERTER},
-                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER}};
+                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER},
+                                                           {"block-cg", QUDA_BLOCK_CG_INVERTER}};
 
   CLI::TransformPairs<QudaPrecision> precision_map {{"double", QUDA_DOUBLE_PRECISION},
                                                     {"single", QUDA_SINGLE_PRECISION},
@@ -306,7 +322,11 @@ namespace
 
   CLI::TransformPairs<QudaSchwarzType> schwarz_type_map {{"invalid", QUDA_INVALID_SCHWARZ},
                                                          {"additive", QUDA_ADDITIVE_SCHWARZ},
-                                                         {"multiplicative", QUDA_MULTIPLICATIVE_SCHWARZ}};
+                                                         {"multiplicative", QUDA_MULTIPLICATIVE_SCHWARZ},
+                                                         {"block-jacobi", QUDA_BLOCK_JACOBI_SCHWARZ}};
+
+  CLI::TransformPairs<QudaMultigridCycleType> mg_cycle_type_map {{"recursive", QUDA_MG_CYCLE_RECURSIVE},
+                                                                 {"kcycle", QUDA_MG_CYCLE_KCYCLE}};
 
   CLI::TransformPairs<QudaSolutionType> solution_type_map {{"mat", QUDA_MAT_SOLUTION},
                                                            {"mat-dag-mat", QUDA_MATDAG_MAT_SOLUTION},
@@ -369,9 +389,11 @@ std::shared_ptr<QUDAApp> make_app(std::string app_description, std::string app_n
   quda_app->option_defaults()->always_capture_default();
 
   quda_app->add_option("--alternative-reliable", alternative_reliable, "use alternative reliable updates");
+  quda_app->add_option("--adaptive-precision", adaptive_precision,
+                       "adapt the sloppy precision at runtime between the precondition, sloppy and full precision (CG only, default false)");
   quda_app->add_option("--anisotropy", anisotropy, "Temporal anisotropy factor (default 1.0)");
 
-  quda_app->add_option("--ca-basis-type", ca_basis, "The basis to use for CA-CG (default power)")
+  quda_app->add_option("--ca-basis-type", ca_basis, "The basis to use for CA-CG or CA-GCR (default power)")
     ->transform(CLI::QUDACheckedTransformer(ca_basis_map));
   quda_app->add_option(
     "--cheby-basis-eig-max",
@@ -427,6 +449,9 @@ std::shared_ptr<QUDAApp> make_app(std::string app_description, std::string app_n
     "--laplace3D", laplace3D,
     "Restrict laplace operator to omit the t dimension (n=3), or include all dims (n=4) (default 4)");
   quda_app->add_option("--load-gauge", latfile, "Load gauge field \" file \" for the test (requires QIO)");
+  quda_app->add_option("--gauge-stream-slab", gauge_stream_slab,
+                       "Stream the gauge field to the device in slabs of this many time slices, 0 selects a default "
+                       "(default -1, load the whole field at once)");
   quda_app->add_option("--Lsdim", Lsdim, "Set Ls dimension size(default 16)");
   quda_app->add_option("--mass", mass, "Mass of Dirac operator (default 0.1)");
 
@@ -601,8 +626,10 @@ void add_eigen_option_group(std::shared_ptr<QUDAApp> quda_app)
   // Option group for Eigensolver related options
   auto opgroup = quda_app->add_option_group("Eigensolver", "Options controlling eigensolver");
 
-  opgroup->add_option("--eig-amax", eig_amax, "The maximum in the polynomial acceleration")->check(CLI::PositiveNumber);
-  opgroup->add_option("--eig-amin", eig_amin, "The minimum in the polynomial acceleration")->check(CLI::PositiveNumber);
+  opgroup->add_option("--eig-amax", eig_amax, "The maximum in the polynomial acceleration (0 = estimated)")
+    ->check(CLI::Range(0.0, std::numeric_limits<double>::max()));
+  opgroup->add_option("--eig-amin", eig_amin, "The minimum in the polynomial acceleration (0 = chosen automatically)")
+    ->check(CLI::Range(0.0, std::numeric_limits<double>::max()));
 
   opgroup->add_option("--eig-ARPACK-logfile", eig_arpack_logfile, "The filename storing the log from arpack");
   opgroup->add_option("--eig-arpack-check", eig_arpack_check,
@@ -624,8 +651,10 @@ void add_eigen_option_group(std::shared_ptr<QUDAApp> quda_app)
   opgroup->add_option("--eig-n-ev", eig_n_ev, "The size of eigenvector search space in the eigensolver");
   opgroup->add_option("--eig-n-kr", eig_n_kr, "The size of the Krylov subspace to use in the eigensolver");
   opgroup->add_option("--eig-batched-rotate", eig_batched_rotate,
-                      "The maximum number of extra eigenvectors the solver may allocate to perform a Ritz rotation.");
-  opgroup->add_option("--eig-poly-deg", eig_poly_deg, "TODO");
+                      "The maximum number of extra eigenvectors the solver may allocate to perform a Ritz rotation "
+                      "(default 0, chosen automatically from the available memory)");
+  opgroup->add_option("--eig-poly-deg", eig_poly_deg,
+                      "The degree of the Chebyshev polynomial (default 100, 0 = chosen automatically)");
   opgroup->add_option(
     "--eig-require-convergence",
     eig_require_convergence, "If true, the solver will error out if convergence is not attained. If false, a warning will be given (default true)");
@@ -715,7 +744,8 @@ void add_multigrid_option_group(std::shared_ptr<QUDAApp> quda_app)
 
   quda_app->add_mgoption(opgroup, "--mg-coarse-solver-ca-basis-type", coarse_solver_ca_basis,
                          CLI::QUDACheckedTransformer(ca_basis_map),
-                         "The basis to use for CA-CG setup of multigrid(default power)");
+                         "The basis to use for the CA-CG or CA-GCR coarse solver: power, chebyshev or newton, with the "
+                         "chebyshev interval and newton shifts estimated from the operator (default power)");
   quda_app->add_mgoption(opgroup, "--mg-coarse-solver-cheby-basis-eig-max", coarse_solver_ca_lambda_max,
                          CLI::PositiveNumber,
                          "Conservative estimate of largest eigenvalue for Chebyshev basis CA-CG in setup of multigrid "
@@ -723,6 +753,16 @@ void add_multigrid_option_group(std::shared_ptr<QUDAApp> quda_app)
   quda_app->add_mgoption(
     opgroup, "--mg-coarse-solver-cheby-basis-eig-min", coarse_solver_ca_lambda_min, CLI::PositiveNumber,
     "Conservative estimate of smallest eigenvalue for Chebyshev basis CA-CG in setup of multigrid (default 0)");
+  quda_app->add_mgoption(opgroup, "--mg-coarse-solver-agglomerate-volume", coarse_solver_agglomerate_volume,
+                         CLI::PositiveNumber,
+                         "Agglomerate the coarse solver onto fewer processes until the local coarse volume reaches "
+                         "this value (default 0, no agglomeration, only for the coarsest level)");
+  quda_app->add_mgoption(opgroup, "--mg-coarse-solver-async", coarse_solver_async, CLI::Validator(),
+                         "Run a CPU-located coarse solve on a worker thread, overlapping with the post-smoothing on "
+                         "the finer level (default false, only for the coarsest level)");
+  quda_app->add_mgoption(opgroup, "--mg-coarse-solver-async-threads", coarse_solver_async_threads,
+                         CLI::PositiveNumber,
+                         "Number of host threads used by the asynchronous coarse solve (default 0, OpenMP default)");
   quda_app->add_mgoption(opgroup, "--mg-coarse-solver-maxiter", coarse_solver_maxiter, CLI::PositiveNumber,
                          "The coarse solver maxiter for each level (default 100)");
   quda_app->add_mgoption(opgroup, "--mg-coarse-solver-tol", coarse_solver_tol, CLI::PositiveNumber,
@@ -753,9 +793,9 @@ void add_multigrid_option_group(std::shared_ptr<QUDAApp> quda_app)
                          "The size of the Krylov subspace to use in the eigensolver");
   quda_app->add_mgoption(opgroup, "--mg-eig-n-ev-deflate", mg_eig_n_ev_deflate, CLI::Validator(),
                          "The number of converged eigenpairs that will be used in the deflation routines");
-  quda_app->add_mgoption(
-    opgroup, "--mg-eig-batched-rotate", mg_eig_batched_rotate, CLI::Validator(),
-    "The maximum number of extra eigenvectors the solver may allocate to perform a Ritz rotation.");
+  quda_app->add_mgoption(opgroup, "--mg-eig-batched-rotate", mg_eig_batched_rotate, CLI::Validator(),
+                         "The maximum number of extra eigenvectors the solver may allocate to perform a Ritz rotation "
+                         "(default 0, chosen automatically from the available memory)");
   quda_app->add_mgoption(opgroup, "--mg-eig-poly-deg", mg_eig_poly_deg, CLI::PositiveNumber,
                          "Set the degree of the Chebyshev polynomial (default 100)");
   quda_app->add_mgoption(
@@ -783,6 +823,14 @@ void add_multigrid_option_group(std::shared_ptr<QUDAApp> quda_app)
     generate_all_levels, "true=generate null-space on all levels, false=generate on level 0 and create other levels from that (default true)");
   opgroup->add_option("--mg-evolve-thin-updates", mg_evolve_thin_updates,
                       "Utilize thin updates for multigrid evolution tests (default false)");
+  opgroup->add_option("--mg-evolve-incremental-refresh", mg_evolve_incremental_refresh,
+                      "Utilize incremental refresh driven by the gauge-field change for multigrid evolution tests "
+                      "(default false)");
+  opgroup->add_option("--mg-incremental-refresh-gauge-change", mg_incremental_refresh_gauge_change,
+                      "Relative gauge-field change for which incremental refresh uses the full refresh iterations "
+                      "(default 0.1)");
+  opgroup->add_option("--mg-incremental-refresh-transfer-tol", mg_incremental_refresh_transfer_tol,
+                      "Null-space defect above which incremental refresh rebuilds the transfer operator (default 1e-2)");
   opgroup->add_option("--mg-generate-nullspace", generate_nullspace,
                       "Generate the null-space vector dynamically (default true, if set false and mg-load-vec isn't "
                       "set, creates free-field null vectors)");
@@ -793,6 +841,10 @@ void add_multigrid_option_group(std::shared_ptr<QUDAApp> quda_app)
                          "Load the vectors <file> for the multigrid_test (requires QIO)");
   quda_app->add_mgoption(opgroup, "--mg-save-vec", mg_vec_outfile, CLI::Validator(),
                          "Save the generated null-space vectors <file> from the multigrid_test (requires QIO)");
+  opgroup->add_option("--mg-load-hierarchy", mg_hierarchy_infile,
+                      "Restore the multigrid hierarchy from checkpoint <file> if it matches the gauge field");
+  opgroup->add_option("--mg-save-hierarchy", mg_hierarchy_outfile,
+                      "Checkpoint the multigrid hierarchy to <file> after setup");
 
   quda_app
     ->add_mgoption("--mg-eig-save-prec", mg_eig_save_prec, CLI::Validator(),
@@ -831,6 +883,18 @@ void add_multigrid_option_group(std::shared_ptr<QUDAApp> quda_app)
     ->transform(CLI::QUDACheckedTransformer(schwarz_type_map));
   quda_app->add_mgoption(opgroup, "--mg-schwarz-cycle", mg_schwarz_cycle, CLI::PositiveNumber,
                          "The number of Schwarz cycles to apply per smoother application (default=1)");
+  quda_app->add_mgoption(opgroup, "--mg-schwarz-block", mg_schwarz_block, CLI::PositiveNumber,
+                         "The hypercubic block extent used by block-jacobi Schwarz smoothing (default=2)");
+  quda_app
+    ->add_mgoption(opgroup, "--mg-block-float-prec", mg_block_float_prec, CLI::Validator(),
+                   "The precision of the block floating point coarse links used by the smoother (half or quarter; "
+                   "default=invalid, disabled)")
+    ->transform(CLI::QUDACheckedTransformer(precision_map));
+  quda_app
+    ->add_mgoption(opgroup, "--mg-cycle-type", mg_cycle_type, CLI::Validator(),
+                   "The type of multigrid cycle to apply on each level; kcycle retunes the smoother iterations "
+                   "between solves from the observed work (recursive (default), kcycle)")
+    ->transform(CLI::QUDACheckedTransformer(mg_cycle_type_map));
   quda_app->add_mgoption(opgroup, "--mg-setup-ca-basis-size", setup_ca_basis_size, CLI::PositiveNumber,
                          "The basis size to use for CA-CG setup of multigrid (default 4)");
   quda_app->add_mgoption(opgroup, "--mg-setup-ca-basis-type", setup_ca_basis, CLI::QUDACheckedTransformer(ca_basis_map),
@@ -845,6 +909,8 @@ void add_multigrid_option_group(std::shared_ptr<QUDAApp> quda_app)
                          "The inverter to use for the setup of multigrid (default bicgstab)");
   quda_app->add_mgoption(opgroup, "--mg-setup-iters", num_setup_iter, CLI::PositiveNumber,
                          "The number of setup iterations to use for the multigrid (default 1)");
+  quda_app->add_mgoption(opgroup, "--mg-setup-batch-size", setup_batch_size, CLI::PositiveNumber,
+                         "The number of null-space vectors to relax simultaneously in the setup (default 1)");
 
   quda_app->add_mgoption(opgroup, "--mg-setup-location", setup_location, CLI::QUDACheckedTransformer(field_location_map),
                          "The location where the multigrid setup will be computed (default cuda)");
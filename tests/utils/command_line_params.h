@@ -181,6 +181,7 @@ extern char latfile[256];
 extern bool unit_gauge;
 extern double gaussian_sigma;
 extern char gauge_outfile[256];
+extern int gauge_stream_slab;
 extern int Nsrc;
 extern int Msrc;
 extern int niter;
@@ -195,6 +196,8 @@ extern int test_type;
 extern quda::mgarray<int> nvec;
 extern quda::mgarray<char[256]> mg_vec_infile;
 extern quda::mgarray<char[256]> mg_vec_outfile;
+extern char mg_hierarchy_infile[256];
+extern char mg_hierarchy_outfile[256];
 extern QudaInverterType inv_type;
 extern bool inv_deflate;
 extern bool inv_multigrid;
@@ -226,6 +229,7 @@ extern double tol_precondition;
 extern double tol_hq;
 extern double reliable_delta;
 extern bool alternative_reliable;
+extern bool adaptive_precision;
 extern QudaTwistFlavorType twist_flavor;
 extern QudaMassNormalization normalization;
 extern QudaMatPCType matpc_type;
@@ -247,6 +251,7 @@ extern quda::mgarray<QudaInverterType> setup_inv;
 extern quda::mgarray<QudaSolveType> coarse_solve_type;
 extern quda::mgarray<QudaSolveType> smoother_solve_type;
 extern quda::mgarray<int> num_setup_iter;
+extern quda::mgarray<int> setup_batch_size;
 extern quda::mgarray<double> setup_tol;
 extern quda::mgarray<int> setup_maxiter;
 extern quda::mgarray<int> setup_maxiter_refresh;
@@ -268,11 +273,20 @@ extern quda::mgarray<QudaCABasis> coarse_solver_ca_basis;
 extern quda::mgarray<int> coarse_solver_ca_basis_size;
 extern quda::mgarray<double> coarse_solver_ca_lambda_min;
 extern quda::mgarray<double> coarse_solver_ca_lambda_max;
+extern quda::mgarray<int> coarse_solver_agglomerate_volume;
+extern quda::mgarray<bool> coarse_solver_async;
+extern quda::mgarray<int> coarse_solver_async_threads;
 extern bool generate_nullspace;
 extern bool generate_all_levels;
 extern quda::mgarray<QudaSchwarzType> mg_schwarz_type;
 extern quda::mgarray<int> mg_schwarz_cycle;
+extern quda::mgarray<int> mg_schwarz_block;
+extern quda::mgarray<QudaPrecision> mg_block_float_prec;
+extern quda::mgarray<QudaMultigridCycleType> mg_cycle_type;
 extern bool mg_evolve_thin_updates;
+extern bool mg_evolve_incremental_refresh;
+extern double mg_incremental_refresh_gauge_change;
+extern double mg_incremental_refresh_transfer_tol;
 extern QudaTransferType staggered_transfer_type;
 
 extern quda::mgarray<std::array<int, 4>> geo_block_size;
@@ -301,7 +315,7 @@ extern int eig_n_ev;
 extern int eig_n_kr;
 extern int eig_n_conv;         // If unchanged, will be set to n_ev
 extern int eig_n_ev_deflate;   // If unchanged, will be set to n_conv
-extern int eig_batched_rotate; // If unchanged, will be set to maximum
+extern int eig_batched_rotate; // If unchanged, will be chosen automatically
 extern bool eig_require_convergence;
 extern int eig_check_interval;
 extern int eig_max_restarts;
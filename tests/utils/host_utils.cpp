@@ -90,6 +90,7 @@ void setQudaDefaultMgTestParams()
     mg_verbosity[i] = QUDA_SUMMARIZE;
     setup_inv[i] = QUDA_BICGSTAB_INVERTER;
     num_setup_iter[i] = 1;
+    setup_batch_size[i] = 1;
     setup_tol[i] = 5e-6;
     setup_maxiter[i] = 500;
     setup_maxiter_refresh[i] = 20;
@@ -98,6 +99,9 @@ void setQudaDefaultMgTestParams()
     smoother_solve_type[i] = QUDA_INVALID_SOLVE;
     mg_schwarz_type[i] = QUDA_INVALID_SCHWARZ;
     mg_schwarz_cycle[i] = 1;
+    mg_schwarz_block[i] = 2;
+    mg_block_float_prec[i] = QUDA_INVALID_PRECISION;
+    mg_cycle_type[i] = QUDA_MG_CYCLE_RECURSIVE;
     smoother_type[i] = QUDA_GCR_INVERTER;
     smoother_tol[i] = 0.25;
     coarse_solver[i] = QUDA_GCR_INVERTER;
@@ -137,6 +141,9 @@ void setQudaDefaultMgTestParams()
     coarse_solver_ca_basis_size[i] = 4;
     coarse_solver_ca_lambda_min[i] = 0.0;
     coarse_solver_ca_lambda_max[i] = -1.0;
+    coarse_solver_agglomerate_volume[i] = 0;
+    coarse_solver_async[i] = false;
+    coarse_solver_async_threads[i] = 0;
 
     strcpy(mg_vec_infile[i], "");
     strcpy(mg_vec_outfile[i], "");
@@ -183,6 +190,95 @@ void constructHostGaugeField(void **gauge, QudaGaugeParam &gauge_param, int argc
   constructQudaGaugeField(gauge, construct_type, gauge_param.cpu_prec, &gauge_param);
 }
 
+namespace
+{
+  struct GaugeSlabContext {
+    void *gauge;
+    QudaGaugeFieldOrder order;
+    size_t link_bytes;
+  };
+} // namespace
+
+// Gauge reader for loadGaugeStreamQuda: copies a slab of time slices
+// out of a resident QDP or MILC ordered host field passed as context.
+// Both orders are parity ordered, so each time slice is contiguous
+// within each parity
+static int readGaugeSlab(void *h_gauge, int t_begin, int t_end, void *context)
+{
+  auto &ctx = *static_cast<GaugeSlabContext *>(context);
+  bool qdp = ctx.order == QUDA_QDP_GAUGE_ORDER;
+  size_t site_bytes = (qdp ? 1 : 4) * ctx.link_bytes;
+  size_t slice_bytes = (Vh / Z[3]) * site_bytes;
+  size_t slab_bytes = (t_end - t_begin) * slice_bytes;
+  for (int dir = 0; dir < (qdp ? 4 : 1); dir++) {
+    char *src = static_cast<char *>(qdp ? static_cast<void **>(ctx.gauge)[dir] : ctx.gauge);
+    char *dst = static_cast<char *>(qdp ? static_cast<void **>(h_gauge)[dir] : h_gauge);
+    for (int parity = 0; parity < 2; parity++)
+      memcpy(dst + parity * slab_bytes, src + parity * Vh * site_bytes + t_begin * slice_bytes, slab_bytes);
+  }
+  return 0;
+}
+
+void loadHostGaugeQuda(void *gauge, QudaGaugeParam &gauge_param)
+{
+  if (gauge_stream_slab < 0) {
+    loadGaugeQuda(gauge, &gauge_param);
+    return;
+  }
+  if (gauge_param.gauge_order != QUDA_QDP_GAUGE_ORDER && gauge_param.gauge_order != QUDA_MILC_GAUGE_ORDER)
+    errorQuda("Streaming not supported for gauge order %d", gauge_param.gauge_order);
+
+  GaugeSlabContext context = {gauge, gauge_param.gauge_order, gauge_site_size * gauge_param.cpu_prec};
+
+  // check the streamed field against the field loaded at once, in the
+  // requested precision and in fixed point, which depends on the link max
+  if (gauge_param.type == QUDA_WILSON_LINKS || gauge_param.type == QUDA_ASQTAD_FAT_LINKS) {
+    size_t field_bytes = V * context.link_bytes;
+    std::vector<char> loaded(4 * field_bytes), streamed(4 * field_bytes);
+    void *loaded_qdp[4], *streamed_qdp[4];
+    for (int dir = 0; dir < 4; dir++) {
+      loaded_qdp[dir] = loaded.data() + dir * field_bytes;
+      streamed_qdp[dir] = streamed.data() + dir * field_bytes;
+    }
+    bool qdp = gauge_param.gauge_order == QUDA_QDP_GAUGE_ORDER;
+    void *loaded_ptr = qdp ? static_cast<void *>(loaded_qdp) : loaded.data();
+    void *streamed_ptr = qdp ? static_cast<void *>(streamed_qdp) : streamed.data();
+
+    for (auto prec : {gauge_param.cuda_prec, QUDA_HALF_PRECISION}) {
+      QudaGaugeParam check_param = gauge_param;
+      check_param.cuda_prec = prec;
+      check_param.cuda_prec_sloppy = prec;
+      check_param.cuda_prec_precondition = prec;
+      check_param.cuda_prec_refinement_sloppy = prec;
+      check_param.cuda_prec_eigensolver = prec;
+
+      loadGaugeQuda(gauge, &check_param);
+      saveGaugeQuda(loaded_ptr, &check_param);
+      loadGaugeStreamQuda(readGaugeSlab, &context, gauge_stream_slab, &check_param);
+      saveGaugeQuda(streamed_ptr, &check_param);
+
+      double deviation = 0.0, link_max = 0.0;
+      size_t length = 4 * V * gauge_site_size;
+      for (size_t i = 0; i < length; i++) {
+        double a = gauge_param.cpu_prec == QUDA_DOUBLE_PRECISION ? reinterpret_cast<double *>(loaded.data())[i] :
+                                                                   reinterpret_cast<float *>(loaded.data())[i];
+        double b = gauge_param.cpu_prec == QUDA_DOUBLE_PRECISION ? reinterpret_cast<double *>(streamed.data())[i] :
+                                                                   reinterpret_cast<float *>(streamed.data())[i];
+        deviation = std::max(deviation, fabs(a - b));
+        link_max = std::max(link_max, fabs(a));
+      }
+      comm_allreduce_max(&deviation);
+      comm_allreduce_max(&link_max);
+      printfQuda("Streamed gauge field in %s precision: max deviation %e relative to the link max %e\n",
+                 get_prec_str(prec), deviation, link_max);
+      if (!(deviation <= getTolerance(prec) * link_max))
+        errorQuda("Streamed gauge field deviates from the field loaded at once in %s precision", get_prec_str(prec));
+    }
+  }
+
+  loadGaugeStreamQuda(readGaugeSlab, &context, gauge_stream_slab, &gauge_param);
+}
+
 void constructHostCloverField(void *clover, void *, QudaInvertParam &inv_param)
 {
   double norm = 0.01; // clover components are random numbers in the range (-norm, norm)
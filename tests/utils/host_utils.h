@@ -89,6 +89,9 @@ void setQudaDefaultMgTestParams();
 //------------------------------------------------------
 void constructQudaGaugeField(void **gauge, int type, QudaPrecision precision, QudaGaugeParam *param);
 void constructHostGaugeField(void **gauge, QudaGaugeParam &gauge_param, int argc, char **argv);
+// Load a host gauge field in QDP or MILC order.  With --gauge-stream-slab the field is
+// streamed in slabs, after checking that streaming matches loading the field at once
+void loadHostGaugeQuda(void *gauge, QudaGaugeParam &gauge_param);
 void constructHostCloverField(void *clover, void *clover_inv, QudaInvertParam &inv_param);
 void constructQudaCloverField(void *clover, double norm, double diag, QudaPrecision precision);
 template <typename Float> void constructCloverField(Float *res, double norm, double diag);
@@ -220,6 +220,7 @@ void setInvertParam(QudaInvertParam &inv_param)
   inv_param.maxiter = niter;
   inv_param.reliable_delta = reliable_delta;
   inv_param.use_alternative_reliable = alternative_reliable;
+  inv_param.use_adaptive_precision = adaptive_precision ? 1 : 0;
   inv_param.use_sloppy_partial_accumulator = 0;
   inv_param.solution_accumulator_pipeline = solution_accumulator_pipeline;
   inv_param.max_res_increase = 1;
@@ -411,6 +412,7 @@ void setMultigridParam(QudaMultigridParam &mg_param)
     mg_param.verbosity[i] = mg_verbosity[i];
     mg_param.setup_inv_type[i] = setup_inv[i];
     mg_param.num_setup_iter[i] = num_setup_iter[i];
+    mg_param.setup_batch_size[i] = setup_batch_size[i];
     mg_param.setup_tol[i] = setup_tol[i];
     mg_param.setup_maxiter[i] = setup_maxiter[i];
     mg_param.setup_maxiter_refresh[i] = setup_maxiter_refresh[i];
@@ -436,7 +438,7 @@ void setMultigridParam(QudaMultigridParam &mg_param)
     mg_param.nu_post[i] = nu_post[i];
     mg_param.mu_factor[i] = mu_factor[i];
 
-    mg_param.cycle_type[i] = QUDA_MG_CYCLE_RECURSIVE;
+    mg_param.cycle_type[i] = mg_cycle_type[i];
 
     // Is not a staggered solve, always aggregate
     mg_param.transfer_type[i] = QUDA_TRANSFER_AGGREGATE;
@@ -456,6 +458,13 @@ void setMultigridParam(QudaMultigridParam &mg_param)
     mg_param.coarse_solver_ca_lambda_min[i] = coarse_solver_ca_lambda_min[i];
     mg_param.coarse_solver_ca_lambda_max[i] = coarse_solver_ca_lambda_max[i];
 
+    // Local coarse volume below which the coarse solver is agglomerated
+    mg_param.coarse_solver_agglomerate_volume[i] = coarse_solver_agglomerate_volume[i];
+
+    // Whether to overlap a CPU-located coarse solve with the finer level
+    mg_param.coarse_solver_async[i] = coarse_solver_async[i] ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+    mg_param.coarse_solver_async_threads[i] = coarse_solver_async_threads[i];
+
     mg_param.smoother[i] = smoother_type[i];
 
     // set the smoother / bottom solver tolerance (for MR smoothing this will be ignored)
@@ -473,6 +482,8 @@ void setMultigridParam(QudaMultigridParam &mg_param)
 
     // set number of Schwarz cycles to apply
     mg_param.smoother_schwarz_cycle[i] = mg_schwarz_cycle[i];
+    mg_param.smoother_schwarz_block[i] = mg_schwarz_block[i];
+    mg_param.block_float_precision[i] = mg_block_float_prec[i];
 
     // Set set coarse_grid_solution_type: this defines which linear
     // system we are solving on a given level
@@ -569,6 +580,9 @@ void setMultigridParam(QudaMultigridParam &mg_param)
   mg_param.use_mma = mg_use_mma ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
   // Whether or not to use thin restarts in the evolve tests
   mg_param.thin_update_only = mg_evolve_thin_updates ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  mg_param.incremental_refresh = mg_evolve_incremental_refresh ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  mg_param.incremental_refresh_gauge_change = mg_incremental_refresh_gauge_change;
+  mg_param.incremental_refresh_transfer_tol = mg_incremental_refresh_transfer_tol;
 
   // set file i/o parameters
   for (int i = 0; i < mg_param.n_level; i++) {
@@ -577,6 +591,10 @@ void setMultigridParam(QudaMultigridParam &mg_param)
     if (strcmp(mg_param.vec_infile[i], "") != 0) mg_param.vec_load[i] = QUDA_BOOLEAN_TRUE;
     if (strcmp(mg_param.vec_outfile[i], "") != 0) mg_param.vec_store[i] = QUDA_BOOLEAN_TRUE;
   }
+  strcpy(mg_param.hierarchy_infile, mg_hierarchy_infile);
+  strcpy(mg_param.hierarchy_outfile, mg_hierarchy_outfile);
+  mg_param.hierarchy_load = strcmp(mg_hierarchy_infile, "") != 0 ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  mg_param.hierarchy_store = strcmp(mg_hierarchy_outfile, "") != 0 ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
 
   mg_param.coarse_guess = mg_eig_coarse_guess ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
 
@@ -883,6 +901,7 @@ void setStaggeredInvertParam(QudaInvertParam &inv_param)
   inv_param.maxiter = niter;
   inv_param.reliable_delta = reliable_delta;
   inv_param.use_alternative_reliable = alternative_reliable;
+  inv_param.use_adaptive_precision = adaptive_precision ? 1 : 0;
   inv_param.use_sloppy_partial_accumulator = false;
   inv_param.solution_accumulator_pipeline = solution_accumulator_pipeline;
   inv_param.pipeline = pipeline;
@@ -1001,6 +1020,7 @@ void setStaggeredMultigridParam(QudaMultigridParam &mg_param)
     mg_param.verbosity[i] = mg_verbosity[i];
     mg_param.setup_inv_type[i] = setup_inv[i];
     mg_param.num_setup_iter[i] = num_setup_iter[i];
+    mg_param.setup_batch_size[i] = setup_batch_size[i];
     mg_param.setup_tol[i] = setup_tol[i];
     mg_param.setup_maxiter[i] = setup_maxiter[i];
 
@@ -1027,7 +1047,7 @@ void setStaggeredMultigridParam(QudaMultigridParam &mg_param)
 
     mg_param.transfer_type[i] = (i == 0) ? staggered_transfer_type : QUDA_TRANSFER_AGGREGATE;
 
-    mg_param.cycle_type[i] = QUDA_MG_CYCLE_RECURSIVE;
+    mg_param.cycle_type[i] = mg_cycle_type[i];
 
     // set the coarse solver wrappers including bottom solver
     mg_param.coarse_solver[i] = coarse_solver[i];
@@ -1044,6 +1064,13 @@ void setStaggeredMultigridParam(QudaMultigridParam &mg_param)
     mg_param.coarse_solver_ca_lambda_min[i] = coarse_solver_ca_lambda_min[i];
     mg_param.coarse_solver_ca_lambda_max[i] = coarse_solver_ca_lambda_max[i];
 
+    // Local coarse volume below which the coarse solver is agglomerated
+    mg_param.coarse_solver_agglomerate_volume[i] = coarse_solver_agglomerate_volume[i];
+
+    // Whether to overlap a CPU-located coarse solve with the finer level
+    mg_param.coarse_solver_async[i] = coarse_solver_async[i] ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+    mg_param.coarse_solver_async_threads[i] = coarse_solver_async_threads[i];
+
     mg_param.smoother[i] = smoother_type[i];
 
     // set the smoother / bottom solver tolerance (for MR smoothing this will be ignored)
@@ -1061,6 +1088,8 @@ void setStaggeredMultigridParam(QudaMultigridParam &mg_param)
 
     // set number of Schwarz cycles to apply
     mg_param.smoother_schwarz_cycle[i] = mg_schwarz_cycle[i];
+    mg_param.smoother_schwarz_block[i] = mg_schwarz_block[i];
+    mg_param.block_float_precision[i] = mg_block_float_prec[i];
 
     // Set set coarse_grid_solution_type: this defines which linear
     // system we are solving on a given level
@@ -1167,6 +1196,10 @@ void setStaggeredMultigridParam(QudaMultigridParam &mg_param)
     if (strcmp(mg_param.vec_infile[i], "") != 0) mg_param.vec_load[i] = QUDA_BOOLEAN_TRUE;
     if (strcmp(mg_param.vec_outfile[i], "") != 0) mg_param.vec_store[i] = QUDA_BOOLEAN_TRUE;
   }
+  strcpy(mg_param.hierarchy_infile, mg_hierarchy_infile);
+  strcpy(mg_param.hierarchy_outfile, mg_hierarchy_outfile);
+  mg_param.hierarchy_load = strcmp(mg_hierarchy_infile, "") != 0 ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  mg_param.hierarchy_store = strcmp(mg_hierarchy_outfile, "") != 0 ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
 
   mg_param.coarse_guess = mg_eig_coarse_guess ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
 
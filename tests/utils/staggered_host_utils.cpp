@@ -232,7 +232,7 @@ void loadFatLongGaugeQuda(void *milc_fatlink, void *milc_longlink, QudaGaugePara
   }
   gauge_param.reconstruct_precondition = QUDA_RECONSTRUCT_NO;
 
-  loadGaugeQuda(milc_fatlink, &gauge_param);
+  loadHostGaugeQuda(milc_fatlink, gauge_param);
 
   if (dslash_type == QUDA_ASQTAD_DSLASH) {
     gauge_param.type = QUDA_ASQTAD_LONG_LINKS;